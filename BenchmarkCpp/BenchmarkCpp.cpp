@@ -1,39 +1,82 @@
 #include <chrono>
-#include <fstream>
 #include <iostream>
 #include <memory>
 #include <vector>
 
+#include "..\NesCore\Movie.h"
 #include "..\NesCore\RomFile.h"
 #include "..\NesCore\NesSystem.h"
 
 int main(int argc, char *argv[])
 {
-    if (argc != 2)
+    // with a movie, we replay it instead of running without input, which also checks that the replay is faithful.
+    if (argc != 2 && argc != 3)
         return -1;
 
     auto path = argv[1];
     auto Frames = 10000;
 
-    std::ifstream file(path, std::ios::binary | std::ios::ate);
-    std::streamsize size = file.tellg();
-    file.seekg(0, std::ios::beg);
-
-    std::vector<char> buffer(size);
-    if (!file.read(buffer.data(), size))
-    {
+    auto romFile = TryMapINesFile(path);
+    if (!romFile)
         return -1;
-    }
 
     auto system = std::make_unique<NesSystem>(44100);
 
-    auto romFile = TryLoadINesFile(reinterpret_cast<uint8_t*>(&buffer[0]), buffer.size());
-    auto cart = TryCreateCart(romFile->Descriptor, std::move(romFile->PrgData), std::move(romFile->ChrData));
+    auto cart = TryCreateCart(romFile->Descriptor, romFile->PrgData, romFile->ChrData, romFile->Storage);
 
     cart->Initialize();
 
     system->InsertCart(std::move(cart));
-    system->Reset();
+    system->PowerCycle();
+
+    if (argc == 3)
+    {
+        auto movie = TryLoadMovie(argv[2]);
+        if (!movie)
+            return -1;
+
+        switch (StartMovie(*movie, *system))
+        {
+        case MovieStartResult::Started:
+            break;
+
+        case MovieStartResult::WrongRom:
+            std::cout << "the movie was recorded on a different ROM";
+            return -1;
+
+        case MovieStartResult::WrongLayout:
+            std::cout << "the movie was recorded by an incompatible build";
+            return -1;
+
+        case MovieStartResult::WrongCoreVersion:
+            std::cout << "the movie was recorded by a build which emulates differently";
+            return -1;
+
+        case MovieStartResult::WrongSampleRate:
+            std::cout << "the movie was recorded at a different sample rate";
+            return -1;
+
+        default:
+            std::cout << "the movie's starting state could not be restored";
+            return -1;
+        }
+
+        auto startTime = std::chrono::high_resolution_clock::now();
+
+        auto replayedFrames = ReplayMovie(*movie, *system);
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
+        std::cout << elapsed.count() << "ms";
+
+        if (replayedFrames != movie->Frames.size())
+        {
+            std::cout << std::endl << "desynced at frame " << replayedFrames;
+            return 1;
+        }
+
+        return 0;
+    }
 
     auto startTime = std::chrono::high_resolution_clock::now();
 
@@ -12,8 +12,12 @@
 #include "../NesCore/Display.h"
 #include "../NesCore/GameDatabase.h"
 #include "../NesCore/NesSystem.h"
+#include "../NesCore/NtscFilter.h"
 #include "../NesCore/RomFile.h"
+#include "../NesCore/StateSerializer.h"
+#include "../NesCore/SystemState.h"
 #include <memory>
+#include <vector>
 
 char retro_base_directory[4096];
 char retro_game_path[4096];
@@ -36,6 +40,21 @@ static retro_input_poll_t input_poll_cb;
 static retro_input_state_t input_state_cb;
 
 static std::unique_ptr<NesSystem> nesSystem;
+// kept between calls, so that capturing the state only copies the memory that has changed since the last one.
+static std::unique_ptr<SystemState> serializedState;
+
+// whether the frontend lets us pass a null frame to show the last one again, and whether the last frame it was given
+// is the one before the frame we just drew, which our display compares against.
+static bool canDupe;
+static bool frontendHasLastFrame;
+// the samples for each frame, interleaved into stereo.
+static std::vector<int16_t> audioFrame;
+
+// with the NTSC filter enabled, the system renders palette indices into our own frame, and the filter turns that into
+// the frame we give the frontend.
+static std::unique_ptr<NtscFilter> ntscFilter;
+static std::vector<uint16_t> ntscInput;
+static std::vector<uint32_t> ntscOutput;
 
 void retro_init(void)
 {
@@ -44,6 +63,8 @@ void retro_init(void)
 
 void retro_deinit(void)
 {
+    ntscFilter.reset();
+    serializedState.reset();
     nesSystem.reset();
 }
 
@@ -65,13 +86,20 @@ void retro_get_system_info(struct retro_system_info* info)
     info->valid_extensions = "nes";
 }
 
+static void get_geometry(retro_game_geometry* geometry)
+{
+    geometry->base_width = ntscFilter ? NtscFilter::NATIVE_WIDTH : Display::WIDTH;
+    geometry->base_height = Display::HEIGHT;
+    // the filter can be turned on while running, so we always leave room for it.
+    geometry->max_width = NtscFilter::NATIVE_WIDTH;
+    geometry->max_height = Display::HEIGHT;
+    // the filter's pixels are narrower, so the frame should keep the shape it has without it.
+    geometry->aspect_ratio = static_cast<float>(Display::WIDTH) / Display::HEIGHT;
+}
+
 void retro_get_system_av_info(struct retro_system_av_info* info)
 {
-    info->geometry.base_width = Display::WIDTH;
-    info->geometry.base_height = Display::HEIGHT;
-    info->geometry.max_width = Display::WIDTH;
-    info->geometry.max_height = Display::HEIGHT;
-    info->geometry.aspect_ratio = 0.0;
+    get_geometry(&info->geometry);
 
     info->timing.fps = 60.0;
     info->timing.sample_rate = 44100.0;
@@ -94,6 +122,51 @@ void retro_set_environment(retro_environment_t cb)
 
     environ_cb(RETRO_ENVIRONMENT_SET_INPUT_DESCRIPTORS, desc);
 
+    static const retro_variable variables[] = {
+        { "nesemu_ntsc_filter", "NTSC filter; disabled|enabled" },
+        { nullptr, nullptr },
+    };
+
+    environ_cb(RETRO_ENVIRONMENT_SET_VARIABLES, const_cast<retro_variable*>(variables));
+}
+
+static void update_variables(bool running)
+{
+    retro_variable variable{ "nesemu_ntsc_filter", nullptr };
+    auto ntsc = environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &variable) && variable.value &&
+        strcmp(variable.value, "enabled") == 0;
+
+    if (ntsc != (ntscFilter != nullptr))
+    {
+        if (ntsc)
+        {
+            ntscFilter = std::make_unique<NtscFilter>();
+            ntscInput.resize(Display::WIDTH * Display::HEIGHT);
+            ntscOutput.resize(NtscFilter::NATIVE_WIDTH * Display::HEIGHT);
+
+            auto data = reinterpret_cast<uint8_t*>(ntscInput.data());
+            nesSystem->SetFrameBuffers(PixelFormat::PaletteIndex, &data, 1, Display::WIDTH * sizeof(uint16_t));
+        }
+        else
+        {
+            ntscFilter.reset();
+            nesSystem->ResetFrameBuffers();
+        }
+
+        // the frontend asks for the geometry after loading, so we only need to tell it about changes after that.
+        if (running)
+        {
+            retro_game_geometry geometry;
+            get_geometry(&geometry);
+            environ_cb(RETRO_ENVIRONMENT_SET_GEOMETRY, &geometry);
+        }
+
+        frontendHasLastFrame = false;
+    }
+
+    // the colour phase moves on every frame, so filtered frames are never the same as the last one.  We only need to
+    // know which frames are unchanged if we can pass them on as dupes.
+    nesSystem->SetTrackFrameChanges(canDupe && !ntscFilter);
 }
 
 void retro_set_audio_sample(retro_audio_sample_t cb)
@@ -131,6 +204,9 @@ void retro_reset(void)
 {
     x_coord = 0;
     y_coord = 0;
+
+    if (nesSystem->HasCart())
+        nesSystem->SoftReset();
 }
 
 static void audio_callback(void)
@@ -144,6 +220,10 @@ static void audio_set_state(bool enable)
 
 void retro_run(void)
 {
+    bool variablesUpdated = false;
+    if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE_UPDATE, &variablesUpdated) && variablesUpdated)
+        update_variables(true);
+
     input_poll_cb();
 
     auto& controller = nesSystem->Controller1();
@@ -169,41 +249,86 @@ void retro_run(void)
 
     controller.SetButtonState(buttons);
 
-    nesSystem->RunFrame();
+    // the frontend tells us when it will throw the frame away, such as when it is running ahead, so we needn't draw it.
+    int audioVideo = 0;
+    if (!environ_cb(RETRO_ENVIRONMENT_GET_AUDIO_VIDEO_ENABLE, &audioVideo))
+        audioVideo = 3;
+
+    auto drawFrame = (audioVideo & 1) != 0;
+
+    // render straight into the frontend's memory when it offers it, rather than into our own buffer.
+    retro_framebuffer framebuffer{};
+    framebuffer.width = Display::WIDTH;
+    framebuffer.height = Display::HEIGHT;
+    framebuffer.access_flags = RETRO_MEMORY_ACCESS_WRITE;
+
+    auto useFramebuffer = drawFrame && !ntscFilter &&
+        environ_cb(RETRO_ENVIRONMENT_GET_CURRENT_SOFTWARE_FRAMEBUFFER, &framebuffer) &&
+        framebuffer.data &&
+        (framebuffer.format == RETRO_PIXEL_FORMAT_XRGB8888 || framebuffer.format == RETRO_PIXEL_FORMAT_RGB565);
+
+    if (useFramebuffer)
+    {
+        auto format = framebuffer.format == RETRO_PIXEL_FORMAT_RGB565 ? PixelFormat::Rgb565 : PixelFormat::Xrgb8888;
+        auto data = static_cast<uint8_t*>(framebuffer.data);
+        nesSystem->SetFrameBuffers(format, &data, 1, static_cast<uint32_t>(framebuffer.pitch));
+    }
+
+    if (drawFrame)
+        nesSystem->RunFrame();
+    else
+        nesSystem->SkipFrames(1);
 
     const auto& display = nesSystem->Display();
-    video_cb(display.Buffer(), Display::WIDTH, Display::HEIGHT, Display::WIDTH * sizeof(uint32_t));
-
-    //static std::array<int16_t, Apu::SAMPLES_PER_FRAME * 2> audioFrame;
-    //auto i = 0;
-    //for (auto sample : nesSystem->Apu().Samples())
-    //{
-    //    audioFrame[i++] = sample;
-    //    audioFrame[i++] = sample;
-    //}
-
-    //audio_batch_cb(&audioFrame[0], Apu::SAMPLES_PER_FRAME);
-
-    //for (unsigned i = 0; i < 44100 / 60; i++, phase++)
-    //{
-    //    int16_t val = 0x800 * sinf(2.0f * 3.1415926535 * phase * 300.0f / 30000.0f);
-    //    audio_cb(val, val);
-    //}
-
-    auto& apu = nesSystem->Apu();
-    auto samplesPerFrame = apu.SamplesPerFrame();
-    auto samples = apu.Samples();
-    for (auto sampleIndex = 0u; sampleIndex < samplesPerFrame; sampleIndex++)
+    if (ntscFilter)
     {
-        auto sample = samples[sampleIndex];
-        audio_cb(sample, sample);
+        auto pitch = static_cast<uint32_t>(NtscFilter::NATIVE_WIDTH * sizeof(uint32_t));
+        if (drawFrame)
+        {
+            auto output = reinterpret_cast<uint8_t*>(ntscOutput.data());
+            ntscFilter->Filter(display.Buffer(), display.Pitch(), display.ColorPhase(), output, pitch);
+        }
+
+        auto dupe = canDupe && !drawFrame;
+        video_cb(dupe ? NULL : ntscOutput.data(), NtscFilter::NATIVE_WIDTH, Display::HEIGHT, pitch);
     }
+    else
+    {
+        auto dupe = canDupe && (!drawFrame || (frontendHasLastFrame && display.FrameUnchanged()));
+        video_cb(dupe ? NULL : display.Buffer(), Display::WIDTH, Display::HEIGHT, display.Pitch());
+    }
+    frontendHasLastFrame = drawFrame;
+
+    // the frontend's buffer is only ours until the end of this frame.
+    if (useFramebuffer)
+        nesSystem->ResetFrameBuffers();
 
+    if (audioVideo & 2)
+    {
+        auto& apu = nesSystem->Apu();
+        auto samplesPerFrame = apu.SamplesPerFrame();
+        auto samples = apu.Samples();
+
+        audioFrame.resize(samplesPerFrame * 2);
+        for (auto sampleIndex = 0u; sampleIndex < samplesPerFrame; sampleIndex++)
+        {
+            audioFrame[sampleIndex * 2] = samples[sampleIndex];
+            audioFrame[sampleIndex * 2 + 1] = samples[sampleIndex];
+        }
+
+        audio_batch_cb(audioFrame.data(), samplesPerFrame);
+    }
 }
 
 bool retro_load_game(const struct retro_game_info* info)
 {
-    auto romFile = TryLoadINesFile(static_cast<const uint8_t*>(info->data), info->size);
+    // the frontend's buffer may have been patched or extracted from an archive, so it wins over the file on disk, which
+    // we only map if the frontend didn't load it.
+    std::unique_ptr<RomFile> romFile;
+    if (info->data)
+        romFile = TryLoadINesFile(static_cast<const uint8_t*>(info->data), info->size);
+    else if (info->path)
+        romFile = TryMapINesFile(info->path);
     if (!romFile)
         return false;
 
@@ -211,8 +336,9 @@ bool retro_load_game(const struct retro_game_info* info)
 
     auto cart = TryCreateCart(
         goodDescriptor ? *goodDescriptor : romFile->Descriptor,
-        std::move(romFile->PrgData),
-        std::move(romFile->ChrData));
+        romFile->PrgData,
+        romFile->ChrData,
+        romFile->Storage);
 
     if (!cart)
         return false;
@@ -220,7 +346,13 @@ bool retro_load_game(const struct retro_game_info* info)
     cart->Initialize();
 
     nesSystem->InsertCart(std::move(cart));
-    nesSystem->Reset();
+    nesSystem->PowerCycle();
+
+    if (!environ_cb(RETRO_ENVIRONMENT_GET_CAN_DUPE, &canDupe))
+        canDupe = false;
+    frontendHasLastFrame = false;
+
+    update_variables(false);
 
     auto fmt = retro_pixel_format::RETRO_PIXEL_FORMAT_XRGB8888;
     return environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &fmt);
@@ -243,17 +375,42 @@ bool retro_load_game_special(unsigned type, const struct retro_game_info* info,
 
 size_t retro_serialize_size(void)
 {
-    return false;
+    return SerializedStateSize(nesSystem->Apu().SamplesPerFrame());
 }
 
 bool retro_serialize(void* data_, size_t size)
 {
-    return false;
+    auto samplesPerFrame = nesSystem->Apu().SamplesPerFrame();
+    if (!nesSystem->HasCart() || size < SerializedStateSize(samplesPerFrame))
+        return false;
+
+    if (!serializedState)
+        serializedState = std::make_unique<SystemState>();
+
+    nesSystem->CaptureState(serializedState.get());
+    SerializeState(*serializedState, samplesPerFrame, static_cast<uint8_t*>(data_));
+    return true;
 }
 
 bool retro_unserialize(const void* data_, size_t size)
 {
-    return false;
+    if (!nesSystem->HasCart())
+        return false;
+
+    if (!serializedState)
+        serializedState = std::make_unique<SystemState>();
+
+    auto data = static_cast<const uint8_t*>(data_);
+    if (!TryDeserializeState(data, size, nesSystem->Apu().SamplesPerFrame(), serializedState.get()))
+        return false;
+
+    // the payload has the right layout, but it might have come from a different cart.
+    if (!nesSystem->TryRestoreState(*serializedState))
+        return false;
+
+    // the display's last frame no longer leads on to the next one.
+    frontendHasLastFrame = false;
+    return true;
 }
 
 void* retro_get_memory_data(unsigned id)
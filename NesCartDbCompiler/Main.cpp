@@ -1,10 +1,13 @@
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <string>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 
+#include "../NesCore/CartDataEntry.h"
 #include "CartRecord.h"
 #include "Main.h"
 
@@ -117,11 +120,14 @@ bool ParseMirrorFlag(const std::string& mirrorFlag, uint8_t& mode)
     return true;
 }
 
-std::vector<CartRecord> ReadCsvData()
+bool ReadCsvData(const std::string& path, std::vector<CartRecord>& carts)
 {
-    std::ifstream csvStream(L"CartData.csv");
-
-    std::vector<CartRecord> carts;
+    std::ifstream csvStream(path);
+    if (!csvStream)
+    {
+        std::cerr << "Could not open " << path << std::endl;
+        return false;
+    }
 
     while (csvStream.good())
     {
@@ -130,7 +136,7 @@ std::vector<CartRecord> ReadCsvData()
             continue;
 
         if (row.size() != 14)
-            return {};
+            return false;
 
         CartRecord record;
 
@@ -139,7 +145,7 @@ std::vector<CartRecord> ReadCsvData()
         record.ChrRom = std::stoi(row[2]) * 1024;
         record.MiscRom = std::stoi(row[3]);
         if (!ParseMapper(row[4], record.Mapper, record.SubMapper))
-            return {};
+            return false;
         record.MirrorFlag = row[5];
         record.Ppu = row[6];
         record.PrgRam = SizeToInt(row[7]);
@@ -153,138 +159,263 @@ std::vector<CartRecord> ReadCsvData()
         carts.emplace_back(std::move(record));
     }
 
-    return carts;
+    return true;
 }
 
-bool WriteBinaryData(const std::vector<CartRecord> & carts)
+bool EncodeCart(const CartRecord& cart, CartDataEntry& entry)
 {
-    std::ofstream binaryData(L"CartData.dat", std::ios::binary);
+    entry.Crc32 = cart.Crc32;
 
-    for (auto& cart : carts)
-    {
-        binaryData.write(reinterpret_cast<const char*>(&cart.Crc32), sizeof(uint32_t));
+    // we'll assume the Rom sizes were right, otherwise the iNes file was invalid
+
+    // we can probably cut this back to a few bits based on the mappers we support
+    auto mapper = cart.Mapper;
+    if (mapper == 555)
+        mapper = 255; // placeholder for unused mappers.  Will have to allocate later
+
+    if (mapper > 256)
+        return false;
+
+    entry.MapperByte = static_cast<uint8_t>(mapper);
 
-        // we'll assume the Rom sizes were right, otherwise the iNes file was invalid
+    // next byte:
+    // sssm mcbr
+    // |||| |||+ 8K PRG-RAM
+    // |||| ||+- 8K Battery backed PRG RAM
+    // |||| |+-- 8K CHR RAM
+    // |||+-+--- Mirror Mode
+    // +++------ Sub mapper / prg-ram size override
+    if (cart.SubMapper > 15)
+        return false;
+
+    if (cart.PrgRam != 0 && cart.PrgRam != 8 * 1024 && cart.Mapper != 555)
+        return false;
 
-        // we can probably cut this back to a few bits based on the mappers we support
-        auto mapper = cart.Mapper;
-        if (mapper == 555)
-            mapper = 255; // placeholder for unused mappers.  Will have to allocate later
+    auto subBits = cart.SubMapper;
 
-        if (mapper > 256)
+    auto expectedPrgRamSize = 8 * 1024;
+    if (cart.Mapper == 4 && cart.SubMapper == 1)
+    {
+        // For sub-mapper 1, we assume 1k of PRG-RAM B
+        if (cart.PrgRamB != 0 && cart.PrgRamB != 1 * 1024)
+            return false;
+    }
+    else if (cart.Mapper == 5)
+    {
+        if (cart.SubMapper != 0)
             return false;
 
-        auto mapperByte = static_cast<uint8_t>(mapper);
-        binaryData.write(reinterpret_cast<const char*>(&mapperByte), sizeof(uint8_t));
-
-        // next byte:
-        // sssm mcbr
-        // |||| |||+ 8K PRG-RAM
-        // |||| ||+- 8K Battery backed PRG RAM
-        // |||| |+-- 8K CHR RAM
-        // |||+-+--- Mirror Mode
-        // +++------ Sub mapper / prg-ram size override
-        if (cart.SubMapper > 15)
+        // we can repurpose the submapper bits to override the size
+        if (cart.PrgRamB == 0 || cart.PrgRamB == 8 * 1024)
+            subBits = 0;
+        else if (cart.PrgRamB == 1024)
+            subBits = 1;
+        else if (cart.PrgRamB == 32 * 1024)
+            subBits = 2;
+        else
             return false;
+    }
+    else if (cart.PrgRamB != 0 && cart.PrgRamB != 8 * 1024)
+        return false;
 
-        if (cart.PrgRam != 0 && cart.PrgRam != 8 * 1024 && cart.Mapper != 555)
+    if (cart.Mapper == 13)
+    {
+        if (cart.ChrRam != 16 * 1024)
+            return false;
+    }
+    else if (cart.Mapper == 168)
+    {
+        if (cart.ChrRam != 32 * 1024)
             return false;
+    }
+    else if (cart.ChrRam != 0 && cart.ChrRam != 8 * 1024)
+        return false;
+
+    if (cart.Mapper == 168)
+    {
+        if (cart.ChrRamB != 32 * 1024)
+            return false;
+    }
+    else if (cart.ChrRamB != 0)
+        return false;
 
-        auto subBits = cart.SubMapper;
+    uint8_t mirrorMode;
+    if (!ParseMirrorFlag(cart.MirrorFlag, mirrorMode))
+        return false;
+
+    uint8_t data = 0;
+    if (cart.PrgRam)
+        data |= 0x01;
+    if (cart.PrgRamB)
+        data |= 0x02;
+    if (cart.ChrRam)
+        data |= 0x04;
+    data |= mirrorMode << 3;
+    data |= subBits << 5;
 
-        auto expectedPrgRamSize = 8 * 1024;
-        if (cart.Mapper == 4 && cart.SubMapper == 1)
+    entry.ConfigByte = data;
+
+    return true;
+}
+
+bool EncodeCarts(const std::vector<CartRecord>& carts, std::vector<CartDataEntry>& entries)
+{
+    // the same ROM can appear in more than one region's database.  The first record wins, as it did when the database
+    // was scanned linearly.
+    std::unordered_map<uint32_t, size_t> entryIndices;
+
+    for (auto& cart : carts)
+    {
+        CartDataEntry entry;
+        if (!EncodeCart(cart, entry))
         {
-            // For sub-mapper 1, we assume 1k of PRG-RAM B
-            if (cart.PrgRamB != 0 && cart.PrgRamB != 1 * 1024)
-                return false;
+            std::cerr << "Could not encode " << cart.Name << std::endl;
+            return false;
         }
-        else if (cart.Mapper == 5)
+
+        auto [existing, inserted] = entryIndices.emplace(entry.Crc32, entries.size());
+        if (!inserted)
         {
-            if (cart.SubMapper != 0)
-                return false;
+            auto& existingEntry = entries[existing->second];
+            if (existingEntry.MapperByte != entry.MapperByte || existingEntry.ConfigByte != entry.ConfigByte)
+                std::cerr << "Ignoring conflicting duplicate " << cart.Name << std::endl;
 
-            // we can repurpose the submapper bits to override the size
-            if (cart.PrgRamB == 0 || cart.PrgRamB == 8 * 1024)
-                subBits = 0;
-            else if (cart.PrgRamB == 1024)
-                subBits = 1;
-            else if (cart.PrgRamB == 32 * 1024)
-                subBits = 2;
-            else
-                return false;
+            continue;
         }
-        else if (cart.PrgRamB != 0 && cart.PrgRamB != 8 * 1024)
-            return false;
 
-        if (cart.Mapper == 13)
-        {
-            if (cart.ChrRam != 16 * 1024)
-                return false;
-        }
-        else if (cart.Mapper == 168)
+        entries.push_back(entry);
+    }
+
+    return true;
+}
+
+// builds a minimal perfect hash table, using the "hash, displace and compress" approach - the buckets are placed
+// largest first, searching for a displacement which moves all of their keys into empty slots.
+bool BuildHashTable(
+    const std::vector<CartDataEntry>& entries,
+    std::vector<CartDataEntry>& table,
+    std::vector<int32_t>& displacements)
+{
+    auto size = static_cast<uint32_t>(entries.size());
+
+    std::vector<std::vector<uint32_t>> buckets(size);
+    for (auto& entry : entries)
+    {
+        buckets[CartDataHash(entry.Crc32, 0) % size].push_back(entry.Crc32);
+    }
+
+    std::vector<uint32_t> bucketOrder(size);
+    for (auto i = 0u; i < size; i++)
+        bucketOrder[i] = i;
+
+    std::stable_sort(bucketOrder.begin(), bucketOrder.end(), [&](uint32_t a, uint32_t b)
         {
-            if (cart.ChrRam != 32 * 1024)
-                return false;
-        }
-        else if (cart.ChrRam != 0 && cart.ChrRam != 8 * 1024)
-            return false;
+            return buckets[a].size() > buckets[b].size();
+        });
+
+    std::vector<bool> occupied(size);
+    std::vector<uint32_t> slotKeys(size);
+    displacements.assign(size, 0);
+
+    auto orderIndex = 0u;
+    for (; orderIndex < size && buckets[bucketOrder[orderIndex]].size() > 1; orderIndex++)
+    {
+        auto& bucket = buckets[bucketOrder[orderIndex]];
 
-        if (cart.Mapper == 168)
+        std::vector<uint32_t> slots;
+        for (auto displacement = 1; ; displacement++)
         {
-            if (cart.ChrRamB != 32 * 1024)
+            if (displacement == INT32_MAX)
                 return false;
+
+            slots.clear();
+            for (auto key : bucket)
+            {
+                auto slot = CartDataHash(key, displacement) % size;
+                if (occupied[slot] || std::find(slots.begin(), slots.end(), slot) != slots.end())
+                    break;
+
+                slots.push_back(slot);
+            }
+
+            if (slots.size() != bucket.size())
+                continue;
+
+            for (auto i = 0u; i < slots.size(); i++)
+            {
+                occupied[slots[i]] = true;
+                slotKeys[slots[i]] = bucket[i];
+            }
+
+            displacements[bucketOrder[orderIndex]] = displacement;
+            break;
         }
-        else if (cart.ChrRamB != 0)
-            return false;
+    }
 
-        uint8_t mirrorMode;
-        if (!ParseMirrorFlag(cart.MirrorFlag, mirrorMode))
-            return false;
+    // the remaining buckets have at most one key, so can go straight into the free slots.
+    auto freeSlot = 0u;
+    for (; orderIndex < size && buckets[bucketOrder[orderIndex]].size() == 1; orderIndex++)
+    {
+        while (occupied[freeSlot])
+            freeSlot++;
 
-        uint8_t data = 0;
-        if (cart.PrgRam)
-            data |= 0x01;
-        if (cart.PrgRamB)
-            data |= 0x02;
-        if (cart.ChrRam)
-            data |= 0x04;
-        data |= mirrorMode << 3;
-        data |= subBits << 5;
-
-        binaryData.write(reinterpret_cast<const char*>(&data), sizeof(uint8_t));
+        occupied[freeSlot] = true;
+        slotKeys[freeSlot] = buckets[bucketOrder[orderIndex]][0];
+        displacements[bucketOrder[orderIndex]] = -static_cast<int32_t>(freeSlot) - 1;
     }
 
+    std::unordered_map<uint32_t, const CartDataEntry*> entriesByKey;
+    for (auto& entry : entries)
+        entriesByKey.emplace(entry.Crc32, &entry);
+
+    table.resize(size);
+    for (auto slot = 0u; slot < size; slot++)
+        table[slot] = *entriesByKey[slotKeys[slot]];
+
     return true;
 }
 
-void WriteHeader()
+void WriteHeader(const std::vector<CartDataEntry>& table, const std::vector<int32_t>& displacements)
 {
-    std::ofstream headerStream(L"CartData.h", std::ios::binary);
-    std::ifstream dataStream(L"CartData.dat", std::ios::binary);
+    std::ofstream headerStream("CartData.h", std::ios::binary);
 
+    headerStream << "#pragma once" << std::endl;
+    headerStream << std::endl;
+    headerStream << "// generated by NesCartDbCompiler - do not edit." << std::endl;
+    headerStream << std::endl;
+    headerStream << "#include \"CartDataEntry.h\"" << std::endl;
+    headerStream << std::endl;
     headerStream << "#include <cstdint>" << std::endl;
     headerStream << std::endl;
-    headerStream << "const uint8_t CartData[] = " << std::endl;
-    headerStream << "{" << std::endl;
+    headerStream << "constexpr uint32_t CartDataSize = " << table.size() << ";" << std::endl;
+    headerStream << std::endl;
 
-    headerStream << std::hex;
+    headerStream << "constexpr int32_t CartDataDisplacements[] =" << std::endl;
+    headerStream << "{" << std::endl;
 
-    while (dataStream.good() && dataStream.peek() >= 0)
+    for (auto i = 0u; i < displacements.size(); i += 8)
     {
-        headerStream << "    ";
-        for (auto i = 0; i < 6; i++)
-        {
-            auto byte = dataStream.get();
-            headerStream << "0x" << std::setfill('0') << std::setw(2) << byte;
+        headerStream << "   ";
+        for (auto j = i; j < i + 8 && j < displacements.size(); j++)
+            headerStream << " " << displacements[j] << ",";
 
-            if (dataStream.peek() < 0)
-                break;
+        headerStream << std::endl;
+    }
 
-            headerStream << ", ";
-        }
+    headerStream << "};" << std::endl;
+    headerStream << std::endl;
 
-        headerStream << std::endl;
+    headerStream << "constexpr CartDataEntry CartData[] =" << std::endl;
+    headerStream << "{" << std::endl;
+
+    headerStream << std::hex << std::setfill('0');
+    for (auto& entry : table)
+    {
+        headerStream
+            << "    { 0x" << std::setw(8) << entry.Crc32
+            << ", 0x" << std::setw(2) << static_cast<uint32_t>(entry.MapperByte)
+            << ", 0x" << std::setw(2) << static_cast<uint32_t>(entry.ConfigByte)
+            << " }," << std::endl;
     }
 
     headerStream << "};" << std::endl;
@@ -292,14 +423,34 @@ void WriteHeader()
 
 int main(int argc, char* argv[])
 {
-    auto carts = ReadCsvData();
+    // each region's database can be passed separately, and they are merged in order.
+    std::vector<std::string> paths;
+    for (auto i = 1; i < argc; i++)
+        paths.push_back(argv[i]);
+
+    if (paths.empty())
+        paths.push_back("CartData.csv");
+
+    std::vector<CartRecord> carts;
+    for (auto& path : paths)
+    {
+        if (!ReadCsvData(path, carts))
+            return -1;
+    }
+
     if (!carts.size())
         return -1;
 
-    if (!WriteBinaryData(carts))
+    std::vector<CartDataEntry> entries;
+    if (!EncodeCarts(carts, entries))
+        return -1;
+
+    std::vector<CartDataEntry> table;
+    std::vector<int32_t> displacements;
+    if (!BuildHashTable(entries, table, displacements))
         return -1;
 
-    WriteHeader();
+    WriteHeader(table, displacements);
 
     return 0;
 }
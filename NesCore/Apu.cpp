@@ -1,6 +1,7 @@
 #include "Apu.h"
 #include "Bus.h"
 
+#include <algorithm>
 #include <cassert>
 
 
@@ -14,12 +15,7 @@ Apu::Apu(Bus& bus, uint32_t samplesPerFrame) :
     pulse2_{ false },
     dmc_{*this}
 {
-    // account for the fact we start off after VBlank
-    state_.CurrentSample = (21 * samplesPerFrame) / 261;
-    state_.SampleCycle = GetSampleCycle(state_.CurrentSample + 1);
-    auto currentCycle = (21 * 341 / 3);
-    bus_.Schedule(state_.SampleCycle - currentCycle, SyncEvent::ApuSample);
-    bus_.Schedule(7457, SyncEvent::ApuFrameCounter);
+    ScheduleEvents();
 
     auto bufferSize = samplesPerFrame * 3ULL / 2;
 
@@ -27,6 +23,28 @@ Apu::Apu(Bus& bus, uint32_t samplesPerFrame) :
     memset(sampleBuffer_.get(), 0, bufferSize * sizeof(int16_t));
 }
 
+void Apu::PowerOn()
+{
+    frameCounter_.RestoreState({});
+    pulse1_.RestoreState({});
+    pulse2_.RestoreState({});
+    triangle_.RestoreState({});
+    noise_.RestoreState({});
+    dmc_.RestoreState({});
+
+    state_ = {};
+
+    ScheduleEvents();
+
+    std::fill(&backBuffer_[0], &backBuffer_[0] + samplesPerFrame_, static_cast<int16_t>(0));
+    std::fill(&sampleBuffer_[0], &sampleBuffer_[0] + samplesPerFrame_, static_cast<int16_t>(0));
+}
+
+void Apu::Reset()
+{
+    Write(0x4015, 0);
+}
+
 void Apu::SetSamplesPerFrame(uint32_t samplesPerFrame)
 {
     samplesPerFrame_ = samplesPerFrame;
@@ -297,6 +315,16 @@ void Apu::Sample()
     }
 }
 
+void Apu::ScheduleEvents()
+{
+    // account for the fact we start off after VBlank
+    state_.CurrentSample = (21 * samplesPerFrame_) / 261;
+    state_.SampleCycle = GetSampleCycle(state_.CurrentSample + 1);
+    auto currentCycle = (21 * 341 / 3);
+    bus_.Schedule(state_.SampleCycle - currentCycle, SyncEvent::ApuSample);
+    bus_.Schedule(7457, SyncEvent::ApuFrameCounter);
+}
+
 uint32_t Apu::GetSampleCycle(uint32_t sample) const
 {
     return (29781 * sample / samplesPerFrame_);
@@ -18,6 +18,11 @@ class Apu
 public:
     Apu(Bus& bus, uint32_t samplesPerFrame);
 
+    // puts the APU back into its constructed state, without reallocating the sample buffers.
+    void PowerOn();
+    // the reset line silences all the channels.
+    void Reset();
+
     void SetSamplesPerFrame(uint32_t samplesPerFrame);
 
     void QuarterFrame();
@@ -52,6 +57,7 @@ public:
     void RestoreState(const ApuState& state);
 
 private:
+    void ScheduleEvents();
     uint32_t GetSampleCycle(uint32_t sample) const;
 
     Bus& bus_;
@@ -12,4 +12,6 @@ struct ApuCoreState
 
     bool DmcInterrupt{};
     bool FrameCounterInterrupt{};
+
+    uint8_t Padding[2]{};
 };
\ No newline at end of file
@@ -4,14 +4,17 @@
 
 struct ApuDmcState
 {
-    bool irqEnabled_{};
-    bool loop_{};
     uint32_t rate_{ 428 };
-    uint8_t level_{};
+    int32_t timer_{ 428 };
+
     uint16_t sampleAddress_{ 0xC000 };
     uint16_t sampleLength_{ 1 };
+    uint16_t currentAddress_{ 0xC000 };
+    uint16_t sampleBytesRemaining_{};
 
-    int32_t timer_{ 428 };
+    bool irqEnabled_{};
+    bool loop_{};
+    uint8_t level_{};
 
     uint8_t outBuffer_{};
     bool outBufferHasData_{};
@@ -21,6 +24,5 @@ struct ApuDmcState
     bool sampleBufferHasData_{};
     bool byteRequested_{};
 
-    uint16_t currentAddress_{ 0xC000 };
-    uint16_t sampleBytesRemaining_{};
+    uint8_t padding_[3]{};
 };
\ No newline at end of file
@@ -4,10 +4,10 @@
 
 struct ApuNoiseCoreState
 {
-    uint_fast16_t ModeShift{1};
-    uint_fast16_t Period{};
+    uint32_t ModeShift{1};
+    uint32_t Period{};
     uint32_t Period2{2};
 
     int32_t Timer{};
-    uint_fast16_t Shifter{1};
+    uint32_t Shifter{1};
 };
\ No newline at end of file
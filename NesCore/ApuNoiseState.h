@@ -6,8 +6,10 @@
 
 struct ApuNoiseState
 {
+    ApuNoiseCoreState Core;
+
     ApuEnvelopeState Envelope;
     ApuLengthCounterState LengthCounter;
 
-    ApuNoiseCoreState Core;
+    uint8_t Padding[3]{};
 };
\ No newline at end of file
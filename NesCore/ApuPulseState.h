@@ -7,9 +7,11 @@
 
 struct ApuPulseState
 {
+    ApuPulseCoreState Core;
+
+    ApuSweepState Sweep;
     ApuEnvelopeState Envelope;
     ApuLengthCounterState LengthCounter;
-    ApuSweepState Sweep;
 
-    ApuPulseCoreState Core;
+    uint8_t Padding[3]{};
 };
\ No newline at end of file
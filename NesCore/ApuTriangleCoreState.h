@@ -11,8 +11,9 @@ struct ApuTriangleCoreState
     int WaveformCycle{};
 
     uint32_t LinearCounter{};
-    bool LinearCounterReload{};
     uint32_t LinearCounterReloadValue{};
+    bool LinearCounterReload{};
     bool Control{};
 
+    uint8_t Padding[2]{};
 };
\ No newline at end of file
@@ -5,7 +5,8 @@
 
 struct ApuTriangleState
 {
+    ApuTriangleCoreState Core;
     ApuLengthCounterState LengthCounter;
 
-    ApuTriangleCoreState Core;
+    uint8_t Padding{};
 };
\ No newline at end of file
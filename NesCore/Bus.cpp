@@ -5,14 +5,27 @@
 #include "Cpu.h"
 #include "Ppu.h"
 
+#include <algorithm>
+
 Bus::Bus() :
     cpu_(nullptr),
     ppu_(nullptr),
     apu_(nullptr),
     controller1_(nullptr),
     controller2_(nullptr),
-    cart_(nullptr)
+    cart_(nullptr),
+    cartFetchMode_(PpuFetchMode::Banked)
+{
+    cpuRam_.fill(0xff);
+    cpuRamPages_.Attach(cpuRam_.data(), static_cast<uint32_t>(cpuRam_.size()));
+}
+
+void Bus::PowerOn()
 {
+    state_ = BusCoreState{};
+
+    cpuRam_.fill(0xff);
+    cpuRamPages_.MarkAll();
 }
 
 void Bus::Attach(Cpu* cpu)
@@ -46,6 +59,8 @@ void Bus::Attach(Cart* cart)
     if (cart_)
     {
         cart_->Attach(this);
+        cartFetchMode_ = cart_->FetchMode();
+        ppu_->AttachCartBanks(&cart_->PpuBanks());
 
         if (cart_->UsesMMC5Audio())
             apu_->EnableMMC5(true);
@@ -63,6 +78,8 @@ void Bus::DetachCart()
         apu_->EnableMMC5(false);
 
     cart_ = nullptr;
+    cartFetchMode_ = PpuFetchMode::Banked;
+    ppu_->AttachCartBanks(nullptr);
 }
 
 bool Bus::HasCart() const
@@ -70,6 +87,11 @@ bool Bus::HasCart() const
     return !!cart_;
 }
 
+const std::array<uint8_t, 2048>& Bus::CpuRam() const
+{
+    return cpuRam_;
+}
+
 void Bus::TickCpuRead()
 {
     if (state_.Dma)
@@ -181,7 +203,7 @@ uint8_t Bus::CpuReadData(uint16_t address)
 uint8_t Bus::CpuReadZeroPage(uint16_t address)
 {
     TickCpuRead();
-    return state_.CpuRam[address];
+    return cpuRam_[address];
 }
 
 uint8_t Bus::CpuReadProgramData(uint16_t address)
@@ -207,7 +229,10 @@ void Bus::CpuWrite(uint16_t address, uint8_t value)
     TickCpuWrite();
 
     if (address < 0x2000)
-        state_.CpuRam[address & 0x7ff] = value;
+    {
+        cpuRam_[address & 0x7ff] = value;
+        cpuRamPages_.Mark(address & 0x7ff);
+    }
     else if (address < 0x4000)
         ppu_->Write(address, value);
     else if (address < 0x4020)
@@ -232,7 +257,8 @@ void Bus::CpuWriteZeroPage(uint16_t address, uint8_t value)
 {
     TickCpuWrite();
 
-    state_.CpuRam[address] = value;
+    cpuRam_[address] = value;
+    cpuRamPages_.Mark(address);
 }
 
 void Bus::CpuWrite2(uint16_t address, uint8_t firstValue, uint8_t secondValue)
@@ -242,7 +268,8 @@ void Bus::CpuWrite2(uint16_t address, uint8_t firstValue, uint8_t secondValue)
     if (address < 0x2000)
     {
         Tick();
-        state_.CpuRam[address & 0x7ff] = secondValue;
+        cpuRam_[address & 0x7ff] = secondValue;
+        cpuRamPages_.Mark(address & 0x7ff);
     }
     else if (address < 0x4000)
     {
@@ -288,40 +315,9 @@ uint8_t Bus::PpuRead(uint16_t address) const
     return cart_->PpuReadData(address);
 }
 
-uint8_t Bus::PpuReadNametable(uint16_t address) const
-{
-    return cart_->PpuReadNametable(address);
-}
-
-uint8_t Bus::PpuReadAttributes(uint16_t address) const
-{
-    return cart_->PpuReadAttributes(address);
-}
-
-uint8_t Bus::PpuReadPatternLow(uint16_t address) const
+PpuFetchMode Bus::CartFetchMode() const
 {
-    return cart_->PpuReadPatternLow(address);
-}
-
-uint8_t Bus::PpuReadPatternHigh(uint16_t address) const
-{
-    return cart_->PpuReadPatternHigh(address);
-}
-
-uint8_t Bus::PpuReadSpritePatternLow(uint16_t address) const
-{
-    return cart_->PpuReadSpritePatternLow(address);
-}
-
-uint8_t Bus::PpuReadSpritePatternHigh(uint16_t address) const
-{
-    return cart_->PpuReadSpritePatternHigh(address);
-}
-
-
-uint16_t Bus::PpuReadPattern16(uint16_t address) const
-{
-    return cart_->PpuReadPattern16(address);
+    return cartFetchMode_;
 }
 
 void Bus::PpuWrite(uint16_t address, uint8_t value)
@@ -450,12 +446,14 @@ bool Bus::DescheduleAll(SyncEvent evt)
 
 void Bus::CaptureState(BusState* state) const
 {
-    *state = state_;
+    state->Core = state_;
+    cpuRamPages_.Capture(&state->CpuRam);
 }
 
 void Bus::RestoreState(const BusState& state)
 {
-    state_ = state;
+    state_ = state.Core;
+    cpuRamPages_.Restore(state.CpuRam);
 }
 
 #ifdef DIAGNOSTIC
@@ -487,7 +485,7 @@ void Bus::Tick()
 uint8_t Bus::CpuReadImpl(uint16_t address)
 {
     if (address < 0x2000)
-        return state_.CpuRam[address & 0x7ff];
+        return cpuRam_[address & 0x7ff];
     else if (address < 0x4020)
     {
         if (address < 0x4000)
@@ -508,7 +506,7 @@ uint8_t Bus::CpuReadImpl(uint16_t address)
 uint8_t Bus::CpuReadProgramDataRare(uint16_t address)
 {
     if (address < 0x2000)
-        return state_.CpuRam[address & 0x7ff];
+        return cpuRam_[address & 0x7ff];
     else if (address < 0x4000)
         return ppu_->Read(address);
     else if (address < 0x4020)
@@ -639,6 +637,23 @@ void Bus::RunOamDma()
         // it takes two cycles for the dmc to kick in
         dmcStarted = state_.DmcDma;
 
+        if (!dmcStarted && address < 0x2000)
+        {
+            // copying from RAM has no side effects, so we can copy everything up to the next event in one go.  Each
+            // byte takes two cycles, and the event runs in the tick it falls in.
+            auto eventCycles = static_cast<int32_t>(state_.SyncQueue.GetNextEventTime() - state_.PpuCycleCount);
+            auto count = std::min<uint32_t>((eventCycles - 1) / 6, endAddress - address);
+            if (count > 0)
+            {
+                ppu_->DmaWrite(&cpuRam_[address & 0x7ff], count);
+                address += count;
+
+                state_.PpuCycleCount += count * 6;
+                state_.CpuCycleCount += count * 2;
+                continue;
+            }
+        }
+
         auto value = OamDmaRead(address++);
         OamDmaWrite(value);
     }
@@ -7,17 +7,22 @@
 #include "BusState.h"
 #include "Cart.h"
 #include "ChrA12Sensitivity.h"
+#include "DirtyPages.h"
 #include "Controller.h"
 #include "Cpu.h"
 #include "Ppu.h"
 #include "Apu.h"
 #include "EventQueue.h"
+#include "PpuFetchMode.h"
 
 class Bus
 {
 public:
     Bus();
 
+    // clears the bus state and the CPU RAM back to how they were constructed.
+    void PowerOn();
+
     void Attach(Cpu* cpu);
     void Attach(Ppu* ppu);
     void Attach(Apu* apu);
@@ -29,6 +34,8 @@ public:
 
     bool HasCart() const;
 
+    const std::array<uint8_t, 2048>& CpuRam() const;
+
     __forceinline void TickCpuRead();
     __forceinline void TickCpuWrite();
 
@@ -62,13 +69,13 @@ public:
 
     uint8_t* GetPpuRamBase();
     uint8_t PpuRead(uint16_t address) const;
-    uint8_t PpuReadNametable(uint16_t address) const;
-    uint8_t PpuReadAttributes(uint16_t address) const;
-    uint8_t PpuReadPatternLow(uint16_t address) const;
-    uint8_t PpuReadPatternHigh(uint16_t address) const;
-    uint8_t PpuReadSpritePatternLow(uint16_t address) const;
-    uint8_t PpuReadSpritePatternHigh(uint16_t address) const;
-    uint16_t PpuReadPattern16(uint16_t address) const;
+    PpuFetchMode CartFetchMode() const;
+    template <PpuFetchMode TMode> uint8_t PpuReadNametable(uint16_t address) const;
+    template <PpuFetchMode TMode> uint8_t PpuReadAttributes(uint16_t address) const;
+    template <PpuFetchMode TMode> uint8_t PpuReadPatternLow(uint16_t address) const;
+    template <PpuFetchMode TMode> uint8_t PpuReadPatternHigh(uint16_t address) const;
+    template <PpuFetchMode TMode> uint8_t PpuReadSpritePatternHigh(uint16_t address) const;
+    template <PpuFetchMode TMode> uint16_t PpuReadPattern16(uint16_t address) const;
     void PpuWrite(uint16_t address, uint8_t value);
 
     void InterceptPpuCtrl(bool largeSprites);
@@ -124,6 +131,46 @@ private:
     Controller* controller1_;
     Controller* controller2_;
     Cart* cart_;
+    PpuFetchMode cartFetchMode_;
+
+    BusCoreState state_;
+
+    std::array<uint8_t, 2048> cpuRam_;
+    DirtyPages cpuRamPages_;
+};
+
+template <PpuFetchMode TMode>
+__forceinline uint8_t Bus::PpuReadNametable(uint16_t address) const
+{
+    return cart_->PpuReadNametable<TMode>(address);
+}
+
+template <PpuFetchMode TMode>
+__forceinline uint8_t Bus::PpuReadAttributes(uint16_t address) const
+{
+    return cart_->PpuReadAttributes<TMode>(address);
+}
 
-    BusState state_;
-};
\ No newline at end of file
+template <PpuFetchMode TMode>
+__forceinline uint8_t Bus::PpuReadPatternLow(uint16_t address) const
+{
+    return cart_->PpuReadPatternLow<TMode>(address);
+}
+
+template <PpuFetchMode TMode>
+__forceinline uint8_t Bus::PpuReadPatternHigh(uint16_t address) const
+{
+    return cart_->PpuReadPatternHigh<TMode>(address);
+}
+
+template <PpuFetchMode TMode>
+__forceinline uint8_t Bus::PpuReadSpritePatternHigh(uint16_t address) const
+{
+    return cart_->PpuReadSpritePatternHigh<TMode>(address);
+}
+
+template <PpuFetchMode TMode>
+__forceinline uint16_t Bus::PpuReadPattern16(uint16_t address) const
+{
+    return cart_->PpuReadPattern16<TMode>(address);
+}
@@ -1,6 +1,6 @@
-#include "BusState.h"
+#include "BusCoreState.h"
 
-BusState::BusState() :
+BusCoreState::BusCoreState() :
     CpuCycleCount{ 0 },
     PpuCycleCount{ 0 },
     Dma{},
@@ -9,8 +9,8 @@ BusState::BusState() :
     DmcDmaAddress{},
     OamDmaAddress{},
     AudioIrq{ false },
-    CartIrq{ false }
+    CartIrq{ false },
+    Padding{}
 {
-    CpuRam.fill(0xff);
     PpuRam.fill(0xff);
 }
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "EventQueue.h"
+
+struct BusCoreState
+{
+    BusCoreState();
+
+    std::array<uint8_t, 2048> PpuRam;
+
+    uint32_t CpuCycleCount;
+    uint32_t PpuCycleCount;
+
+    EventQueue SyncQueue;
+
+    uint16_t OamDmaAddress;
+    uint16_t DmcDmaAddress;
+
+    bool Dma;
+    bool OamDma;
+    bool DmcDma;
+
+    bool AudioIrq;
+    bool CartIrq;
+
+    uint8_t Padding[3];
+};
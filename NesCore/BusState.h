@@ -1,29 +1,10 @@
 #pragma once
 
-#include <array>
-#include <cstdint>
-
-#include "EventQueue.h"
+#include "BusCoreState.h"
+#include "DirtyPages.h"
 
 struct BusState
 {
-    BusState();
-
-    std::array<uint8_t, 2048> CpuRam;
-    std::array<uint8_t, 2048> PpuRam;
-
-    uint32_t CpuCycleCount;
-    uint32_t PpuCycleCount;
-
-    bool Dma;
-    bool OamDma;
-    bool DmcDma;
-
-    uint16_t OamDmaAddress;
-    uint16_t DmcDmaAddress;
-
-    bool AudioIrq;
-    bool CartIrq;
-
-    EventQueue SyncQueue;
-};
\ No newline at end of file
+    BusCoreState Core;
+    PageState<2048> CpuRam;
+};
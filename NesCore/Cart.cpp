@@ -1,10 +1,24 @@
 #include "Cart.h"
 
 #include "Bus.h"
+#include "GameDatabase.h"
 
+#include <algorithm>
 #include <assert.h>
 #include <memory>
 
+// the bank offsets in a captured state hold the memory region in the top byte, and the offset within the region in the
+// rest.  Zero is a null pointer.
+namespace
+{
+    const uint32_t PrgRomRegion{ 1 };
+    const uint32_t ChrRegion{ 2 };
+    const uint32_t PpuRamRegion{ 3 };
+    const uint32_t ExtendedRamRegion{ 4 };
+    const uint32_t PrgRamRegion{ 5 };
+    const uint32_t RegionShift{ 24 };
+}
+
 Cart::Cart() :
     chrRamStart_{ -1 },
     chrRamMask_{},
@@ -25,6 +39,9 @@ Cart::Cart() :
     state_.PpuBankWritable[13] = true;
     state_.PpuBankWritable[14] = true;
     state_.PpuBankWritable[15] = true;
+
+    // $6000-$7fff is RAM unless the mapper banks ROM into it.
+    state_.CpuBankWritable[3] = true;
 }
 
 void Cart::SetMapper(MapperType mapper)
@@ -32,16 +49,16 @@ void Cart::SetMapper(MapperType mapper)
     mapper_ = mapper;
 }
 
-void Cart::SetPrgRom(std::vector<uint8_t> prgData)
+void Cart::SetRomStorage(std::shared_ptr<void> storage)
+{
+    romStorage_ = std::move(storage);
+}
+
+void Cart::SetPrgRom(std::span<const uint8_t> prgData)
 {
-    prgData_ = std::move(prgData);
+    prgData_ = prgData;
 
     auto size = prgData_.size();
-    auto sizeBitRemoved = prgData.size() & (prgData.size() - 1);
-    if (sizeBitRemoved != 0)
-    {
-        size = sizeBitRemoved << 1;
-    }
 
     prgMask_ = static_cast<uint32_t>(size) - 1;
     prgBlockSize_ = static_cast<uint32_t>(size);
@@ -52,7 +69,7 @@ void Cart::SetPrgRam(uint32_t size)
     prgRamMask_ = size - 1;
     localPrgRam_.resize(size);
     prgRamBanks_.push_back(&localPrgRam_[0]);
-    state_.CpuBanks[3] = prgRamBanks_[0];
+    cpuBanks_[3] = prgRamBanks_[0];
 }
 
 void Cart::AddPrgBatteryRam()
@@ -69,18 +86,18 @@ void Cart::SetPrgBatteryRam(uint8_t* data)
     prgRamBanks_[0] = data;
 }
 
-void Cart::SetChrRom(std::vector<uint8_t> chrData)
+void Cart::SetChrRom(std::span<const uint8_t> chrData)
 {
-    chrData_ = std::move(chrData);
+    chrData_ = chrData;
 
-    state_.PpuBanks[0] = &chrData_[0];
-    state_.PpuBanks[1] = &chrData_[0x0400];
-    state_.PpuBanks[2] = &chrData_[0x0800];
-    state_.PpuBanks[3] = &chrData_[0x0c00];
-    state_.PpuBanks[4] = &chrData_[0x1000];
-    state_.PpuBanks[5] = &chrData_[0x1400];
-    state_.PpuBanks[6] = &chrData_[0x1800];
-    state_.PpuBanks[7] = &chrData_[0x1c00];
+    ppuBanks_[0] = &chrData_[0];
+    ppuBanks_[1] = &chrData_[0x0400];
+    ppuBanks_[2] = &chrData_[0x0800];
+    ppuBanks_[3] = &chrData_[0x0c00];
+    ppuBanks_[4] = &chrData_[0x1000];
+    ppuBanks_[5] = &chrData_[0x1400];
+    ppuBanks_[6] = &chrData_[0x1800];
+    ppuBanks_[7] = &chrData_[0x1c00];
 
     assert((chrData_.size() & (chrData_.size() - 1)) == 0);
     chrBlockSize_ = static_cast<uint32_t>(chrData_.size());
@@ -96,19 +113,23 @@ void Cart::AddChrRam(uint32_t size)
     chrRamMask_ = size - 1;
 
     size += static_cast<uint32_t>(chrData_.size());
-    chrData_.resize(size);
+
+    // the RAM has to follow the ROM, so we need our own copy of the ROM rather than writing into the shared storage.
+    localChrData_.assign(chrData_.begin(), chrData_.end());
+    localChrData_.resize(size);
+    chrData_ = localChrData_;
+
+    ppuBanks_[0] = &chrData_[0];
+    ppuBanks_[1] = &chrData_[0x0400];
+    ppuBanks_[2] = &chrData_[0x0800];
+    ppuBanks_[3] = &chrData_[0x0c00];
+    ppuBanks_[4] = &chrData_[0x1000];
+    ppuBanks_[5] = &chrData_[0x1400];
+    ppuBanks_[6] = &chrData_[0x1800];
+    ppuBanks_[7] = &chrData_[0x1c00];
 
     if (chrRamStart_ == 0)
     {
-        state_.PpuBanks[0] = &chrData_[0];
-        state_.PpuBanks[1] = &chrData_[0x0400];
-        state_.PpuBanks[2] = &chrData_[0x0800];
-        state_.PpuBanks[3] = &chrData_[0x0c00];
-        state_.PpuBanks[4] = &chrData_[0x1000];
-        state_.PpuBanks[5] = &chrData_[0x1400];
-        state_.PpuBanks[6] = &chrData_[0x1800];
-        state_.PpuBanks[7] = &chrData_[0x1c00];
-
         state_.PpuBankWritable[0] = true;
         state_.PpuBankWritable[1] = true;
         state_.PpuBankWritable[2] = true;
@@ -148,52 +169,61 @@ void Cart::Initialize()
             prgRamBanks_[0] = &localBatteryRam_[0];
         }
 
-        if (mapper_ != MapperType::MMC6) // mapping done manually due to complex protection system
-            state_.CpuBanks[3] = prgRamBanks_[0];
+        if (!IsMapper(MapperType::MMC6)) // mapping done manually due to complex protection system
+            cpuBanks_[3] = prgRamBanks_[0];
     }
 
+    assert(prgRamBanks_.size() <= 2);
+    for (auto i = 0u; i < prgRamBanks_.size(); i++)
+        prgRamPages_[i].Attach(prgRamBanks_[i], prgRamMask_ + 1);
+
+    if (chrRamStart_ >= 0)
+        chrRamPages_.Attach(&localChrData_[chrRamStart_], static_cast<uint32_t>(localChrData_.size() - chrRamStart_));
+
+    extendedRamPages_.Attach(extendedRam_.data(), static_cast<uint32_t>(extendedRam_.size()));
+
     // first and last bank mapped by default.
-    state_.CpuBanks[4] = &prgData_[0];
-    state_.CpuBanks[5] = &prgData_[0x2000];
-    state_.CpuBanks[6] = &prgData_[prgData_.size() - 0x4000];
-    state_.CpuBanks[7] = &prgData_[prgData_.size() - 0x2000];
+    cpuBanks_[4] = &prgData_[0];
+    cpuBanks_[5] = &prgData_[0x2000];
+    cpuBanks_[6] = &prgData_[prgData_.size() - 0x4000];
+    cpuBanks_[7] = &prgData_[prgData_.size() - 0x2000];
 
     // initial state for mapper 5
     state_.PrgBank3 = prgMask_ & 0x01fe000;
 
-    if (mapper_ == MapperType::MMC1)
+    if (IsMapper(MapperType::MMC1))
         state_.PrgMode = 3;
-    else if (mapper_ == MapperType::MMC5)
+    else if (IsMapper(MapperType::MMC5))
     {
         state_.PrgMode = 3;
         state_.PrgRamProtect0 = 3; // two protect flags
     }
-    else if (mapper_ == MapperType::MMC3 || mapper_ == MapperType::MMC6 || mapper_ == MapperType::TxSROM
-        || mapper_ == MapperType::TQROM)
+    else if (IsMapper(MapperType::MMC3) || IsMapper(MapperType::MMC6) || IsMapper(MapperType::TxSROM)
+        || IsMapper(MapperType::TQROM))
     {
         // RAMBO-1 extends MMC3 to support a third PRG register - we fix this for the other variants.
         state_.PrgBank2 = prgBlockSize_ - 0x4000;
     }
-    else if (mapper_ == MapperType::MCACC)
+    else if (IsMapper(MapperType::MCACC))
     {
         state_.PrgBank2 = prgBlockSize_ - 0x4000;
         state_.ChrA12PulseCounter = 1;
     }
-    else if (mapper_ == MapperType::QJ)
+    else if (IsMapper(MapperType::QJ))
     {
         state_.PrgBank2 = prgBlockSize_ - 0x4000;
         prgBlockSize_ = 0x20000;
         chrBlockSize_ = 0x20000;
         UpdatePrgMapMMC3();
     }
-    else if (mapper_ == MapperType::AxROM || mapper_ == MapperType::ColorDreams || mapper_ == MapperType::Caltron6in1 || mapper_ == MapperType::NesEvent)
+    else if (IsMapper(MapperType::AxROM) || IsMapper(MapperType::ColorDreams) || IsMapper(MapperType::Caltron6in1) || IsMapper(MapperType::NesEvent))
     {
-        state_.CpuBanks[4] = &prgData_[0];
-        state_.CpuBanks[5] = &prgData_[0x2000];
-        state_.CpuBanks[6] = &prgData_[0x4000];
-        state_.CpuBanks[7] = &prgData_[0x6000];
+        cpuBanks_[4] = &prgData_[0];
+        cpuBanks_[5] = &prgData_[0x2000];
+        cpuBanks_[6] = &prgData_[0x4000];
+        cpuBanks_[7] = &prgData_[0x6000];
 
-        if (mapper_ == MapperType::NesEvent)
+        if (IsMapper(MapperType::NesEvent))
         {
             state_.PrgMode = 3;
             state_.InitializationState = 2;
@@ -202,39 +232,69 @@ void Cart::Initialize()
             state_.PrgPlane0 = 0x00020000;
         }
     }
-    else if (mapper_ == MapperType::MMC2)
+    else if (IsMapper(MapperType::MMC2))
     {
-        state_.CpuBanks[4] = &prgData_[0];
-        state_.CpuBanks[5] = &prgData_[prgData_.size() - 0x6000];
-        state_.CpuBanks[6] = &prgData_[prgData_.size() - 0x4000];
-        state_.CpuBanks[7] = &prgData_[prgData_.size() - 0x2000];
+        cpuBanks_[4] = &prgData_[0];
+        cpuBanks_[5] = &prgData_[prgData_.size() - 0x6000];
+        cpuBanks_[6] = &prgData_[prgData_.size() - 0x4000];
+        cpuBanks_[7] = &prgData_[prgData_.size() - 0x2000];
     }
-    else if (mapper_ == MapperType::Rambo1 || mapper_ == MapperType::Tengen800037)
+    else if (IsMapper(MapperType::Rambo1) || IsMapper(MapperType::Tengen800037))
     {
         // we always care about A12, since we need to know the last time it dropped, in order to correctly set the reset flag when we switch on interrupts.
         // TODO: we could do this without scheduling all A12 events.
         state_.ChrA12Sensitivity = ChrA12Sensitivity::RisingEdgeSmoothed;
     }
-    else if (mapper_ == MapperType::ColorDreams || mapper_ == MapperType::GxROM)
+    else if (IsMapper(MapperType::ColorDreams) || IsMapper(MapperType::GxROM))
     {
         state_.PrgBank0 = 3;
         state_.ChrBank0 = 3;
         UpdatePrgMap32k();
     }
-    else if (mapper_ == MapperType::SunsoftFME7)
+    else if (IsMapper(MapperType::SunsoftFME7))
     {
-        state_.CpuBanks[4] = &prgData_[0];
-        state_.CpuBanks[5] = &prgData_[0];
-        state_.CpuBanks[6] = &prgData_[0];
+        cpuBanks_[4] = &prgData_[0];
+        cpuBanks_[5] = &prgData_[0];
+        cpuBanks_[6] = &prgData_[0];
     }
-    else if (mapper_ == MapperType::ActiveEnterprises)
+    else if (IsMapper(MapperType::ActiveEnterprises))
     {
         UpdatePrgMapActiveEnterprises();
     }
-    else if (mapper_ == MapperType::Quattro || mapper_ == MapperType::Aladdin)
+    else if (IsMapper(MapperType::Quattro) || IsMapper(MapperType::Aladdin))
     {
         UpdatePrgMapQuattro();
     }
+
+    initialState_ = state_;
+    initialCpuBanks_ = cpuBanks_;
+    initialPpuBanks_ = ppuBanks_;
+}
+
+uint32_t Cart::RomCrc32() const
+{
+    // any CHR-RAM is appended to our copy of the CHR-ROM, and is left out.
+    auto chrRomSize = chrRamStart_ >= 0 ? static_cast<size_t>(chrRamStart_) : chrData_.size();
+    return GameDatabase::HashData(prgData_, chrData_.first(chrRomSize));
+}
+
+void Cart::PowerOn()
+{
+    state_ = initialState_;
+    cpuBanks_ = initialCpuBanks_;
+    ppuBanks_ = initialPpuBanks_;
+    UpdatePpuRamMap();
+
+    // battery-backed RAM keeps its contents while the power is off.
+    std::fill(localPrgRam_.begin(), localPrgRam_.end(), static_cast<uint8_t>(0));
+    if (chrRamStart_ >= 0)
+        std::fill(localChrData_.begin() + chrRamStart_, localChrData_.end(), static_cast<uint8_t>(0));
+    extendedRam_.fill(0);
+
+    prgRamPages_[0].MarkAll();
+    prgRamPages_[1].MarkAll();
+    chrRamPages_.MarkAll();
+    extendedRamPages_.MarkAll();
 }
 
 void Cart::Attach(Bus* bus)
@@ -245,7 +305,7 @@ void Cart::Attach(Bus* bus)
 
 uint8_t Cart::CpuRead(uint16_t address)
 {
-    if (mapper_ == MapperType::MMC5)
+    if (IsMapper(MapperType::MMC5))
     {
         if (state_.IrqPending && (address & 0xfffe) == 0xffffa)
         {
@@ -260,13 +320,13 @@ uint8_t Cart::CpuRead(uint16_t address)
         }
     }
 
-    auto bank = state_.CpuBanks[address >> 13];
+    auto bank = cpuBanks_[address >> 13];
 
     if (bank == nullptr)
     {
-        if (mapper_ == MapperType::MMC5)
+        if (IsMapper(MapperType::MMC5))
             return ReadMMC5(address);
-        else if (mapper_ == MapperType::MMC6)
+        else if (IsMapper(MapperType::MMC6))
         {
             if (address < 0x8000)
             {
@@ -286,34 +346,37 @@ void Cart::CpuWrite(uint16_t address, uint8_t value)
 {
     if (address < 0x8000)
     {
-        if (mapper_ == MapperType::MMC5 && address < 0x6000)
+        if (IsMapper(MapperType::MMC5) && address < 0x6000)
         {
             WriteMMC5(address, value);
             return;
         }
-        else if (mapper_ == MapperType::MMC6)
+        else if (IsMapper(MapperType::MMC6))
         {
             auto protect = (address & 0200) != 0 ? state_.PrgRamProtect1 : state_.PrgRamProtect0;
             if ((protect & 5) != 0)
+            {
                 prgRamBanks_[0][address & 0x3ff] = value;
+                prgRamPages_[0].Mark(address & 0x3ff);
+            }
             return;
         }
-        else if (mapper_ == MapperType::NINA001)
+        else if (IsMapper(MapperType::NINA001))
         {
             WriteNINA001(address, value);
             // continue to alse write to RAM
         }
-        else if (mapper_ == MapperType::Caltron6in1)
+        else if (IsMapper(MapperType::Caltron6in1))
         {
             WriteCaltron6in1Low(address);
             return;
         }
-        else if (mapper_ == MapperType::RumbleStation)
+        else if (IsMapper(MapperType::RumbleStation))
         {
             WriteRumbleStationLow(address, value);
             return;
         }
-        else if (mapper_ == MapperType::NINA03)
+        else if (IsMapper(MapperType::NINA03))
         {
             WriteNINA03(address, value);
             return;
@@ -322,29 +385,35 @@ void Cart::CpuWrite(uint16_t address, uint8_t value)
         if (state_.PrgRamProtect0)
             return;
 
-        if (mapper_ == MapperType::QJ)
+        if (IsMapper(MapperType::QJ))
         {
             WriteQJLow(address, value);
             return;
         }
 
-        auto bank = state_.CpuBanks[address >> 13];
-        if (bank)
-            bank[address & 0x1fff] = value;
+        auto bank = cpuBanks_[address >> 13];
+        if (bank && state_.CpuBankWritable[address >> 13])
+            WritePrgRam(&bank[address & 0x1fff], value);
         return;
     }
 
     switch (mapper_)
     {
     case MapperType::MMC1:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::MMC1);
+
         WriteMMC1(address, value);
         break;
 
     case MapperType::UxROM:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::UxROM);
+
         WriteUxROM(address, value);
         break;
 
     case MapperType::CNROM:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::CNROM);
+
         WriteCNROM(address, value);
         break;
 
@@ -354,85 +423,126 @@ void Cart::CpuWrite(uint16_t address, uint8_t value)
     case MapperType::QJ:
     case MapperType::TxSROM:
     case MapperType::TQROM:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::MMC3, MapperType::MMC6, MapperType::MCACC, MapperType::QJ,
+            MapperType::TxSROM, MapperType::TQROM);
+
         WriteMMC3(address, value);
         break;
 
     case MapperType::MMC5:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::MMC5);
+
         if (state_.CpuBankWritable[address >> 13])
-            state_.CpuBanks[address >> 13][address & 0x1fff] = value;
+            WritePrgRam(&cpuBanks_[address >> 13][address & 0x1fff], value);
         break;
 
     case MapperType::AxROM:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::AxROM);
+
         WriteAxROM(address, value);
         break;
 
     case MapperType::MMC2:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::MMC2);
+
         WriteMMC2(address, value);
         break;
 
     case MapperType::ColorDreams:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::ColorDreams);
+
         WriteColorDreams(address, value);
         break;
 
     case MapperType::CPROM:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::CPROM);
+
         WriteCPROM(address, value);
         break;
 
     case MapperType::BNROM:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::BNROM);
+
         WriteBNROM(address, value);
         break;
 
     case MapperType::Caltron6in1:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::Caltron6in1);
+
         WriteCaltron6in1High(address, value);
         break;
 
     case MapperType::RumbleStation:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::RumbleStation);
+
         WriteRumbleStationHigh(address, value);
         break;
 
     case MapperType::Rambo1:
     case MapperType::Tengen800037:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::Rambo1, MapperType::Tengen800037);
+
         WriteRambo1(address, value);
         break;
 
     case MapperType::GxROM:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::GxROM);
+
         WriteGxROM(address, value);
         break;
 
     case MapperType::Sunsoft4:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::Sunsoft4);
+
         WriteSunsoft4(address, value);
         break;
 
     case MapperType::SunsoftFME7:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::SunsoftFME7);
+
         WriteSunsoftFME7(address, value);
         break;
 
     case MapperType::BF9093:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::BF9093);
+
         if (address >= 0xc000)
             WriteUxROM(address, value);
         break;
 
     case MapperType::BF9097:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::BF9097);
+
         WriteBF9097(address, value);
         break;
 
     case MapperType::NesEvent:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::NesEvent);
+
         WriteNesEvent(address, value);
         break;
 
     case MapperType::SachenSA008A:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::SachenSA008A);
+
         WriteSachenSA008A(address, value);
         return;
 
     case MapperType::ActiveEnterprises:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::ActiveEnterprises);
+
         WriteActiveEnterprises(address, value);
         return;
 
     case MapperType::Quattro:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::Quattro);
+
         WriteQuattro(address, value);
         return;
 
     case MapperType::Aladdin:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::Aladdin);
+
         WriteAladdin(address, value);
         return;
     }
@@ -442,46 +552,49 @@ void Cart::CpuWrite2(uint16_t address, uint8_t firstValue, uint8_t secondValue)
 {
     if (address < 0x8000)
     {
-        if (mapper_ == MapperType::MMC5 && address < 0x6000)
+        if (IsMapper(MapperType::MMC5) && address < 0x6000)
         {
             WriteMMC5(address, firstValue);
             bus_->TickCpuWrite();
             WriteMMC5(address, firstValue);
             return;
         }
-        else if (mapper_ == MapperType::NINA001)
+        else if (IsMapper(MapperType::NINA001))
         {
             WriteNINA001(address, firstValue);
             bus_->TickCpuWrite();
             WriteNINA001(address, secondValue);
 
-            auto bank = state_.CpuBanks[address >> 13];
-            if (bank)
-                bank[address & 0x1fff] = secondValue;
+            auto bank = cpuBanks_[address >> 13];
+            if (bank && state_.CpuBankWritable[address >> 13])
+                WritePrgRam(&bank[address & 0x1fff], secondValue);
             return;
         }
-        else if (mapper_ == MapperType::Caltron6in1)
+        else if (IsMapper(MapperType::Caltron6in1))
         {
             WriteCaltron6in1Low(address);
             bus_->TickCpuWrite();
             return;
         }
-        else if (mapper_ == MapperType::RumbleStation)
+        else if (IsMapper(MapperType::RumbleStation))
         {
             WriteRumbleStationLow(address, firstValue);
             bus_->TickCpuWrite();
             WriteRumbleStationLow(address, firstValue);
             return;
         }
-        else if (mapper_ == MapperType::MMC6)
+        else if (IsMapper(MapperType::MMC6))
         {
             bus_->TickCpuWrite();
             auto protect = (address & 0200) != 0 ? state_.PrgRamProtect1 : state_.PrgRamProtect0;
             if ((protect & 5) != 0)
+            {
                 prgRamBanks_[0][address & 0x3ff] = secondValue;
+                prgRamPages_[0].Mark(address & 0x3ff);
+            }
             return;
         }
-        else if (mapper_ == MapperType::NINA03)
+        else if (IsMapper(MapperType::NINA03))
         {
             WriteNINA03(address, firstValue);
             bus_->TickCpuWrite();
@@ -492,7 +605,7 @@ void Cart::CpuWrite2(uint16_t address, uint8_t firstValue, uint8_t secondValue)
         if (state_.PrgRamProtect0)
             return;
 
-        if (mapper_ == MapperType::QJ)
+        if (IsMapper(MapperType::QJ))
         {
             WriteQJLow(address, firstValue);
             bus_->TickCpuWrite();
@@ -502,26 +615,32 @@ void Cart::CpuWrite2(uint16_t address, uint8_t firstValue, uint8_t secondValue)
 
         bus_->TickCpuWrite();
 
-        auto bank = state_.CpuBanks[address >> 13];
-        if (bank)
-            bank[address & 0x1fff] = secondValue;
+        auto bank = cpuBanks_[address >> 13];
+        if (bank && state_.CpuBankWritable[address >> 13])
+            WritePrgRam(&bank[address & 0x1fff], secondValue);
         return;
     }
 
     switch (mapper_)
     {
     case MapperType::MMC1:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::MMC1);
+
         // The MMC1 takes the first value and ignores the second.
         WriteMMC1(address, firstValue);
         bus_->TickCpuWrite();
         break;
 
     case MapperType::UxROM:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::UxROM);
+
         bus_->TickCpuWrite();
         WriteUxROM(address, secondValue);
         break;
 
     case MapperType::CNROM:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::CNROM);
+
         WriteCNROM(address, firstValue);
         bus_->TickCpuWrite();
         WriteCNROM(address, secondValue);
@@ -533,53 +652,72 @@ void Cart::CpuWrite2(uint16_t address, uint8_t firstValue, uint8_t secondValue)
     case MapperType::QJ:
     case MapperType::TxSROM:
     case MapperType::TQROM:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::MMC3, MapperType::MMC6, MapperType::MCACC, MapperType::QJ,
+            MapperType::TxSROM, MapperType::TQROM);
+
         WriteMMC3(address, firstValue);
         bus_->TickCpuWrite();
         WriteMMC3(address, secondValue);
         break;
 
     case MapperType::MMC5:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::MMC5);
+
         bus_->TickCpuWrite();
         if (state_.CpuBankWritable[address >> 13])
-            state_.CpuBanks[address >> 13][address & 0x1fff] = secondValue;
+            WritePrgRam(&cpuBanks_[address >> 13][address & 0x1fff], secondValue);
         break;
 
     case MapperType::AxROM:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::AxROM);
+
         WriteAxROM(address, firstValue);
         bus_->TickCpuWrite();
         WriteAxROM(address, secondValue);
         break;
 
     case MapperType::MMC2:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::MMC2);
+
         WriteMMC2(address, firstValue);
         bus_->TickCpuWrite();
         WriteMMC2(address, secondValue);
         break;
 
     case MapperType::ColorDreams:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::ColorDreams);
+
         WriteColorDreams(address, firstValue);
         bus_->TickCpuWrite();
         WriteColorDreams(address, secondValue);
         break;
 
     case MapperType::CPROM:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::CPROM);
+
         WriteCPROM(address, firstValue);
         bus_->TickCpuWrite();
         WriteCPROM(address, secondValue);
         break;
 
     case MapperType::BNROM:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::BNROM);
+
         bus_->TickCpuWrite();
         WriteBNROM(address, secondValue);
         break;
 
     case MapperType::Caltron6in1:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::Caltron6in1);
+
         WriteCaltron6in1High(address, firstValue);
         bus_->TickCpuWrite();
         WriteCaltron6in1High(address, secondValue);
         break;
 
     case MapperType::RumbleStation:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::RumbleStation);
+
         WriteRumbleStationHigh(address, firstValue);
         bus_->TickCpuWrite();
         WriteRumbleStationHigh(address, secondValue);
@@ -587,66 +725,88 @@ void Cart::CpuWrite2(uint16_t address, uint8_t firstValue, uint8_t secondValue)
 
     case MapperType::Rambo1:
     case MapperType::Tengen800037:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::Rambo1, MapperType::Tengen800037);
+
         WriteRambo1(address, firstValue);
         bus_->TickCpuWrite();
         WriteRambo1(address, secondValue);
         break;
 
     case MapperType::BF9093:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::BF9093);
+
         bus_->TickCpuWrite();
         if (address >= 0xc000)
             WriteUxROM(address, secondValue);
         break;
 
     case MapperType::BF9097:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::BF9097);
+
         WriteBF9097(address, secondValue);
         bus_->TickCpuWrite();
         WriteBF9097(address, secondValue);
         break;
 
     case MapperType::GxROM:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::GxROM);
+
         WriteGxROM(address, firstValue);
         bus_->TickCpuWrite();
         WriteGxROM(address, secondValue);
         break;
 
     case MapperType::Sunsoft4:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::Sunsoft4);
+
         WriteSunsoft4(address, firstValue);
         bus_->TickCpuWrite();
         WriteSunsoft4(address, secondValue);
         break;
 
     case MapperType::SunsoftFME7:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::SunsoftFME7);
+
         WriteSunsoftFME7(address, firstValue);
         bus_->TickCpuWrite();
         WriteSunsoftFME7(address, secondValue);
         break;
 
     case MapperType::NesEvent:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::NesEvent);
+
         // The MMC1 takes the first value and ignores the second.
         WriteNesEvent(address, firstValue);
         bus_->TickCpuWrite();
         break;
 
     case MapperType::SachenSA008A:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::SachenSA008A);
+
         WriteSachenSA008A(address, firstValue);
         bus_->TickCpuWrite();
         WriteSachenSA008A(address, secondValue);
         return;
 
     case MapperType::ActiveEnterprises:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::ActiveEnterprises);
+
         WriteActiveEnterprises(address, firstValue);
         bus_->TickCpuWrite();
         WriteActiveEnterprises(address, secondValue);
         return;
 
     case MapperType::Quattro:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::Quattro);
+
         WriteQuattro(address, firstValue);
         bus_->TickCpuWrite();
         WriteQuattro(address, secondValue);
         return;
 
     case MapperType::Aladdin:
+        BREAK_UNLESS_MAPPER_ENABLED(MapperType::Aladdin);
+
         WriteAladdin(address, firstValue);
         bus_->TickCpuWrite();
         WriteAladdin(address, secondValue);
@@ -662,7 +822,7 @@ uint8_t Cart::PpuReadData(uint16_t address)
 {
     auto bankIndex = address >> 10;
 
-    if (mapper_ == MapperType::MMC5)
+    if (IsMapper(MapperType::MMC5))
     {
         if (state_.ExtendedRamMode <= 1 && state_.PpuInFrame && !state_.InSprites)
         {
@@ -678,13 +838,13 @@ uint8_t Cart::PpuReadData(uint16_t address)
                         {
                             // attribute byte
                             auto attributeAddress = 0x03c0 + ((state_.SplitY & 0xe0) >> 2) | ((state_.CurrentTile & 0x1f) >> 2);
-                            return state_.ExtendedRam[attributeAddress];
+                            return extendedRam_[attributeAddress];
                         }
                         else
                         {
                             // nametable byte
                             auto tileAddress = ((state_.SplitY & 0xf8) << 2) | (state_.CurrentTile & 0x1f);
-                            return state_.ExtendedRam[tileAddress];
+                            return extendedRam_[tileAddress];
                         }
                     }
                     else
@@ -708,7 +868,7 @@ uint8_t Cart::PpuReadData(uint16_t address)
                 }
                 else
                 {
-                    auto exData = state_.ExtendedRam[address & 0x03ff];
+                    auto exData = extendedRam_[address & 0x03ff];
                     state_.ExtendedAttribute = exData & 0xc0;
                     state_.ExtendedAttribute |= state_.ExtendedAttribute >> 2;
                     state_.ExtendedAttribute |= state_.ExtendedAttribute >> 4;
@@ -718,7 +878,7 @@ uint8_t Cart::PpuReadData(uint16_t address)
             }
         }
 
-        auto bank = state_.PpuBanks[bankIndex];
+        auto bank = ppuBanks_[bankIndex];
         if (bank == nullptr)
         {
             return (address & 0x03ff) >= 0x03c0 ?
@@ -728,12 +888,12 @@ uint8_t Cart::PpuReadData(uint16_t address)
 
         return bank[address & 0x03ff];
     }
-    else if (mapper_ == MapperType::MMC2)
+    else if (IsMapper(MapperType::MMC2))
     {
         PpuReadMMC2(address);
     }
 
-    auto bank = state_.PpuBanks[bankIndex];
+    auto bank = ppuBanks_[bankIndex];
     return bank[address & 0x03ff];
 }
 
@@ -741,7 +901,7 @@ uint8_t Cart::PpuReadNametable(uint16_t address)
 {
     auto bankIndex = address >> 10;
 
-    if (mapper_ == MapperType::MMC5)
+    if (IsMapper(MapperType::MMC5))
     {
         if (state_.ExtendedRamMode <= 1 && state_.PpuInFrame)
         {
@@ -755,13 +915,13 @@ uint8_t Cart::PpuReadNametable(uint16_t address)
                     {
                         // attribute byte
                         auto attributeAddress = 0x03c0 | ((state_.SplitY & 0xe0) >> 2) | ((state_.CurrentTile & 0x1f) >> 2);
-                        return state_.ExtendedRam[attributeAddress];
+                        return extendedRam_[attributeAddress];
                     }
                     else
                     {
                         // nametable byte
                         auto tileAddress = ((state_.SplitY & 0xf8) << 2) | (state_.CurrentTile & 0x1f);
-                        return state_.ExtendedRam[tileAddress];
+                        return extendedRam_[tileAddress];
                     }
                 }
             }
@@ -775,7 +935,7 @@ uint8_t Cart::PpuReadNametable(uint16_t address)
                 }
                 else
                 {
-                    auto exData = state_.ExtendedRam[address & 0x03ff];
+                    auto exData = extendedRam_[address & 0x03ff];
                     state_.ExtendedAttribute = exData & 0xc0;
                     state_.ExtendedAttribute |= state_.ExtendedAttribute >> 2;
                     state_.ExtendedAttribute |= state_.ExtendedAttribute >> 4;
@@ -784,7 +944,7 @@ uint8_t Cart::PpuReadNametable(uint16_t address)
                 }
             }
         }
-        auto bank = state_.PpuBanks[bankIndex];
+        auto bank = ppuBanks_[bankIndex];
         if (bank == nullptr)
         {
             return (address & 0x03ff) >= 0x03c0 ?
@@ -795,7 +955,7 @@ uint8_t Cart::PpuReadNametable(uint16_t address)
         return bank[address & 0x03ff];
     }
 
-    auto bank = state_.PpuBanks[bankIndex];
+    auto bank = ppuBanks_[bankIndex];
     return bank[address & 0x03ff];
 }
 
@@ -803,7 +963,7 @@ uint8_t Cart::PpuReadAttributes(uint16_t address)
 {
     auto bankIndex = address >> 10;
 
-    if (mapper_ == MapperType::MMC5)
+    if (IsMapper(MapperType::MMC5))
     {
         if (state_.ExtendedRamMode <= 1 && state_.PpuInFrame)
         {
@@ -814,21 +974,21 @@ uint8_t Cart::PpuReadAttributes(uint16_t address)
                 {
                     // attribute byte
                     auto attributeAddress = 0x03c0 | ((state_.SplitY & 0xe0) >> 2) | ((state_.CurrentTile & 0x1f) >> 2);
-                    return state_.ExtendedRam[attributeAddress];
+                    return extendedRam_[attributeAddress];
                 }
             }
 
             if (state_.ExtendedRamMode == 1)
                 return state_.ExtendedAttribute;
         }
-        auto bank = state_.PpuBanks[bankIndex];
+        auto bank = ppuBanks_[bankIndex];
         if (bank == nullptr)
             return state_.PPuBankAttributeBytes[bankIndex & 0x03];
 
         return bank[address & 0x03ff];
     }
 
-    auto bank = state_.PpuBanks[bankIndex];
+    auto bank = ppuBanks_[bankIndex];
     return bank[address & 0x03ff];
 }
 
@@ -856,7 +1016,7 @@ uint8_t Cart::PpuReadPatternLow(uint16_t address)
         }
     }
 
-    auto bank = state_.PpuBanks[bankIndex];
+    auto bank = ppuBanks_[bankIndex];
     return bank[address & 0x03ff];
 }
 
@@ -882,20 +1042,12 @@ uint8_t Cart::PpuReadPatternHigh(uint16_t address)
             return chrData_[chrAddress & (chrData_.size() - 1)];
         }
     }
-    else if (mapper_ == MapperType::MMC2)
+    else if (IsMapper(MapperType::MMC2))
     {
         PpuReadMMC2(address);
     }
 
-    auto bank = state_.PpuBanks[bankIndex];
-    return bank[address & 0x03ff];
-}
-
-uint8_t Cart::PpuReadSpritePatternLow(uint16_t address)
-{
-    auto bankIndex = address >> 10;
-
-    auto bank = state_.PpuBanks[bankIndex];
+    auto bank = ppuBanks_[bankIndex];
     return bank[address & 0x03ff];
 }
 
@@ -903,12 +1055,12 @@ uint8_t Cart::PpuReadSpritePatternHigh(uint16_t address)
 {
     auto bankIndex = address >> 10;
 
-    if (mapper_ == MapperType::MMC2)
+    if (IsMapper(MapperType::MMC2))
     {
         PpuReadMMC2(address);
     }
 
-    auto bank = state_.PpuBanks[bankIndex];
+    auto bank = ppuBanks_[bankIndex];
     return bank[address & 0x03ff];
 }
 
@@ -939,12 +1091,12 @@ uint16_t Cart::PpuReadPattern16(uint16_t address)
             return (chrData_[chrRamAddress | 8] << 8) | chrData_[chrRamAddress];
         }
     }
-    else if (mapper_ == MapperType::MMC2)
+    else if (IsMapper(MapperType::MMC2))
     {
         PpuReadMMC2(address | 8);
     }
 
-    auto bank = state_.PpuBanks[bankIndex];
+    auto bank = ppuBanks_[bankIndex];
     auto bankAddress = address & 0x03ff;
     return (bank[bankAddress | 8] << 8) | bank[bankAddress];
 }
@@ -954,9 +1106,33 @@ void Cart::PpuWrite(uint16_t address, uint8_t value)
     //assert(((address & 0x1000) != 0) == chrA12_);
 
     auto bankIndex = address >> 10;
-    auto bank = state_.PpuBanks[bankIndex];
+    auto bank = ppuBanks_[bankIndex];
     if (bank != nullptr && state_.PpuBankWritable[bankIndex])
-        bank[address & 0x03ff] = value;
+    {
+        // the bank is writable, so it points at RAM rather than the read-only ROM.
+        auto data = const_cast<uint8_t*>(&bank[address & 0x03ff]);
+        *data = value;
+
+        // the nametables can be mapped to CHR-RAM or ExRAM as well as the console's own RAM
+        chrRamPages_.Mark(data);
+        extendedRamPages_.Mark(data);
+    }
+}
+
+PpuFetchMode Cart::FetchMode() const
+{
+    if (IsMapper(MapperType::MMC5))
+        return PpuFetchMode::MMC5;
+
+    if (IsMapper(MapperType::MMC2))
+        return PpuFetchMode::Latched;
+
+    return PpuFetchMode::Banked;
+}
+
+const std::array<const uint8_t*, 16>& Cart::PpuBanks() const
+{
+    return ppuBanks_;
 }
 
 ChrA12Sensitivity Cart::ChrA12Sensitivity() const
@@ -968,21 +1144,21 @@ void Cart::ChrA12Rising()
 {
     state_.ChrA12 = true;
 
-    if (mapper_ == MapperType::MMC1)
+    if (IsMapper(MapperType::MMC1))
     {
         if (state_.ChrA12Sensitivity == ChrA12Sensitivity::AllEdges)
         {
             UpdatePrgMapMMC1();
 
-            if (state_.CpuBanks[3])
-                state_.CpuBanks[3] = prgRamBanks_[state_.PrgRamBank1];
+            if (cpuBanks_[3])
+                cpuBanks_[3] = prgRamBanks_[state_.PrgRamBank1];
         }
     }
-    else if (mapper_ != MapperType::MCACC) // MMC3, MMC6, QJ, RAMBO-1, TxSROM, TQROM, 800037
+    else if (!IsMapper(MapperType::MCACC)) // MMC3, MMC6, QJ, RAMBO-1, TxSROM, TQROM, 800037
     {
         if (state_.ChrA12Sensitivity == ChrA12Sensitivity::RisingEdgeSmoothed)
         {
-            if (mapper_ == MapperType::Rambo1 || mapper_ == MapperType::Tengen800037)
+            if (IsMapper(MapperType::Rambo1) || IsMapper(MapperType::Tengen800037))
             {
                 state_.LastA12Cycle = bus_->GetA12FallingEdgeCycleSmoothed();
                 if (state_.IrqMode != 0)
@@ -999,12 +1175,12 @@ void Cart::ChrA12Falling()
 {
     state_.ChrA12 = false;
 
-    if (mapper_ == MapperType::MMC1)
+    if (IsMapper(MapperType::MMC1))
     {
         if (state_.ChrA12Sensitivity == ChrA12Sensitivity::AllEdges)
         {
-            if (state_.CpuBanks[3])
-                state_.CpuBanks[3] = prgRamBanks_[state_.PrgRamBank0];
+            if (cpuBanks_[3])
+                cpuBanks_[3] = prgRamBanks_[state_.PrgRamBank0];
         }
     }
     else // if (mapper_ == MapperType::MCACC)
@@ -1028,12 +1204,12 @@ void Cart::ChrA12Falling()
 
 uint32_t Cart::A12PulsesUntilSync()
 {
-    return mapper_ == MapperType::MCACC ? state_.ChrA12PulseCounter : 0;
+    return IsMapper(MapperType::MCACC) ? state_.ChrA12PulseCounter : 0;
 }
 
 bool Cart::HasScanlineCounter() const
 {
-    return mapper_ == MapperType::MMC5;
+    return IsMapper(MapperType::MMC5);
 }
 
 void Cart::ScanlineCounterBeginScanline()
@@ -1066,7 +1242,7 @@ void Cart::ScanlineCounterEndFrame()
     state_.InFrame = false;
     state_.IrqPending = false;
 
-    if (state_.RenderingEnabled && state_.LargeSprites && mapper_ == MapperType::MMC5)
+    if (state_.RenderingEnabled && state_.LargeSprites && IsMapper(MapperType::MMC5))
     {
         bus_->SyncPpu();
         state_.PpuInFrame = false;
@@ -1086,7 +1262,7 @@ void Cart::TileSplitBeginScanline()
 {
     state_.PpuInFrame = true;
 
-    if (mapper_ == MapperType::MMC5)
+    if (IsMapper(MapperType::MMC5))
         UpdateChrMapMMC5();
 }
 
@@ -1101,14 +1277,14 @@ void Cart::TileSplitBeginTile(uint32_t tileIndex)
 void Cart::TileSplitBeginSprites()
 {
     state_.InSprites = true;
-    if (mapper_ == MapperType::MMC5 && state_.PpuInFrame)
+    if (IsMapper(MapperType::MMC5) && state_.PpuInFrame)
         UpdateChrMapMMC5();
 }
 
 void Cart::TileSplitEndSprites()
 {
     state_.InSprites = false;
-    if (mapper_ == MapperType::MMC5 && state_.PpuInFrame)
+    if (IsMapper(MapperType::MMC5) && state_.PpuInFrame)
     {
         UpdateChrMapMMC5();
 
@@ -1128,7 +1304,7 @@ void Cart::InterceptWritePpuCtrl(bool largeSprites)
 void Cart::InterceptWritePpuMask(bool renderingEnabled)
 {
     state_.RenderingEnabled = renderingEnabled;
-    if (mapper_ == MapperType::MMC5)
+    if (IsMapper(MapperType::MMC5))
         UpdateChrMapMMC5();
 }
 
@@ -1153,31 +1329,146 @@ void Cart::CaptureState(CartState* state) const
 {
     state->Core = state_;
 
-    if (prgRamBanks_.size() > 0)
-        std::copy(prgRamBanks_[0], prgRamBanks_[0] + prgRamMask_ + 1, begin(state->PrgRamBank1));
-
-    if (prgRamBanks_.size() > 1)
-        std::copy(prgRamBanks_[1], prgRamBanks_[1] + prgRamMask_ + 1, begin(state->PrgRamBank2));
+    for (auto i = 0u; i < cpuBanks_.size(); i++)
+        state->CpuBankOffsets[i] = BankToOffset(cpuBanks_[i]);
+    for (auto i = 0u; i < ppuBanks_.size(); i++)
+        state->PpuBankOffsets[i] = BankToOffset(ppuBanks_[i]);
 
-    assert(prgRamBanks_.size() <= 2);
-
-    if (chrRamStart_ >= 0)
-        std::copy(begin(chrData_) + chrRamStart_, end(chrData_), begin(state->ChrRam));
+    // only the pages which have changed since the state was last captured are copied.
+    prgRamPages_[0].Capture(&state->PrgRamBank1);
+    prgRamPages_[1].Capture(&state->PrgRamBank2);
+    chrRamPages_.Capture(&state->ChrRam);
+    extendedRamPages_.Capture(&state->ExtendedRam);
 }
 
 void Cart::RestoreState(const CartState& state)
 {
     state_ = state.Core;
 
-    if (prgRamBanks_.size() > 0)
-        std::copy(begin(state.PrgRamBank1), begin(state.PrgRamBank1) + prgRamMask_ + 1, prgRamBanks_[0]);
+    for (auto i = 0u; i < cpuBanks_.size(); i++)
+        cpuBanks_[i] = OffsetToBank(state.CpuBankOffsets[i]);
+    for (auto i = 0u; i < ppuBanks_.size(); i++)
+        ppuBanks_[i] = OffsetToBank(state.PpuBankOffsets[i]);
 
-    if (prgRamBanks_.size() > 1)
-        std::copy(begin(state.PrgRamBank2), begin(state.PrgRamBank2) + prgRamMask_ + 1, prgRamBanks_[1]);
+    prgRamPages_[0].Restore(state.PrgRamBank1);
+    prgRamPages_[1].Restore(state.PrgRamBank2);
+    chrRamPages_.Restore(state.ChrRam);
+    extendedRamPages_.Restore(state.ExtendedRam);
+}
 
-    if (chrRamStart_ >= 0)
-        std::copy(begin(state.ChrRam) + chrRamStart_, end(state.ChrRam), begin(chrData_));
+bool Cart::IsValidState(const CartState& state) const
+{
+    for (auto offset : state.CpuBankOffsets)
+    {
+        if (!IsValidBankOffset(offset, 0x2000))
+            return false;
+    }
 
+    for (auto offset : state.PpuBankOffsets)
+    {
+        if (!IsValidBankOffset(offset, 0x0400))
+            return false;
+    }
+
+    return true;
+}
+
+uint32_t Cart::BankToOffset(const uint8_t* bank) const
+{
+    if (!bank)
+        return 0;
+
+    auto offsetInto = [bank](const uint8_t* base, size_t size) -> int64_t
+    {
+        auto offset = reinterpret_cast<uintptr_t>(bank) - reinterpret_cast<uintptr_t>(base);
+        return base && offset < size ? static_cast<int64_t>(offset) : -1;
+    };
+
+    auto encode = [](uint32_t region, int64_t offset)
+    {
+        return (region << RegionShift) | static_cast<uint32_t>(offset);
+    };
+
+    if (auto offset = offsetInto(prgData_.data(), prgData_.size()); offset >= 0)
+        return encode(PrgRomRegion, offset);
+
+    if (auto offset = offsetInto(chrData_.data(), chrData_.size()); offset >= 0)
+        return encode(ChrRegion, offset);
+
+    if (auto offset = offsetInto(bus_->GetPpuRamBase(), 0x800); offset >= 0)
+        return encode(PpuRamRegion, offset);
+
+    if (auto offset = offsetInto(extendedRam_.data(), extendedRam_.size()); offset >= 0)
+        return encode(ExtendedRamRegion, offset);
+
+    for (auto i = 0u; i < prgRamBanks_.size(); i++)
+    {
+        if (auto offset = offsetInto(prgRamBanks_[i], prgRamMask_ + 1); offset >= 0)
+            return encode(PrgRamRegion + i, offset);
+    }
+
+    assert(false);
+    return 0;
+}
+
+const uint8_t* Cart::OffsetToBank(uint32_t offset) const
+{
+    if (!offset)
+        return nullptr;
+
+    auto region = offset >> RegionShift;
+    offset &= (1 << RegionShift) - 1;
+
+    switch (region)
+    {
+    case PrgRomRegion:
+        return &prgData_[offset];
+
+    case ChrRegion:
+        return &chrData_[offset];
+
+    case PpuRamRegion:
+        return bus_->GetPpuRamBase() + offset;
+
+    case ExtendedRamRegion:
+        return &extendedRam_[offset];
+
+    default:
+        return prgRamBanks_[region - PrgRamRegion] + offset;
+    }
+}
+
+bool Cart::IsValidBankOffset(uint32_t offset, uint32_t bankSize) const
+{
+    if (!offset)
+        return true;
+
+    auto region = offset >> RegionShift;
+    offset &= (1 << RegionShift) - 1;
+
+    // the whole bank has to be inside the region, unless the region is smaller than a bank and the bank mirrors it.
+    auto fits = [offset, bankSize](size_t size)
+    {
+        return offset + std::min<size_t>(bankSize, size) <= size;
+    };
+
+    switch (region)
+    {
+    case PrgRomRegion:
+        return fits(prgData_.size());
+
+    case ChrRegion:
+        return fits(chrData_.size());
+
+    case PpuRamRegion:
+        return fits(0x800);
+
+    case ExtendedRamRegion:
+        return fits(extendedRam_.size());
+
+    default:
+        return region >= PrgRamRegion && region - PrgRamRegion < prgRamBanks_.size() && fits(prgRamMask_ + 1);
+    }
 }
 
 void Cart::WriteMMC1(uint16_t address, uint8_t value)
@@ -1258,8 +1549,8 @@ void Cart::WriteMMC1Register(uint16_t address, uint8_t value)
                 state_.ChrA12Sensitivity = ChrA12Sensitivity::AllEdges;
 
             // TODO: we need to get the current A12 state from the PPU.
-            if (!state_.ChrA12 && state_.CpuBanks[3])
-                state_.CpuBanks[3] = prgRamBanks_[state_.PrgRamBank0];
+            if (!state_.ChrA12 && cpuBanks_[3])
+                cpuBanks_[3] = prgRamBanks_[state_.PrgRamBank0];
         }
 
         if (state_.ChrA12Sensitivity != sensitivityBefore)
@@ -1301,8 +1592,8 @@ void Cart::WriteMMC1Register(uint16_t address, uint8_t value)
                 state_.ChrA12Sensitivity = ChrA12Sensitivity::AllEdges;
 
             // TODO: we need to get the current A12 state from the PPU.
-            if (state_.ChrA12 && state_.CpuBanks[3])
-                state_.CpuBanks[3] = prgRamBanks_[state_.PrgRamBank1];
+            if (state_.ChrA12 && cpuBanks_[3])
+                cpuBanks_[3] = prgRamBanks_[state_.PrgRamBank1];
         }
 
         if (state_.ChrA12Sensitivity != sensitivityBefore)
@@ -1332,30 +1623,30 @@ void Cart::UpdateChrMapMMC1()
     {
         auto chrBank = static_cast<size_t>(state_.ChrBank0) & 0x1e000;
         auto base = &chrData_[chrBank];
-        state_.PpuBanks[0] = base;
-        state_.PpuBanks[1] = base + 0x0400;
-        state_.PpuBanks[2] = base + 0x0800;
-        state_.PpuBanks[3] = base + 0x0c00;
-        state_.PpuBanks[4] = base + 0x1000;
-        state_.PpuBanks[5] = base + 0x1400;
-        state_.PpuBanks[6] = base + 0x1800;
-        state_.PpuBanks[7] = base + 0x1c00;
+        ppuBanks_[0] = base;
+        ppuBanks_[1] = base + 0x0400;
+        ppuBanks_[2] = base + 0x0800;
+        ppuBanks_[3] = base + 0x0c00;
+        ppuBanks_[4] = base + 0x1000;
+        ppuBanks_[5] = base + 0x1400;
+        ppuBanks_[6] = base + 0x1800;
+        ppuBanks_[7] = base + 0x1c00;
         break;
     }
 
     case 1:
     {
         auto base0 = &chrData_[state_.ChrBank0 & (chrData_.size() - 1)];
-        state_.PpuBanks[0] = base0;
-        state_.PpuBanks[1] = base0 + 0x0400;
-        state_.PpuBanks[2] = base0 + 0x0800;
-        state_.PpuBanks[3] = base0 + 0x0c00;
+        ppuBanks_[0] = base0;
+        ppuBanks_[1] = base0 + 0x0400;
+        ppuBanks_[2] = base0 + 0x0800;
+        ppuBanks_[3] = base0 + 0x0c00;
 
         auto base1 = &chrData_[state_.ChrBank1 & (chrData_.size() - 1)];
-        state_.PpuBanks[4] = base1;
-        state_.PpuBanks[5] = base1 + 0x0400;
-        state_.PpuBanks[6] = base1 + 0x0800;
-        state_.PpuBanks[7] = base1 + 0x0c00;
+        ppuBanks_[4] = base1;
+        ppuBanks_[5] = base1 + 0x0400;
+        ppuBanks_[6] = base1 + 0x0800;
+        ppuBanks_[7] = base1 + 0x0c00;
         break;
     }
     }
@@ -1364,9 +1655,9 @@ void Cart::UpdateChrMapMMC1()
 void Cart::UpdatePrgMapMMC1()
 {
     if (!state_.PrgRamEnabled || prgRamBanks_.size() == 0)
-        state_.CpuBanks[3] = nullptr;
+        cpuBanks_[3] = nullptr;
     else
-        state_.CpuBanks[3] = state_.ChrA12 ? prgRamBanks_[state_.PrgRamBank1] : prgRamBanks_[state_.PrgRamBank0];
+        cpuBanks_[3] = state_.ChrA12 ? prgRamBanks_[state_.PrgRamBank1] : prgRamBanks_[state_.PrgRamBank0];
 
     auto prgPlane = state_.ChrA12 ? state_.PrgPlane1 : state_.PrgPlane0;
 
@@ -1376,30 +1667,30 @@ void Cart::UpdatePrgMapMMC1()
     case 1:
     {
         auto base = &prgData_[prgPlane | (state_.PrgBank0 & 0xffff8000)];
-        state_.CpuBanks[4] = base;
-        state_.CpuBanks[5] = base + 0x2000;
-        state_.CpuBanks[6] = base + 0x4000;
-        state_.CpuBanks[7] = base + 0x6000;
+        cpuBanks_[4] = base;
+        cpuBanks_[5] = base + 0x2000;
+        cpuBanks_[6] = base + 0x4000;
+        cpuBanks_[7] = base + 0x6000;
         break;
     }
 
     case 2:
     {
         auto base = &prgData_[prgPlane | state_.PrgBank0];
-        state_.CpuBanks[4] = &prgData_[prgPlane];
-        state_.CpuBanks[5] = &prgData_[prgPlane | 0x2000];
-        state_.CpuBanks[6] = base;
-        state_.CpuBanks[7] = base + 0x2000;
+        cpuBanks_[4] = &prgData_[prgPlane];
+        cpuBanks_[5] = &prgData_[prgPlane | 0x2000];
+        cpuBanks_[6] = base;
+        cpuBanks_[7] = base + 0x2000;
         break;
     }
 
     case 3:
     {
         auto base = &prgData_[prgPlane | state_.PrgBank0];
-        state_.CpuBanks[4] = base;
-        state_.CpuBanks[5] = base + 0x2000;
-        state_.CpuBanks[6] = &prgData_[prgPlane | (prgData_.size() - 0x4000)];
-        state_.CpuBanks[7] = &prgData_[prgPlane | (prgData_.size() - 0x2000)];
+        cpuBanks_[4] = base;
+        cpuBanks_[5] = base + 0x2000;
+        cpuBanks_[6] = &prgData_[prgPlane | (prgData_.size() - 0x4000)];
+        cpuBanks_[7] = &prgData_[prgPlane | (prgData_.size() - 0x2000)];
     }
     }
 }
@@ -1408,21 +1699,21 @@ void Cart::WriteUxROM(uint16_t address, uint8_t value)
 {
     if (busConflicts_)
     {
-        auto bank = state_.CpuBanks[address >> 13];
+        auto bank = cpuBanks_[address >> 13];
         value &= bank[address & 0x1fff];
     }
 
     auto bankAddress = (value << 14) & prgMask_;
     auto base = &prgData_[bankAddress];
-    state_.CpuBanks[4] = base;
-    state_.CpuBanks[5] = base + 0x2000;
+    cpuBanks_[4] = base;
+    cpuBanks_[5] = base + 0x2000;
 }
 
 void Cart::WriteCNROM(uint16_t address, uint8_t value)
 {
     if (busConflicts_)
     {
-        auto bank = state_.CpuBanks[address >> 13];
+        auto bank = cpuBanks_[address >> 13];
         value &= bank[address & 0x1fff];
     }
 
@@ -1446,7 +1737,7 @@ void Cart::WriteMMC3(uint16_t address, uint8_t value)
             UpdatePrgMapMMC3();
             UpdateChrMapMMC3();
 
-            if (mapper_ == MapperType::MMC6)
+            if (IsMapper(MapperType::MMC6))
             {
                 // PRG RAM enable
                 // use bit 3 of the protect flag to signal this 
@@ -1475,7 +1766,7 @@ void Cart::WriteMMC3(uint16_t address, uint8_t value)
         }
         else
         {
-            if (mapper_ == MapperType::MMC6)
+            if (IsMapper(MapperType::MMC6))
             {
                 state_.PrgRamProtect0 &= ~3;
                 state_.PrgRamProtect0 |= (value >> 4 & 3);
@@ -1513,7 +1804,7 @@ void Cart::WriteMMC3(uint16_t address, uint8_t value)
         auto sensitivityBefore = state_.ChrA12Sensitivity;
         if (state_.IrqCounter > 0 || (state_.ReloadValue > 0) || state_.IrqEnabled)
             state_.ChrA12Sensitivity =
-                mapper_ == MapperType::MCACC
+                IsMapper(MapperType::MCACC)
                     ? ChrA12Sensitivity::FallingEdgeDivided
                     : ChrA12Sensitivity::RisingEdgeSmoothed;
         else
@@ -1538,7 +1829,7 @@ void Cart::WriteMMC3(uint16_t address, uint8_t value)
         auto sensitivityBefore = state_.ChrA12Sensitivity;
         if (state_.IrqCounter > 0 || (state_.ReloadValue > 0) || state_.IrqEnabled)
             state_.ChrA12Sensitivity =
-            mapper_ == MapperType::MCACC
+            IsMapper(MapperType::MCACC)
             ? ChrA12Sensitivity::FallingEdgeDivided
             : ChrA12Sensitivity::RisingEdgeSmoothed;
         else
@@ -1623,31 +1914,31 @@ void Cart::SetBankMMC3(uint32_t bank)
 void Cart::UpdatePrgMapMMC3()
 {
     if (state_.PrgRamEnabled && prgRamBanks_.size())
-        state_.CpuBanks[3] = prgRamBanks_[0];
+        cpuBanks_[3] = prgRamBanks_[0];
     else
-        state_.CpuBanks[3] = nullptr;
+        cpuBanks_[3] = nullptr;
 
     auto block = &prgData_[state_.PrgBankHighBits & prgMask_];
 
     if (state_.PrgMode == 0)
     {
-        state_.CpuBanks[4] = &block[state_.PrgBank0 & prgMask_];
-        state_.CpuBanks[5] = &block[state_.PrgBank1 & prgMask_];
-        state_.CpuBanks[6] = &block[state_.PrgBank2 & prgMask_];
-        state_.CpuBanks[7] = &block[prgBlockSize_ - 0x2000];
+        cpuBanks_[4] = &block[state_.PrgBank0 & prgMask_];
+        cpuBanks_[5] = &block[state_.PrgBank1 & prgMask_];
+        cpuBanks_[6] = &block[state_.PrgBank2 & prgMask_];
+        cpuBanks_[7] = &block[prgBlockSize_ - 0x2000];
     }
     else
     {
-        state_.CpuBanks[4] = &block[state_.PrgBank2 & prgMask_];
-        state_.CpuBanks[5] = &block[state_.PrgBank1 & prgMask_];
-        state_.CpuBanks[6] = &block[state_.PrgBank0 & prgMask_];
-        state_.CpuBanks[7] = &block[prgBlockSize_- 0x2000];
+        cpuBanks_[4] = &block[state_.PrgBank2 & prgMask_];
+        cpuBanks_[5] = &block[state_.PrgBank1 & prgMask_];
+        cpuBanks_[6] = &block[state_.PrgBank0 & prgMask_];
+        cpuBanks_[7] = &block[prgBlockSize_- 0x2000];
     }
 }
 
 void Cart::UpdateChrMapMMC3()
 {
-    if (mapper_ == MapperType::TQROM)
+    if (IsMapper(MapperType::TQROM))
     {
         UpdateChrMapTQROM();
         return;
@@ -1660,70 +1951,70 @@ void Cart::UpdateChrMapMMC3()
         if ((state_.ChrMode & 2) != 0)
         {
             // RAMBO-1 full 1kb mode
-            state_.PpuBanks[0] = &block[state_.ChrBank0 & chrMask_];
-            state_.PpuBanks[1] = &block[state_.ChrBank6 & chrMask_];
-            state_.PpuBanks[2] = &block[state_.ChrBank1 & chrMask_];
-            state_.PpuBanks[3] = &block[state_.ChrBank7 & chrMask_];
+            ppuBanks_[0] = &block[state_.ChrBank0 & chrMask_];
+            ppuBanks_[1] = &block[state_.ChrBank6 & chrMask_];
+            ppuBanks_[2] = &block[state_.ChrBank1 & chrMask_];
+            ppuBanks_[3] = &block[state_.ChrBank7 & chrMask_];
         }
         else
         {
             auto base0 = &block[state_.ChrBank0 & chrMask_ & 0xfffff800];
-            state_.PpuBanks[0] = base0;
-            state_.PpuBanks[1] = base0 + 0x400;
+            ppuBanks_[0] = base0;
+            ppuBanks_[1] = base0 + 0x400;
 
             auto base1 = &block[state_.ChrBank1 & chrMask_ & 0xfffff800];
-            state_.PpuBanks[2] = base1;
-            state_.PpuBanks[3] = base1 + 0x400;
+            ppuBanks_[2] = base1;
+            ppuBanks_[3] = base1 + 0x400;
         }
 
-        state_.PpuBanks[4] = &block[state_.ChrBank2 & chrMask_];
-        state_.PpuBanks[5] = &block[state_.ChrBank3 & chrMask_];
-        state_.PpuBanks[6] = &block[state_.ChrBank4 & chrMask_];
-        state_.PpuBanks[7] = &block[state_.ChrBank5 & chrMask_];
+        ppuBanks_[4] = &block[state_.ChrBank2 & chrMask_];
+        ppuBanks_[5] = &block[state_.ChrBank3 & chrMask_];
+        ppuBanks_[6] = &block[state_.ChrBank4 & chrMask_];
+        ppuBanks_[7] = &block[state_.ChrBank5 & chrMask_];
 
 
-        if (mapper_ == MapperType::TxSROM || mapper_ == MapperType::Tengen800037)
+        if (IsMapper(MapperType::TxSROM) || IsMapper(MapperType::Tengen800037))
         {
             auto base = bus_->GetPpuRamBase();
-            state_.PpuBanks[8] = state_.PpuBanks[12] = &base[(state_.ChrBank0 >> 7) & 0x00400];
-            state_.PpuBanks[9] = state_.PpuBanks[13] = &base[(state_.ChrBank0 >> 7) & 0x00400];
-            state_.PpuBanks[10] = state_.PpuBanks[14] = &base[(state_.ChrBank1 >> 7) & 0x00400];
-            state_.PpuBanks[11] = state_.PpuBanks[15] = &base[(state_.ChrBank1 >> 7) & 0x00400];
+            ppuBanks_[8] = ppuBanks_[12] = &base[(state_.ChrBank0 >> 7) & 0x00400];
+            ppuBanks_[9] = ppuBanks_[13] = &base[(state_.ChrBank0 >> 7) & 0x00400];
+            ppuBanks_[10] = ppuBanks_[14] = &base[(state_.ChrBank1 >> 7) & 0x00400];
+            ppuBanks_[11] = ppuBanks_[15] = &base[(state_.ChrBank1 >> 7) & 0x00400];
         }
     } 
     else
     {
-        state_.PpuBanks[0] = &block[state_.ChrBank2 & chrMask_];
-        state_.PpuBanks[1] = &block[state_.ChrBank3 & chrMask_];
-        state_.PpuBanks[2] = &block[state_.ChrBank4 & chrMask_];
-        state_.PpuBanks[3] = &block[state_.ChrBank5 & chrMask_];
+        ppuBanks_[0] = &block[state_.ChrBank2 & chrMask_];
+        ppuBanks_[1] = &block[state_.ChrBank3 & chrMask_];
+        ppuBanks_[2] = &block[state_.ChrBank4 & chrMask_];
+        ppuBanks_[3] = &block[state_.ChrBank5 & chrMask_];
 
         if ((state_.ChrMode & 2) != 0)
         {
             // RAMBO-1 full 1kb mode
-            state_.PpuBanks[4] = &block[state_.ChrBank0 & chrMask_];
-            state_.PpuBanks[5] = &block[state_.ChrBank6 & chrMask_];
-            state_.PpuBanks[6] = &block[state_.ChrBank1 & chrMask_];
-            state_.PpuBanks[7] = &block[state_.ChrBank7 & chrMask_];
+            ppuBanks_[4] = &block[state_.ChrBank0 & chrMask_];
+            ppuBanks_[5] = &block[state_.ChrBank6 & chrMask_];
+            ppuBanks_[6] = &block[state_.ChrBank1 & chrMask_];
+            ppuBanks_[7] = &block[state_.ChrBank7 & chrMask_];
         }
         else
         {
             auto base0 = &block[state_.ChrBank0 & chrMask_ & 0xfffff800];
-            state_.PpuBanks[4] = base0;
-            state_.PpuBanks[5] = base0 + 0x400;
+            ppuBanks_[4] = base0;
+            ppuBanks_[5] = base0 + 0x400;
 
             auto base1 = &block[state_.ChrBank1 & chrMask_ & 0xfffff800];
-            state_.PpuBanks[6] = base1;
-            state_.PpuBanks[7] = base1 + 0x400;
+            ppuBanks_[6] = base1;
+            ppuBanks_[7] = base1 + 0x400;
         }
 
-        if (mapper_ == MapperType::TxSROM || mapper_ == MapperType::Tengen800037)
+        if (IsMapper(MapperType::TxSROM) || IsMapper(MapperType::Tengen800037))
         {
             auto base = bus_->GetPpuRamBase();
-            state_.PpuBanks[8] = state_.PpuBanks[12] = &base[(state_.ChrBank2 >> 7) & 0x00400];
-            state_.PpuBanks[9] = state_.PpuBanks[13] = &base[(state_.ChrBank3 >> 7) & 0x00400];
-            state_.PpuBanks[10] = state_.PpuBanks[14] = &base[(state_.ChrBank4 >> 7) & 0x00400];
-            state_.PpuBanks[11] = state_.PpuBanks[15] = &base[(state_.ChrBank5 >> 7) & 0x00400];
+            ppuBanks_[8] = ppuBanks_[12] = &base[(state_.ChrBank2 >> 7) & 0x00400];
+            ppuBanks_[9] = ppuBanks_[13] = &base[(state_.ChrBank3 >> 7) & 0x00400];
+            ppuBanks_[10] = ppuBanks_[14] = &base[(state_.ChrBank4 >> 7) & 0x00400];
+            ppuBanks_[11] = ppuBanks_[15] = &base[(state_.ChrBank5 >> 7) & 0x00400];
         }
     }
 }
@@ -1741,7 +2032,7 @@ void Cart::ClockMMC3IrqCounter()
         state_.BumpIrqCounter = false;
         state_.ReloadCounter = false;
 
-        if ((mapper_ != MapperType::Rambo1 && mapper_ != MapperType::Tengen800037) && state_.IrqCounter == 0 && !state_.IrqEnabled)
+        if ((!IsMapper(MapperType::Rambo1) && !IsMapper(MapperType::Tengen800037)) && state_.IrqCounter == 0 && !state_.IrqEnabled)
         {
             state_.ChrA12Sensitivity = ChrA12Sensitivity::None;
             bus_->UpdateA12Sensitivity();
@@ -1754,7 +2045,7 @@ void Cart::ClockMMC3IrqCounter()
 
     if (state_.IrqCounter == 0 && state_.IrqEnabled)
     {
-        if (mapper_ == MapperType::Rambo1 || mapper_ == MapperType::Tengen800037)
+        if (IsMapper(MapperType::Rambo1) || IsMapper(MapperType::Tengen800037))
         {
             bus_->Schedule(3, SyncEvent::CartSetIrq);
         }
@@ -1773,7 +2064,7 @@ uint8_t Cart::ReadMMC5(uint16_t address)
         {
             if (state_.ExtendedRamMode >= 2)
             {
-                return state_.ExtendedRam[address - 0x5c00];
+                return extendedRam_[address - 0x5c00];
             }
 
             return 0;
@@ -1831,7 +2122,8 @@ void Cart::WriteMMC5(uint16_t address, uint8_t value)
             return;
         }
 
-        state_.ExtendedRam[address - 0x5c00] = value;
+        extendedRam_[address - 0x5c00] = value;
+        extendedRamPages_.Mark(address - 0x5c00);
         return;
     }
 
@@ -1899,7 +2191,7 @@ void Cart::WriteMMC5(uint16_t address, uint8_t value)
     case 0x5113:
     {
         auto bank = prgRamBanks_[(value & 7) >> 2];
-        state_.CpuBanks[3] = bank ? &bank[(value << 13) & prgRamMask_] : nullptr;
+        cpuBanks_[3] = bank ? &bank[(value << 13) & prgRamMask_] : nullptr;
         break;
     }
 
@@ -2072,10 +2364,10 @@ void Cart::UpdatePrgMapMMC5()
     case 0:
     {
         auto base = &prgData_[(state_.PrgBank3 & 0xffff8000)];
-        state_.CpuBanks[4] = base;
-        state_.CpuBanks[5] = base + 0x2000;
-        state_.CpuBanks[6] = base + 0x4000;
-        state_.CpuBanks[7] = base + 0x6000;
+        cpuBanks_[4] = base;
+        cpuBanks_[5] = base + 0x2000;
+        cpuBanks_[6] = base + 0x4000;
+        cpuBanks_[7] = base + 0x6000;
 
         state_.CpuBankWritable[4] = false;
         state_.CpuBankWritable[5] = false;
@@ -2093,16 +2385,16 @@ void Cart::UpdatePrgMapMMC5()
             if (bank)
             {
                 // TODO: what happens if the bank doesn't align with a 4k boundary?
-                state_.CpuBanks[4] = bank + (((state_.PrgBank1 & 0x03 & ~1) << 13) & prgRamMask_);
-                state_.CpuBanks[5] = bank + (((state_.PrgBank1 & 0x03 | 1) << 13) & prgRamMask_);
+                cpuBanks_[4] = bank + (((state_.PrgBank1 & 0x03 & ~1) << 13) & prgRamMask_);
+                cpuBanks_[5] = bank + (((state_.PrgBank1 & 0x03 | 1) << 13) & prgRamMask_);
 
                 state_.CpuBankWritable[4] = state_.PrgRamProtect0 == 0;
                 state_.CpuBankWritable[5] = state_.PrgRamProtect0 == 0;
             }
             else
             {
-                state_.CpuBanks[4] = nullptr;
-                state_.CpuBanks[5] = nullptr;
+                cpuBanks_[4] = nullptr;
+                cpuBanks_[5] = nullptr;
 
                 state_.CpuBankWritable[4] = false;
                 state_.CpuBankWritable[5] = false;
@@ -2111,16 +2403,16 @@ void Cart::UpdatePrgMapMMC5()
         else
         {
             auto baseLow = &prgData_[(state_.PrgBank1 & 0xffffc000)];
-            state_.CpuBanks[4] = baseLow;
-            state_.CpuBanks[5] = baseLow + 0x2000;
+            cpuBanks_[4] = baseLow;
+            cpuBanks_[5] = baseLow + 0x2000;
 
             state_.CpuBankWritable[4] = false;
             state_.CpuBankWritable[5] = false;
         }
 
         auto baseHigh = &prgData_[(state_.PrgBank3 & 0xffffc000)];
-        state_.CpuBanks[6] = baseHigh;
-        state_.CpuBanks[7] = baseHigh + 0x2000;
+        cpuBanks_[6] = baseHigh;
+        cpuBanks_[7] = baseHigh + 0x2000;
 
         state_.CpuBankWritable[6] = false;
         state_.CpuBankWritable[7] = false;
@@ -2136,16 +2428,16 @@ void Cart::UpdatePrgMapMMC5()
             if (bank)
             {
                 // TODO: what happens if the bank doesn't align with a 4k boundary?
-                state_.CpuBanks[4] = bank + (((state_.PrgBank1 & 0x03 & ~1) << 13) & prgRamMask_);
-                state_.CpuBanks[5] = bank + (((state_.PrgBank1 & 0x03 | 1) << 13) & prgRamMask_);
+                cpuBanks_[4] = bank + (((state_.PrgBank1 & 0x03 & ~1) << 13) & prgRamMask_);
+                cpuBanks_[5] = bank + (((state_.PrgBank1 & 0x03 | 1) << 13) & prgRamMask_);
 
                 state_.CpuBankWritable[4] = state_.PrgRamProtect0 == 0;
                 state_.CpuBankWritable[5] = state_.PrgRamProtect0 == 0;
             }
             else
             {
-                state_.CpuBanks[4] = nullptr;
-                state_.CpuBanks[5] = nullptr;
+                cpuBanks_[4] = nullptr;
+                cpuBanks_[5] = nullptr;
 
                 state_.CpuBankWritable[4] = false;
                 state_.CpuBankWritable[5] = false;
@@ -2154,34 +2446,34 @@ void Cart::UpdatePrgMapMMC5()
         else
         {
             auto baseLow = &prgData_[(state_.PrgBank1 & 0xffffc000)];
-            state_.CpuBanks[4] = baseLow;
-            state_.CpuBanks[5] = baseLow + 0x2000;
+            cpuBanks_[4] = baseLow;
+            cpuBanks_[5] = baseLow + 0x2000;
 
             state_.CpuBankWritable[4] = false;
             state_.CpuBankWritable[5] = false;
         }
 
-        MapPrgBankMMC5(state_.PrgBank2Ram, state_.PrgBank2, &state_.CpuBanks[6], &state_.CpuBankWritable[6]);
+        MapPrgBankMMC5(state_.PrgBank2Ram, state_.PrgBank2, &cpuBanks_[6], &state_.CpuBankWritable[6]);
 
 
-        state_.CpuBanks[7] = &prgData_[(state_.PrgBank3)];
+        cpuBanks_[7] = &prgData_[(state_.PrgBank3)];
         state_.CpuBankWritable[7] = false;
         break;
     }
 
     case 3:
     {
-        MapPrgBankMMC5(state_.PrgBank0Ram, state_.PrgBank0, &state_.CpuBanks[4], &state_.CpuBankWritable[4]);
-        MapPrgBankMMC5(state_.PrgBank1Ram, state_.PrgBank1, &state_.CpuBanks[5], &state_.CpuBankWritable[5]);
-        MapPrgBankMMC5(state_.PrgBank2Ram, state_.PrgBank2, &state_.CpuBanks[6], &state_.CpuBankWritable[6]);
+        MapPrgBankMMC5(state_.PrgBank0Ram, state_.PrgBank0, &cpuBanks_[4], &state_.CpuBankWritable[4]);
+        MapPrgBankMMC5(state_.PrgBank1Ram, state_.PrgBank1, &cpuBanks_[5], &state_.CpuBankWritable[5]);
+        MapPrgBankMMC5(state_.PrgBank2Ram, state_.PrgBank2, &cpuBanks_[6], &state_.CpuBankWritable[6]);
 
-        state_.CpuBanks[7] = &prgData_[(state_.PrgBank3)];
+        cpuBanks_[7] = &prgData_[(state_.PrgBank3)];
         state_.CpuBankWritable[7] = false;
     }
     }
 }
 
-void Cart::MapPrgBankMMC5(bool isRam, int32_t index, uint8_t** bank, bool* writable)
+void Cart::MapPrgBankMMC5(bool isRam, int32_t index, const uint8_t** bank, bool* writable)
 {
     if (isRam)
     {
@@ -2222,27 +2514,27 @@ void Cart::UpdateChrMapMMC5()
     {
     case 0:
     {
-        uint8_t* base;
+        const uint8_t* base;
         if (useSecondary)
             base = &chrData_[(state_.SecondaryChrBank3 << 13) & chrMask_];
         else
             base = &chrData_[(state_.ChrBank7 << 13) & chrMask_];
 
-        state_.PpuBanks[0] = base;
-        state_.PpuBanks[1] = base + 0x0400;
-        state_.PpuBanks[2] = base + 0x0800;
-        state_.PpuBanks[3] = base + 0x0c00;
-        state_.PpuBanks[4] = base + 0x1000;
-        state_.PpuBanks[5] = base + 0x1400;
-        state_.PpuBanks[6] = base + 0x1800;
-        state_.PpuBanks[7] = base + 0x1c00;
+        ppuBanks_[0] = base;
+        ppuBanks_[1] = base + 0x0400;
+        ppuBanks_[2] = base + 0x0800;
+        ppuBanks_[3] = base + 0x0c00;
+        ppuBanks_[4] = base + 0x1000;
+        ppuBanks_[5] = base + 0x1400;
+        ppuBanks_[6] = base + 0x1800;
+        ppuBanks_[7] = base + 0x1c00;
         break;
     }
 
     case 1:
     {
-        uint8_t* baseLow;
-        uint8_t* baseHigh;
+        const uint8_t* baseLow;
+        const uint8_t* baseHigh;
         if (useSecondary)
         {
             baseLow = baseHigh = &chrData_[(state_.SecondaryChrBank3 << 12) & chrMask_];
@@ -2253,23 +2545,23 @@ void Cart::UpdateChrMapMMC5()
             baseHigh = &chrData_[(state_.ChrBank7 << 12) & chrMask_];
         }
 
-        state_.PpuBanks[0] = baseLow;
-        state_.PpuBanks[1] = baseLow + 0x0400;
-        state_.PpuBanks[2] = baseLow + 0x0800;
-        state_.PpuBanks[3] = baseLow + 0x0c00;
-        state_.PpuBanks[4] = baseHigh;
-        state_.PpuBanks[5] = baseHigh + 0x0400;
-        state_.PpuBanks[6] = baseHigh + 0x0800;
-        state_.PpuBanks[7] = baseHigh + 0x0c00;
+        ppuBanks_[0] = baseLow;
+        ppuBanks_[1] = baseLow + 0x0400;
+        ppuBanks_[2] = baseLow + 0x0800;
+        ppuBanks_[3] = baseLow + 0x0c00;
+        ppuBanks_[4] = baseHigh;
+        ppuBanks_[5] = baseHigh + 0x0400;
+        ppuBanks_[6] = baseHigh + 0x0800;
+        ppuBanks_[7] = baseHigh + 0x0c00;
         break;
     }
 
     case 2:
     {
-        uint8_t* base0;
-        uint8_t* base1;
-        uint8_t* base2;
-        uint8_t* base3;
+        const uint8_t* base0;
+        const uint8_t* base1;
+        const uint8_t* base2;
+        const uint8_t* base3;
         if (useSecondary)
         {
             base0 = base2 = &chrData_[(state_.ChrBank3 << 11) & chrMask_];
@@ -2282,14 +2574,14 @@ void Cart::UpdateChrMapMMC5()
             base2 = &chrData_[(state_.ChrBank5 << 11) & chrMask_];
             base3 = &chrData_[(state_.ChrBank7 << 11) & chrMask_];
         }
-        state_.PpuBanks[0] = base0;
-        state_.PpuBanks[1] = base0 + 0x0400;
-        state_.PpuBanks[2] = base1;
-        state_.PpuBanks[3] = base1 + 0x0400;
-        state_.PpuBanks[4] = base2;
-        state_.PpuBanks[5] = base2 + 0x0400;
-        state_.PpuBanks[6] = base3;
-        state_.PpuBanks[7] = base3 + 0x0400;
+        ppuBanks_[0] = base0;
+        ppuBanks_[1] = base0 + 0x0400;
+        ppuBanks_[2] = base1;
+        ppuBanks_[3] = base1 + 0x0400;
+        ppuBanks_[4] = base2;
+        ppuBanks_[5] = base2 + 0x0400;
+        ppuBanks_[6] = base3;
+        ppuBanks_[7] = base3 + 0x0400;
         break;
     }
 
@@ -2297,25 +2589,25 @@ void Cart::UpdateChrMapMMC5()
     {
         if (useSecondary)
         {
-            state_.PpuBanks[0] = &chrData_[(state_.SecondaryChrBank0 << 10) & chrMask_];
-            state_.PpuBanks[1] = &chrData_[(state_.SecondaryChrBank1 << 10) & chrMask_];
-            state_.PpuBanks[2] = &chrData_[(state_.SecondaryChrBank2 << 10) & chrMask_];
-            state_.PpuBanks[3] = &chrData_[(state_.SecondaryChrBank3 << 10) & chrMask_];
-            state_.PpuBanks[4] = &chrData_[(state_.SecondaryChrBank0 << 10) & chrMask_];
-            state_.PpuBanks[5] = &chrData_[(state_.SecondaryChrBank1 << 10) & chrMask_];
-            state_.PpuBanks[6] = &chrData_[(state_.SecondaryChrBank2 << 10) & chrMask_];
-            state_.PpuBanks[7] = &chrData_[(state_.SecondaryChrBank3 << 10) & chrMask_];
+            ppuBanks_[0] = &chrData_[(state_.SecondaryChrBank0 << 10) & chrMask_];
+            ppuBanks_[1] = &chrData_[(state_.SecondaryChrBank1 << 10) & chrMask_];
+            ppuBanks_[2] = &chrData_[(state_.SecondaryChrBank2 << 10) & chrMask_];
+            ppuBanks_[3] = &chrData_[(state_.SecondaryChrBank3 << 10) & chrMask_];
+            ppuBanks_[4] = &chrData_[(state_.SecondaryChrBank0 << 10) & chrMask_];
+            ppuBanks_[5] = &chrData_[(state_.SecondaryChrBank1 << 10) & chrMask_];
+            ppuBanks_[6] = &chrData_[(state_.SecondaryChrBank2 << 10) & chrMask_];
+            ppuBanks_[7] = &chrData_[(state_.SecondaryChrBank3 << 10) & chrMask_];
         }
         else
         {
-            state_.PpuBanks[0] = &chrData_[(state_.ChrBank0 << 10) & chrMask_];
-            state_.PpuBanks[1] = &chrData_[(state_.ChrBank1 << 10) & chrMask_];
-            state_.PpuBanks[2] = &chrData_[(state_.ChrBank2 << 10) & chrMask_];
-            state_.PpuBanks[3] = &chrData_[(state_.ChrBank3 << 10) & chrMask_];
-            state_.PpuBanks[4] = &chrData_[(state_.ChrBank4 << 10) & chrMask_];
-            state_.PpuBanks[5] = &chrData_[(state_.ChrBank5 << 10) & chrMask_];
-            state_.PpuBanks[6] = &chrData_[(state_.ChrBank6 << 10) & chrMask_];
-            state_.PpuBanks[7] = &chrData_[(state_.ChrBank7 << 10) & chrMask_];
+            ppuBanks_[0] = &chrData_[(state_.ChrBank0 << 10) & chrMask_];
+            ppuBanks_[1] = &chrData_[(state_.ChrBank1 << 10) & chrMask_];
+            ppuBanks_[2] = &chrData_[(state_.ChrBank2 << 10) & chrMask_];
+            ppuBanks_[3] = &chrData_[(state_.ChrBank3 << 10) & chrMask_];
+            ppuBanks_[4] = &chrData_[(state_.ChrBank4 << 10) & chrMask_];
+            ppuBanks_[5] = &chrData_[(state_.ChrBank5 << 10) & chrMask_];
+            ppuBanks_[6] = &chrData_[(state_.ChrBank6 << 10) & chrMask_];
+            ppuBanks_[7] = &chrData_[(state_.ChrBank7 << 10) & chrMask_];
         }
         break;
     }
@@ -2346,7 +2638,7 @@ void Cart::UpdateNametableMMC5(uint32_t index, uint8_t mode)
     case 2:
         if (state_.ExtendedRamMode < 2)
         {
-            data = &state_.ExtendedRam[0];
+            data = &extendedRam_[0];
         }
         else
         {
@@ -2361,14 +2653,14 @@ void Cart::UpdateNametableMMC5(uint32_t index, uint8_t mode)
         break;
     }
 
-    state_.PpuBanks[8ULL + index] = state_.PpuBanks[12ULL + index] = data;
+    ppuBanks_[8ULL + index] = ppuBanks_[12ULL + index] = data;
 }
 
 void Cart::WriteAxROM(uint16_t address, uint8_t value)
 {
     if (busConflicts_)
     {
-        auto bank = state_.CpuBanks[address >> 13];
+        auto bank = cpuBanks_[address >> 13];
         value &= bank[address & 0x1fff];
     }
 
@@ -2380,10 +2672,10 @@ void Cart::WriteAxROM(uint16_t address, uint8_t value)
     }
 
     auto prgBank = &prgData_[((value & 0x07) << 15) & prgMask_];
-    state_.CpuBanks[4] = prgBank;
-    state_.CpuBanks[5] = prgBank + 0x2000;
-    state_.CpuBanks[6] = prgBank + 0x4000;
-    state_.CpuBanks[7] = prgBank + 0x6000;
+    cpuBanks_[4] = prgBank;
+    cpuBanks_[5] = prgBank + 0x2000;
+    cpuBanks_[6] = prgBank + 0x4000;
+    cpuBanks_[7] = prgBank + 0x6000;
 }
 
 void Cart::WriteMMC2(uint16_t address, uint8_t value)
@@ -2393,7 +2685,7 @@ void Cart::WriteMMC2(uint16_t address, uint8_t value)
     case 0xA:
     {
         auto prgBank = value & 0x0f;
-        state_.CpuBanks[4] = &prgData_[(prgBank << 13) & prgMask_];
+        cpuBanks_[4] = &prgData_[(prgBank << 13) & prgMask_];
         break;
     }
 
@@ -2472,15 +2764,15 @@ void Cart::UpdateChrMapMMC2()
     auto base0 = &chrData_[(bank0 << 12) & chrMask_];
     auto base1 = &chrData_[(bank1 << 12) & chrMask_];
 
-    state_.PpuBanks[0] = base0;
-    state_.PpuBanks[1] = base0 + 0x0400;
-    state_.PpuBanks[2] = base0 + 0x0800;
-    state_.PpuBanks[3] = base0 + 0x0c00;
+    ppuBanks_[0] = base0;
+    ppuBanks_[1] = base0 + 0x0400;
+    ppuBanks_[2] = base0 + 0x0800;
+    ppuBanks_[3] = base0 + 0x0c00;
 
-    state_.PpuBanks[4] = base1;
-    state_.PpuBanks[5] = base1 + 0x0400;
-    state_.PpuBanks[6] = base1 + 0x0800;
-    state_.PpuBanks[7] = base1 + 0x0c00;
+    ppuBanks_[4] = base1;
+    ppuBanks_[5] = base1 + 0x0400;
+    ppuBanks_[6] = base1 + 0x0800;
+    ppuBanks_[7] = base1 + 0x0c00;
 }
 
 void Cart::WriteColorDreams(uint16_t address, uint8_t value)
@@ -2489,7 +2781,7 @@ void Cart::WriteColorDreams(uint16_t address, uint8_t value)
     if (!busConflicts_)
         value |= 1;
 
-    auto bank = state_.CpuBanks[address >> 13];
+    auto bank = cpuBanks_[address >> 13];
     value &= bank[address & 0x1fff];
 
     bus_->SyncPpu();
@@ -2505,17 +2797,17 @@ void Cart::WriteCPROM(uint16_t address, uint8_t value)
 {
     if (busConflicts_)
     {
-        auto bank = state_.CpuBanks[address >> 13];
+        auto bank = cpuBanks_[address >> 13];
         value &= bank[address & 0x1fff];
     }
 
     bus_->SyncPpu();
 
     auto ppuBase = &chrData_[((value & 0x03) << 12) & chrMask_];
-    state_.PpuBanks[4] = ppuBase;
-    state_.PpuBanks[5] = ppuBase + 0x0400;
-    state_.PpuBanks[6] = ppuBase + 0x0800;
-    state_.PpuBanks[7] = ppuBase + 0x0c00;
+    ppuBanks_[4] = ppuBase;
+    ppuBanks_[5] = ppuBase + 0x0400;
+    ppuBanks_[6] = ppuBase + 0x0800;
+    ppuBanks_[7] = ppuBase + 0x0c00;
 }
 
 void Cart::WriteNINA001(uint16_t address, uint8_t value)
@@ -2525,10 +2817,10 @@ void Cart::WriteNINA001(uint16_t address, uint8_t value)
     case 0x7ffd:
     {
         auto base = &prgData_[((value & 0x01) << 15) & prgMask_];
-        state_.CpuBanks[4] = base;
-        state_.CpuBanks[5] = base + 0x2000;
-        state_.CpuBanks[6] = base + 0x4000;
-        state_.CpuBanks[7] = base + 0x6000;
+        cpuBanks_[4] = base;
+        cpuBanks_[5] = base + 0x2000;
+        cpuBanks_[6] = base + 0x4000;
+        cpuBanks_[7] = base + 0x6000;
         break;
     }
 
@@ -2536,10 +2828,10 @@ void Cart::WriteNINA001(uint16_t address, uint8_t value)
     {
         bus_->SyncPpu();
         auto base = &chrData_[((value & 0x0f) << 12) & chrMask_];
-        state_.PpuBanks[0] = base;
-        state_.PpuBanks[1] = base + 0x0400;
-        state_.PpuBanks[2] = base + 0x0800;
-        state_.PpuBanks[3] = base + 0x0c00;
+        ppuBanks_[0] = base;
+        ppuBanks_[1] = base + 0x0400;
+        ppuBanks_[2] = base + 0x0800;
+        ppuBanks_[3] = base + 0x0c00;
         break;
     }
 
@@ -2547,10 +2839,10 @@ void Cart::WriteNINA001(uint16_t address, uint8_t value)
     {
         bus_->SyncPpu();
         auto base = &chrData_[((value & 0x0f) << 12) & chrMask_];
-        state_.PpuBanks[4] = base;
-        state_.PpuBanks[5] = base + 0x0400;
-        state_.PpuBanks[6] = base + 0x0800;
-        state_.PpuBanks[7] = base + 0x0c00;
+        ppuBanks_[4] = base;
+        ppuBanks_[5] = base + 0x0400;
+        ppuBanks_[6] = base + 0x0800;
+        ppuBanks_[7] = base + 0x0c00;
         break;
     }
     }
@@ -2560,15 +2852,15 @@ void Cart::WriteBNROM(uint16_t address, uint8_t value)
 {
     if (busConflicts_)
     {
-        auto bank = state_.CpuBanks[address >> 13];
+        auto bank = cpuBanks_[address >> 13];
         value &= bank[address & 0x1fff];
     }
 
     auto base = &prgData_[((value & 0x03) << 15) & prgMask_];
-    state_.CpuBanks[4] = base;
-    state_.CpuBanks[5] = base + 0x2000;
-    state_.CpuBanks[6] = base + 0x4000;
-    state_.CpuBanks[7] = base + 0x6000;
+    cpuBanks_[4] = base;
+    cpuBanks_[5] = base + 0x2000;
+    cpuBanks_[6] = base + 0x4000;
+    cpuBanks_[7] = base + 0x6000;
 }
 
 void Cart::WriteCaltron6in1Low(uint16_t address)
@@ -2593,7 +2885,7 @@ void Cart::WriteCaltron6in1High(uint16_t address, uint8_t value)
 
     if (busConflicts_)
     {
-        auto bank = state_.CpuBanks[address >> 13];
+        auto bank = cpuBanks_[address >> 13];
         value &= bank[address & 0x1fff];
     }
 
@@ -2621,7 +2913,7 @@ void Cart::WriteRumbleStationHigh(uint16_t address, uint8_t value)
 {
     if (busConflicts_)
     {
-        auto bank = state_.CpuBanks[address >> 13];
+        auto bank = cpuBanks_[address >> 13];
         value &= bank[address & 0x1fff];
     }
 
@@ -2695,7 +2987,7 @@ void Cart::WriteRambo1(uint16_t address, uint8_t value)
             state_.IrqMode = value & 1;
             state_.ReloadCounter = true;
 
-            if (mapper_ == MapperType::Rambo1 || mapper_ == MapperType::Tengen800037)
+            if (IsMapper(MapperType::Rambo1) || IsMapper(MapperType::Tengen800037))
             {
                 bus_->Deschedule(SyncEvent::CartCpuIrqCounter);
 
@@ -2743,7 +3035,7 @@ void Cart::WriteGxROM(uint16_t address, uint8_t value)
 {
     if (busConflicts_)
     {
-        auto bank = state_.CpuBanks[address >> 13];
+        auto bank = cpuBanks_[address >> 13];
         value &= bank[address & 0x1fff];
     }
 
@@ -2815,11 +3107,11 @@ void Cart::WriteSunsoft4(uint16_t address, uint8_t value)
 
 void Cart::UpdatePrgMapSunsoft4()
 {
-    state_.CpuBanks[3] = state_.PrgRamEnabled ? prgRamBanks_[0] : nullptr;
+    cpuBanks_[3] = state_.PrgRamEnabled ? prgRamBanks_[0] : nullptr;
 
     auto cpuBase = &prgData_[(state_.PrgBankHighBits | state_.PrgBank0) & prgMask_];
-    state_.CpuBanks[4] = cpuBase;
-    state_.CpuBanks[5] = cpuBase + 0x2000;
+    cpuBanks_[4] = cpuBase;
+    cpuBanks_[5] = cpuBase + 0x2000;
 }
 
 void Cart::UpdateChrMapSunsoft4()
@@ -2828,14 +3120,14 @@ void Cart::UpdateChrMapSunsoft4()
     auto ppuBase1 = &chrData_[(state_.ChrBankHighBits | state_.ChrBank1) & chrMask_];
     auto ppuBase2 = &chrData_[(state_.ChrBankHighBits | state_.ChrBank2) & chrMask_];
     auto ppuBase3 = &chrData_[(state_.ChrBankHighBits | state_.ChrBank3) & chrMask_];
-    state_.PpuBanks[0] = ppuBase0;
-    state_.PpuBanks[1] = ppuBase0 + 0x0400;
-    state_.PpuBanks[2] = ppuBase1;
-    state_.PpuBanks[3] = ppuBase1 + 0x0400;
-    state_.PpuBanks[4] = ppuBase2;
-    state_.PpuBanks[5] = ppuBase2 + 0x0400;
-    state_.PpuBanks[6] = ppuBase3;
-    state_.PpuBanks[7] = ppuBase3 + 0x0400;
+    ppuBanks_[0] = ppuBase0;
+    ppuBanks_[1] = ppuBase0 + 0x0400;
+    ppuBanks_[2] = ppuBase1;
+    ppuBanks_[3] = ppuBase1 + 0x0400;
+    ppuBanks_[4] = ppuBase2;
+    ppuBanks_[5] = ppuBase2 + 0x0400;
+    ppuBanks_[6] = ppuBase3;
+    ppuBanks_[7] = ppuBase3 + 0x0400;
 }
 
 void Cart::UpdateNametableMapSunsoft4()
@@ -2852,31 +3144,31 @@ void Cart::UpdateNametableMapSunsoft4()
     switch (state_.MirrorMode)
     {
     case MirrorMode::SingleScreenLow:
-        state_.PpuBanks[8] = state_.PpuBanks[12] = base0;
-        state_.PpuBanks[9] = state_.PpuBanks[13] = base0;
-        state_.PpuBanks[10] = state_.PpuBanks[14] = base0;
-        state_.PpuBanks[11] = state_.PpuBanks[15] = base0;
+        ppuBanks_[8] = ppuBanks_[12] = base0;
+        ppuBanks_[9] = ppuBanks_[13] = base0;
+        ppuBanks_[10] = ppuBanks_[14] = base0;
+        ppuBanks_[11] = ppuBanks_[15] = base0;
         break;
 
     case MirrorMode::SingleScreenHigh:
-        state_.PpuBanks[8] = state_.PpuBanks[12] = base1;
-        state_.PpuBanks[9] = state_.PpuBanks[13] = base1;
-        state_.PpuBanks[10] = state_.PpuBanks[14] = base1;
-        state_.PpuBanks[11] = state_.PpuBanks[15] = base1;
+        ppuBanks_[8] = ppuBanks_[12] = base1;
+        ppuBanks_[9] = ppuBanks_[13] = base1;
+        ppuBanks_[10] = ppuBanks_[14] = base1;
+        ppuBanks_[11] = ppuBanks_[15] = base1;
         break;
 
     case MirrorMode::Vertical:
-        state_.PpuBanks[8] = state_.PpuBanks[12] = base0;
-        state_.PpuBanks[9] = state_.PpuBanks[13] = base1;
-        state_.PpuBanks[10] = state_.PpuBanks[14] = base0;
-        state_.PpuBanks[11] = state_.PpuBanks[15] = base1;
+        ppuBanks_[8] = ppuBanks_[12] = base0;
+        ppuBanks_[9] = ppuBanks_[13] = base1;
+        ppuBanks_[10] = ppuBanks_[14] = base0;
+        ppuBanks_[11] = ppuBanks_[15] = base1;
         break;
 
     case MirrorMode::Horizontal:
-        state_.PpuBanks[8] = state_.PpuBanks[12] = base0;
-        state_.PpuBanks[9] = state_.PpuBanks[13] = base0;
-        state_.PpuBanks[10] = state_.PpuBanks[14] = base1;
-        state_.PpuBanks[11] = state_.PpuBanks[15] = base1;
+        ppuBanks_[8] = ppuBanks_[12] = base0;
+        ppuBanks_[9] = ppuBanks_[13] = base0;
+        ppuBanks_[10] = ppuBanks_[14] = base1;
+        ppuBanks_[11] = ppuBanks_[15] = base1;
         break;
     }
 }
@@ -3048,28 +3340,30 @@ void Cart::UpdatePrgMapSunsoftFME7()
     if (state_.PrgBank0Ram)
     {
         // TODO: theoretically this can switch betweeen RAM banks
-        state_.CpuBanks[3] = state_.PrgRamEnabled ? prgRamBanks_[0] : nullptr;
+        cpuBanks_[3] = state_.PrgRamEnabled ? prgRamBanks_[0] : nullptr;
+        state_.CpuBankWritable[3] = true;
     }
     else
     {
-        state_.CpuBanks[3] = &prgData_[state_.PrgBank0];
+        cpuBanks_[3] = &prgData_[state_.PrgBank0];
+        state_.CpuBankWritable[3] = false;
     }
 
-    state_.CpuBanks[4] = &prgData_[state_.PrgBank1];
-    state_.CpuBanks[5] = &prgData_[state_.PrgBank2];
-    state_.CpuBanks[6] = &prgData_[state_.PrgBank3];
+    cpuBanks_[4] = &prgData_[state_.PrgBank1];
+    cpuBanks_[5] = &prgData_[state_.PrgBank2];
+    cpuBanks_[6] = &prgData_[state_.PrgBank3];
 }
 
 void Cart::UpdateChrMapSunsoftFME7()
 {
-    state_.PpuBanks[0] = &chrData_[state_.ChrBank0];
-    state_.PpuBanks[1] = &chrData_[state_.ChrBank1];
-    state_.PpuBanks[2] = &chrData_[state_.ChrBank2];
-    state_.PpuBanks[3] = &chrData_[state_.ChrBank3];
-    state_.PpuBanks[4] = &chrData_[state_.ChrBank4];
-    state_.PpuBanks[5] = &chrData_[state_.ChrBank5];
-    state_.PpuBanks[6] = &chrData_[state_.ChrBank6];
-    state_.PpuBanks[7] = &chrData_[state_.ChrBank7];
+    ppuBanks_[0] = &chrData_[state_.ChrBank0];
+    ppuBanks_[1] = &chrData_[state_.ChrBank1];
+    ppuBanks_[2] = &chrData_[state_.ChrBank2];
+    ppuBanks_[3] = &chrData_[state_.ChrBank3];
+    ppuBanks_[4] = &chrData_[state_.ChrBank4];
+    ppuBanks_[5] = &chrData_[state_.ChrBank5];
+    ppuBanks_[6] = &chrData_[state_.ChrBank6];
+    ppuBanks_[7] = &chrData_[state_.ChrBank7];
 }
 
 void Cart::WriteBF9097(uint16_t address, uint8_t value)
@@ -3188,15 +3482,15 @@ void Cart::UpdatePrgMapNesEvent()
     if (state_.PrgMode2 == 0)
     {
         if (!state_.PrgRamEnabled || prgRamBanks_.size() == 0)
-            state_.CpuBanks[3] = nullptr;
+            cpuBanks_[3] = nullptr;
         else
-            state_.CpuBanks[3] = prgRamBanks_[0];
+            cpuBanks_[3] = prgRamBanks_[0];
 
         auto cpuBase = &prgData_[state_.PrgBank1];
-        state_.CpuBanks[4] = cpuBase;
-        state_.CpuBanks[5] = cpuBase + 0x2000;
-        state_.CpuBanks[6] = cpuBase + 0x4000;
-        state_.CpuBanks[7] = cpuBase + 0x6000;
+        cpuBanks_[4] = cpuBase;
+        cpuBanks_[5] = cpuBase + 0x2000;
+        cpuBanks_[6] = cpuBase + 0x4000;
+        cpuBanks_[7] = cpuBase + 0x6000;
         return;
     }
 
@@ -3227,15 +3521,15 @@ void Cart::UpdateChrMapTQROM()
 
 void Cart::Set2kBankTQROM(int index, uint32_t bank)
 {
-    uint8_t* base;
+    const uint8_t* base;
     auto isRam = bank & 0x010000;
     if (isRam)
         base = &chrData_[chrRamStart_ + (bank & 0xf800 & chrRamMask_)];
     else
         base = &chrData_[bank & 0xf800 & chrMask_];
 
-    state_.PpuBanks[index] = base;
-    state_.PpuBanks[index + 1] = base + 0x400;
+    ppuBanks_[index] = base;
+    ppuBanks_[index + 1] = base + 0x400;
 
     state_.PpuBankWritable[index] = isRam;
     state_.PpuBankWritable[index + 1] = isRam;
@@ -3243,14 +3537,14 @@ void Cart::Set2kBankTQROM(int index, uint32_t bank)
 
 void Cart::Set1kBankTQROM(int index, uint32_t bank)
 {
-    uint8_t* base;
+    const uint8_t* base;
     auto isRam = bank & 0x010000;
     if (isRam)
         base = &chrData_[chrRamStart_ + (bank & 0xfc00 & chrRamMask_)];
     else
         base = &chrData_[bank & 0xfc00 & chrMask_];
 
-    state_.PpuBanks[index] = base;
+    ppuBanks_[index] = base;
     state_.PpuBankWritable[index] = isRam;
 }
 
@@ -3258,7 +3552,7 @@ void Cart::WriteSachenSA008A(uint16_t address, uint8_t value)
 {
     if (busConflicts_)
     {
-        auto bank = state_.CpuBanks[address >> 13];
+        auto bank = cpuBanks_[address >> 13];
         value &= bank[address & 0x1fff];
     }
 
@@ -3294,10 +3588,10 @@ void Cart::UpdatePrgMapActiveEnterprises()
         if (state_.PrgBankHighBits < 0x00180000)
         {
             // bank 2 is open bus
-            state_.CpuBanks[4] = nullptr;
-            state_.CpuBanks[5] = nullptr;
-            state_.CpuBanks[6] = nullptr;
-            state_.CpuBanks[7] = nullptr;
+            cpuBanks_[4] = nullptr;
+            cpuBanks_[5] = nullptr;
+            cpuBanks_[6] = nullptr;
+            cpuBanks_[7] = nullptr;
         }
         else
         {
@@ -3308,18 +3602,18 @@ void Cart::UpdatePrgMapActiveEnterprises()
     if (state_.PrgMode)
     {
         auto base = &prgData_[state_.PrgBankHighBits | state_.PrgBank0];
-        state_.CpuBanks[4] = base;
-        state_.CpuBanks[5] = base + 0x2000;
-        state_.CpuBanks[6] = base;
-        state_.CpuBanks[7] = base + 0x2000;
+        cpuBanks_[4] = base;
+        cpuBanks_[5] = base + 0x2000;
+        cpuBanks_[6] = base;
+        cpuBanks_[7] = base + 0x2000;
     }
     else
     {
         auto base = &prgData_[state_.PrgBankHighBits | ((state_.PrgBank0) & 0xffff8000) ];
-        state_.CpuBanks[4] = base;
-        state_.CpuBanks[5] = base + 0x2000;
-        state_.CpuBanks[6] = base + 0x4000;
-        state_.CpuBanks[7] = base + 0x6000;
+        cpuBanks_[4] = base;
+        cpuBanks_[5] = base + 0x2000;
+        cpuBanks_[6] = base + 0x4000;
+        cpuBanks_[7] = base + 0x6000;
     }
 }
 
@@ -3346,34 +3640,34 @@ void Cart::WriteAladdin(uint16_t address, uint8_t value)
 void Cart::UpdatePrgMapQuattro()
 {
     auto base0 = &prgData_[(state_.PrgBankHighBits | state_.PrgBank0) & prgMask_];
-    state_.CpuBanks[4] = base0;
-    state_.CpuBanks[5] = base0 + 0x2000;
+    cpuBanks_[4] = base0;
+    cpuBanks_[5] = base0 + 0x2000;
 
     auto base1 = &prgData_[(state_.PrgBankHighBits | 0xc000) & prgMask_];
-    state_.CpuBanks[6] = base1;
-    state_.CpuBanks[7] = base1 + 0x2000;
+    cpuBanks_[6] = base1;
+    cpuBanks_[7] = base1 + 0x2000;
 }
 
 void Cart::UpdatePrgMap32k()
 {
     auto cpuBase = &prgData_[(state_.PrgBankHighBits | state_.PrgBank0) & prgMask_];
-    state_.CpuBanks[4] = cpuBase;
-    state_.CpuBanks[5] = cpuBase + 0x2000;
-    state_.CpuBanks[6] = cpuBase + 0x4000;
-    state_.CpuBanks[7] = cpuBase + 0x6000;
+    cpuBanks_[4] = cpuBase;
+    cpuBanks_[5] = cpuBase + 0x2000;
+    cpuBanks_[6] = cpuBase + 0x4000;
+    cpuBanks_[7] = cpuBase + 0x6000;
 }
 
 void Cart::UpdateChrMap8k()
 {
     auto base = &chrData_[(state_.ChrBankHighBits | state_.ChrBank0) & chrMask_];
-    state_.PpuBanks[0] = base;
-    state_.PpuBanks[1] = base + 0x0400;
-    state_.PpuBanks[2] = base + 0x0800;
-    state_.PpuBanks[3] = base + 0x0c00;
-    state_.PpuBanks[4] = base + 0x1000;
-    state_.PpuBanks[5] = base + 0x1400;
-    state_.PpuBanks[6] = base + 0x1800;
-    state_.PpuBanks[7] = base + 0x1c00;
+    ppuBanks_[0] = base;
+    ppuBanks_[1] = base + 0x0400;
+    ppuBanks_[2] = base + 0x0800;
+    ppuBanks_[3] = base + 0x0c00;
+    ppuBanks_[4] = base + 0x1000;
+    ppuBanks_[5] = base + 0x1400;
+    ppuBanks_[6] = base + 0x1800;
+    ppuBanks_[7] = base + 0x1c00;
 }
 
 void Cart::UpdatePpuRamMap()
@@ -3382,45 +3676,48 @@ void Cart::UpdatePpuRamMap()
     switch (state_.MirrorMode)
     {
     case MirrorMode::SingleScreenLow:
-        state_.PpuBanks[8] = state_.PpuBanks[12] = base;
-        state_.PpuBanks[9] = state_.PpuBanks[13] = base;
-        state_.PpuBanks[10] = state_.PpuBanks[14] = base;
-        state_.PpuBanks[11] = state_.PpuBanks[15] = base;
+        ppuBanks_[8] = ppuBanks_[12] = base;
+        ppuBanks_[9] = ppuBanks_[13] = base;
+        ppuBanks_[10] = ppuBanks_[14] = base;
+        ppuBanks_[11] = ppuBanks_[15] = base;
         break;
 
     case MirrorMode::SingleScreenHigh:
-        state_.PpuBanks[8] = state_.PpuBanks[12] = base + 0x400;
-        state_.PpuBanks[9] = state_.PpuBanks[13] = base + 0x400;
-        state_.PpuBanks[10] = state_.PpuBanks[14] = base + 0x400;
-        state_.PpuBanks[11] = state_.PpuBanks[15] = base + 0x400;
+        ppuBanks_[8] = ppuBanks_[12] = base + 0x400;
+        ppuBanks_[9] = ppuBanks_[13] = base + 0x400;
+        ppuBanks_[10] = ppuBanks_[14] = base + 0x400;
+        ppuBanks_[11] = ppuBanks_[15] = base + 0x400;
         break;
 
     case MirrorMode::Vertical:
-        state_.PpuBanks[8] = state_.PpuBanks[12] = base;
-        state_.PpuBanks[9] = state_.PpuBanks[13] = base + 0x400;
-        state_.PpuBanks[10] = state_.PpuBanks[14] = base;
-        state_.PpuBanks[11] = state_.PpuBanks[15] = base + 0x400;
+        ppuBanks_[8] = ppuBanks_[12] = base;
+        ppuBanks_[9] = ppuBanks_[13] = base + 0x400;
+        ppuBanks_[10] = ppuBanks_[14] = base;
+        ppuBanks_[11] = ppuBanks_[15] = base + 0x400;
         break;
 
     case MirrorMode::Horizontal:
-        state_.PpuBanks[8] = state_.PpuBanks[12] = base;
-        state_.PpuBanks[9] = state_.PpuBanks[13] = base;
-        state_.PpuBanks[10] = state_.PpuBanks[14] = base + 0x400;
-        state_.PpuBanks[11] = state_.PpuBanks[15] = base + 0x400;
+        ppuBanks_[8] = ppuBanks_[12] = base;
+        ppuBanks_[9] = ppuBanks_[13] = base;
+        ppuBanks_[10] = ppuBanks_[14] = base + 0x400;
+        ppuBanks_[11] = ppuBanks_[15] = base + 0x400;
         break;
     }
 }
 
 std::unique_ptr<Cart> TryCreateCart(
     const CartDescriptor& desc,
-    std::vector<uint8_t> prgData,
-    std::vector<uint8_t> chrData)
+    std::span<const uint8_t> prgData,
+    std::span<const uint8_t> chrData,
+    std::shared_ptr<void> romStorage)
 {
     auto cart = std::make_unique<Cart>();
 
+    cart->SetRomStorage(std::move(romStorage));
+
     if (chrData.size() != 0)
     {
-        cart->SetChrRom(std::move(chrData));
+        cart->SetChrRom(chrData);
     }
 
     if (desc.ChrRamSize != 0)
@@ -3699,9 +3996,12 @@ std::unique_ptr<Cart> TryCreateCart(
     if (!prgSizeChecked && (prgData.size() & (prgData.size() - 1)))
         return nullptr; // non-zero power of 2 size expected
 
+    if (!IsMapperEnabled(mapper))
+        return nullptr; // compiled out of this build
+
     cart->SetMapper(mapper);
 
-    cart->SetPrgRom(std::move(prgData));
+    cart->SetPrgRom(prgData);
 
     if (desc.PrgRamSize != 0 && desc.PrgBatteryRamSize != 0 && desc.PrgRamSize != desc.PrgBatteryRamSize)
         return nullptr;
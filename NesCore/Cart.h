@@ -4,12 +4,15 @@
 #include "CartCoreState.h"
 #include "CartState.h"
 #include "ChrA12Sensitivity.h"
+#include "DirtyPages.h"
 #include "MapperType.h"
+#include "PpuFetchMode.h"
 
 
 #include <cstdint>
 #include <memory>
 #include <array>
+#include <span>
 #include <vector>
 
 class Bus;
@@ -20,16 +23,22 @@ public:
     Cart();
 
     void SetMapper(MapperType mapper);
-    void SetPrgRom(std::vector<uint8_t> prgData);
+    // the ROM images are not copied - the storage keeps them alive, and is shared with any other carts using them.
+    void SetRomStorage(std::shared_ptr<void> storage);
+    void SetPrgRom(std::span<const uint8_t> prgData);
     void SetPrgRam(uint32_t size);
     void AddPrgBatteryRam();
     void SetPrgBatteryRam(uint8_t* data);
-    void SetChrRom(std::vector<uint8_t> chrData);
+    void SetChrRom(std::span<const uint8_t> chrData);
     void AddChrRam(uint32_t size);
     void SetMirrorMode(MirrorMode mirrorMode);
     void EnableBusConflicts(bool conflicts);
 
     void Initialize();
+    // the CRC of the ROM images, as used to look the cart up in the game database.
+    uint32_t RomCrc32() const;
+    // returns the mapper to the state it was left in by Initialize, and clears any RAM that isn't battery-backed.
+    void PowerOn();
 
     void Attach(Bus* bus);
 
@@ -42,11 +51,21 @@ public:
     uint8_t PpuReadAttributes(uint16_t address);
     uint8_t PpuReadPatternLow(uint16_t address);
     uint8_t PpuReadPatternHigh(uint16_t address);
-    uint8_t PpuReadSpritePatternLow(uint16_t address);
     uint8_t PpuReadSpritePatternHigh(uint16_t address);
     uint16_t PpuReadPattern16(uint16_t address);
     void PpuWrite(uint16_t address, uint8_t value);
 
+    // the rendering fetches, specialised for the cart's fetch mode.  Only the fetches which have side effects in a
+    // mode go through these - the rest read the bank table returned by PpuBanks directly.
+    PpuFetchMode FetchMode() const;
+    const std::array<const uint8_t*, 16>& PpuBanks() const;
+    template <PpuFetchMode TMode> uint8_t PpuReadNametable(uint16_t address);
+    template <PpuFetchMode TMode> uint8_t PpuReadAttributes(uint16_t address);
+    template <PpuFetchMode TMode> uint8_t PpuReadPatternLow(uint16_t address);
+    template <PpuFetchMode TMode> uint8_t PpuReadPatternHigh(uint16_t address);
+    template <PpuFetchMode TMode> uint8_t PpuReadSpritePatternHigh(uint16_t address);
+    template <PpuFetchMode TMode> uint16_t PpuReadPattern16(uint16_t address);
+
     ChrA12Sensitivity ChrA12Sensitivity() const;
     void ChrA12Rising();
     void ChrA12Falling();
@@ -69,8 +88,19 @@ public:
 
     void CaptureState(CartState* state) const;
     void RestoreState(const CartState& state);
+    // false if the banks in a state which came from outside the process don't fit this cart's memory.
+    bool IsValidState(const CartState& state) const;
 
 private:
+    // false for mappers that have been compiled out, so the code for them can be discarded.
+    bool IsMapper(MapperType mapper) const;
+
+    uint8_t PpuReadBank(uint16_t address) const;
+    uint16_t PpuReadBank16(uint16_t address) const;
+
+    // writes through a CPU bank, which may be mapped to PRG-RAM.
+    void WritePrgRam(const uint8_t* address, uint8_t value);
+
     void WriteMMC1(uint16_t address, uint8_t value);
     void WriteMMC1Register(uint16_t address, uint8_t value);
     void UpdateChrMapMMC1();
@@ -89,7 +119,7 @@ private:
     uint8_t ReadMMC5(uint16_t address);
     void WriteMMC5(uint16_t address, uint8_t value);
     void UpdatePrgMapMMC5();
-    void MapPrgBankMMC5(bool isRam, int32_t index, uint8_t** bank, bool* writable);
+    void MapPrgBankMMC5(bool isRam, int32_t index, const uint8_t** bank, bool* writable);
     void UpdateChrMapMMC5();
     void UpdateNametableMapMMC5();
     void UpdateNametableMMC5(uint32_t index, uint8_t mode);
@@ -155,12 +185,20 @@ private:
 
     void UpdatePpuRamMap();
 
+    uint32_t BankToOffset(const uint8_t* bank) const;
+    const uint8_t* OffsetToBank(uint32_t offset) const;
+    bool IsValidBankOffset(uint32_t offset, uint32_t bankSize) const;
+
     Bus* bus_;
 
     MapperType mapper_;
 
-    std::vector<uint8_t> prgData_;
-    std::vector<uint8_t> chrData_;
+    std::shared_ptr<void> romStorage_;
+    std::span<const uint8_t> prgData_;
+    std::span<const uint8_t> chrData_;
+
+    // a copy of the CHR-ROM with the CHR-RAM appended, if the cart has CHR-RAM.
+    std::vector<uint8_t> localChrData_;
 
     uint32_t prgMask_;
     uint32_t prgBlockSize_;
@@ -169,6 +207,14 @@ private:
     uint32_t chrBlockSize_;
 
     CartCoreState state_;
+    CartCoreState initialState_;
+
+    // the CPU address space in 8K banks, and the PPU address space in 1K banks.  These point into this cart's memory, so
+    // they are kept out of the state, which stores them as offsets instead.
+    std::array<const uint8_t*, 8> cpuBanks_{};
+    std::array<const uint8_t*, 16> ppuBanks_{};
+    std::array<const uint8_t*, 8> initialCpuBanks_{};
+    std::array<const uint8_t*, 16> initialPpuBanks_{};
 
     std::vector<uint8_t> localPrgRam_;
     std::vector<uint8_t> localBatteryRam_;
@@ -179,9 +225,100 @@ private:
     int32_t chrRamStart_;
     uint32_t chrRamMask_;
     bool busConflicts_;
+
+    std::array<uint8_t, 0x400> extendedRam_{};
+
+    // the pages of RAM written since the last state capture
+    std::array<DirtyPages, 2> prgRamPages_;
+    DirtyPages chrRamPages_;
+    DirtyPages extendedRamPages_;
 };
 
 std::unique_ptr<Cart> TryCreateCart(
     const CartDescriptor& desc,
-    std::vector<uint8_t> prgData,
-    std::vector<uint8_t> chrData);
+    std::span<const uint8_t> prgData,
+    std::span<const uint8_t> chrData,
+    std::shared_ptr<void> romStorage);
+
+__forceinline bool Cart::IsMapper(MapperType mapper) const
+{
+    return IsMapperEnabled(mapper) && mapper_ == mapper;
+}
+
+__forceinline void Cart::WritePrgRam(const uint8_t* address, uint8_t value)
+{
+    // only called for banks mapped to RAM, never the read-only ROM.
+    auto data = const_cast<uint8_t*>(address);
+    *data = value;
+    prgRamPages_[0].Mark(data);
+    prgRamPages_[1].Mark(data);
+}
+
+__forceinline uint8_t Cart::PpuReadBank(uint16_t address) const
+{
+    auto bank = ppuBanks_[address >> 10];
+    return bank[address & 0x03ff];
+}
+
+__forceinline uint16_t Cart::PpuReadBank16(uint16_t address) const
+{
+    auto bank = ppuBanks_[address >> 10];
+    auto bankAddress = address & 0x03ff;
+    return (bank[bankAddress | 8] << 8) | bank[bankAddress];
+}
+
+template <PpuFetchMode TMode>
+__forceinline uint8_t Cart::PpuReadNametable(uint16_t address)
+{
+    static_assert(TMode == PpuFetchMode::MMC5, "the other fetch modes read the nametables through PpuBankView");
+    return PpuReadNametable(address);
+}
+
+template <PpuFetchMode TMode>
+__forceinline uint8_t Cart::PpuReadAttributes(uint16_t address)
+{
+    static_assert(TMode == PpuFetchMode::MMC5, "the other fetch modes read the attributes through PpuBankView");
+    return PpuReadAttributes(address);
+}
+
+template <PpuFetchMode TMode>
+__forceinline uint8_t Cart::PpuReadPatternLow(uint16_t address)
+{
+    static_assert(TMode == PpuFetchMode::MMC5, "the other fetch modes read the low bitplane through PpuBankView");
+    return PpuReadPatternLow(address);
+}
+
+template <PpuFetchMode TMode>
+__forceinline uint8_t Cart::PpuReadPatternHigh(uint16_t address)
+{
+    static_assert(TMode != PpuFetchMode::Banked, "banked fetches read through PpuBankView");
+
+    if constexpr (TMode == PpuFetchMode::MMC5)
+        return PpuReadPatternHigh(address);
+
+    PpuReadMMC2(address);
+    return PpuReadBank(address);
+}
+
+template <PpuFetchMode TMode>
+__forceinline uint8_t Cart::PpuReadSpritePatternHigh(uint16_t address)
+{
+    static_assert(TMode != PpuFetchMode::Banked, "banked fetches read through PpuBankView");
+
+    if constexpr (TMode == PpuFetchMode::Latched)
+        PpuReadMMC2(address);
+
+    return PpuReadBank(address);
+}
+
+template <PpuFetchMode TMode>
+__forceinline uint16_t Cart::PpuReadPattern16(uint16_t address)
+{
+    static_assert(TMode != PpuFetchMode::Banked, "banked fetches read through PpuBankView");
+
+    if constexpr (TMode == PpuFetchMode::MMC5)
+        return PpuReadPattern16(address);
+
+    PpuReadMMC2(address | 8);
+    return PpuReadBank16(address);
+}
@@ -8,7 +8,7 @@
 
 struct CartCoreState
 {
-    MirrorMode MirrorMode{ MirrorMode::Horizontal };
+    // the fields are ordered by size, so that the state is serialized without any padding.
 
     // MMC1 shift register
     uint32_t MapperShiftCount{};
@@ -24,9 +24,6 @@ struct CartCoreState
     uint32_t PrgBank2{};
     uint32_t PrgBank3{};
     uint32_t PrgBankHighBits{};
-    bool PrgBank0Ram{};
-    bool PrgBank1Ram{};
-    bool PrgBank2Ram{};
 
     uint32_t ChrMode{};
     uint32_t ChrBank0{};
@@ -42,15 +39,6 @@ struct CartCoreState
     uint32_t SecondaryChrBank2{};
     uint32_t SecondaryChrBank3{};
     uint32_t ChrBankHighBits{};
-    uint8_t ChrFillValue{};
-    uint8_t ChrFillAttributes{};
-    uint8_t NametableMode0{};
-    uint8_t NametableMode1{};
-    uint8_t NametableMode2{};
-    uint8_t NametableMode3{};
-    bool UseSecondaryChr0{};
-    bool UseSecondaryChr1{};
-    bool UseSecondaryChrForData{};
 
     uint32_t PrgPlane0{};
     uint32_t PrgPlane1{};
@@ -61,29 +49,58 @@ struct CartCoreState
     uint32_t PrgRamProtect1{};
 
     uint32_t ExtendedRamMode{};
-    uint8_t ExtendedAttribute{};
     uint32_t ExtendedPatternAddress{};
 
     ChrA12Sensitivity ChrA12Sensitivity{};
-    bool ChrA12{};
 
-    bool IrqEnabled{};
     uint32_t IrqMode{};
     uint32_t IrqCounter{};
     uint32_t ChrA12PulseCounter{};
     uint32_t LastA12Cycle{};
     uint32_t PrescalerResetCycle{};
+
+    uint32_t CpuCounterSyncCycle{};
+
+    uint32_t InterruptScanline{};
+
+    uint32_t CurrentTile{};
+    uint32_t SplitTile{};
+    uint32_t SplitScroll{};
+    uint32_t SplitY{};
+    uint32_t SplitBank{};
+
+    int InitializationState{};
+
+    MirrorMode MirrorMode{ MirrorMode::Horizontal };
+
+    bool PrgBank0Ram{};
+    bool PrgBank1Ram{};
+    bool PrgBank2Ram{};
+
+    uint8_t ChrFillValue{};
+    uint8_t ChrFillAttributes{};
+    uint8_t NametableMode0{};
+    uint8_t NametableMode1{};
+    uint8_t NametableMode2{};
+    uint8_t NametableMode3{};
+    bool UseSecondaryChr0{};
+    bool UseSecondaryChr1{};
+    bool UseSecondaryChrForData{};
+
+    uint8_t ExtendedAttribute{};
+
+    bool ChrA12{};
+
+    bool IrqEnabled{};
     bool BumpIrqCounter{};
 
     bool CpuCounterEnabled{};
-    uint32_t CpuCounterSyncCycle{};
 
     bool ReloadCounter{};
     uint8_t ReloadValue{};
 
     bool InFrame{};
     bool PpuInFrame{}; // can lag behind the other InFrame
-    uint32_t InterruptScanline{};
     bool IrqPending{};
 
     bool LargeSprites{};
@@ -93,28 +110,17 @@ struct CartCoreState
     bool SplitEnabled{};
     bool RightSplit{};
     bool InSprites{};
-    uint32_t CurrentTile{};
-    uint32_t SplitTile{};
-    uint32_t SplitScroll{};
-    uint32_t SplitY{};
-    uint32_t SplitBank{};
 
     uint8_t MulitplierArg0{};
     uint8_t MulitplierArg1{};
 
-    int InitializationState{};
-
-    // TODO: we should reconstruct these on restore, so we can share/save the state
-    // The CPU address space in 8k banks
-    std::array<uint8_t*, 8> CpuBanks{};
+    // whether each of the cart's 8K CPU banks and 1K PPU banks can be written.  The banks themselves are stored as
+    // offsets in CartState.
     std::array<bool, 8> CpuBankWritable{};
-
-    // The PPU address space in 1K banks
-    std::array<uint8_t*, 16> PpuBanks{};
     std::array<bool, 16> PpuBankWritable{};
 
     std::array<uint8_t, 4> PpuBankFillBytes{};
     std::array<uint8_t, 4> PPuBankAttributeBytes{};
 
-    std::array<uint8_t, 1024> ExtendedRam{};
-};
+    uint8_t Padding{};
+};
\ No newline at end of file
@@ -1,855 +1,974 @@
+#pragma once
+
+// generated by NesCartDbCompiler - do not edit.
+
+#include "CartDataEntry.h"
+
 #include <cstdint>
 
-const uint8_t CartData[] = 
+constexpr uint32_t CartDataSize = 850;
+
+constexpr int32_t CartDataDisplacements[] =
+{
+    0, 0, 1, 0, 0, 0, 0, -7,
+    0, 0, -8, -14, -18, 1, 1, -28,
+    -29, 0, -33, 0, -36, -37, -38, -42,
+    1, 0, 2, -44, -45, 1, 1, -48,
+    -49, 3, 1, -54, -56, -57, 0, -62,
+    0, 1, -65, 0, -67, 0, -68, -69,
+    0, 0, 1, 1, -70, 1, -71, 0,
+    1, 0, 0, 0, 0, 0, -72, 2,
+    0, 0, -78, 0, 0, 0, 2, 0,
+    -82, 0, 0, 1, 0, 1, 1, 0,
+    0, 5, -83, 0, 0, -84, -85, 2,
+    -86, 0, 0, 1, 0, -89, 0, 1,
+    3, 0, 1, -90, 0, 4, -92, 0,
+    1, 0, 0, -93, 0, 0, 0, -94,
+    2, 0, 1, 0, 2, 0, 3, 1,
+    -95, -99, 1, 0, -101, 0, 0, 1,
+    -104, 0, 0, 1, 0, 0, -109, 0,
+    0, -114, 0, 4, -116, 1, -118, 0,
+    -123, -125, 0, 0, 0, -127, 5, 2,
+    1, 1, -128, 0, -129, -130, -133, 0,
+    0, 3, -135, 3, -139, 0, 2, 0,
+    0, 0, 0, -141, 2, 0, 1, 1,
+    0, 0, 2, 1, 0, 1, -143, 0,
+    -144, 3, -146, -153, -159, 0, -160, 0,
+    0, -161, 0, -171, -172, 1, 0, 0,
+    1, 0, 0, 0, 0, 0, -174, 0,
+    2, -177, 1, 6, 2, -178, 0, 1,
+    0, 2, -179, 4, -181, -182, 1, 0,
+    3, 1, 0, 0, -183, -185, 0, -186,
+    0, 0, 0, -188, -192, 2, -194, -196,
+    0, 4, -197, -201, 1, 0, -202, 0,
+    -205, 2, 0, -206, 3, -207, 0, 0,
+    1, -208, 1, -209, -211, 0, 2, 0,
+    -216, -219, 2, -220, 1, 0, -222, -224,
+    0, 0, 0, -228, 3, -235, 1, -237,
+    0, 1, -239, 0, 0, 0, 0, -248,
+    0, -251, 2, 1, 0, 0, 1, -255,
+    3, 0, 0, -259, 0, -265, 4, -267,
+    0, -270, 0, 0, 2, 1, -271, -273,
+    -277, -281, 7, 0, 1, 0, 0, 0,
+    -288, 0, 0, -294, 1, 0, -295, 0,
+    0, 1, -296, -298, 0, -303, 0, 0,
+    0, 0, 1, -304, 0, 0, -308, -311,
+    0, 2, -314, -315, -316, 0, 0, -319,
+    -320, 0, 1, 1, 0, -322, 5, 1,
+    0, -324, 0, 1, -325, -328, -331, 3,
+    -332, 0, 4, -338, 4, -339, 1, 2,
+    5, -342, 0, 1, -349, -352, -353, 3,
+    5, 2, -354, 1, 4, 0, -358, -361,
+    -362, 1, 0, -366, -370, -379, -380, 0,
+    0, -382, 0, -384, 0, -385, 0, -389,
+    -391, 0, -393, 0, 0, 0, 1, 0,
+    1, 2, -394, 2, -399, -402, 1, -404,
+    -406, 0, 1, 1, -407, 0, 0, 4,
+    0, 0, -413, 0, 4, 1, 3, -414,
+    -415, 0, 2, -417, -418, 2, -420, 0,
+    -423, 4, -429, -432, 0, 0, -434, 1,
+    -441, 3, 0, 0, 1, 0, 1, 0,
+    -443, -444, -451, 2, -453, -455, 0, -457,
+    2, 1, 0, 1, -459, -466, 1, -468,
+    -469, 0, -470, 4, 2, -472, 0, -473,
+    4, 0, 1, 5, 5, 2, 0, -474,
+    -475, 3, 0, 0, -476, -477, 0, 1,
+    6, 5, 0, 0, 0, 11, 1, 0,
+    -479, 1, 1, 0, 0, -480, 1, 0,
+    -482, 0, 0, 0, -488, 0, 3, 0,
+    -494, 0, -495, -496, 0, 0, 1, -497,
+    0, 3, 0, 0, 10, 1, -502, 2,
+    0, 0, 1, -504, -511, 0, 2, 1,
+    1, 1, -512, 4, -513, 0, -518, -521,
+    0, 0, 8, 0, 0, 0, -522, 0,
+    0, 1, -527, 0, -528, -529, -531, 0,
+    -534, 0, 6, 0, 0, -535, 0, 1,
+    -537, 3, 0, -538, 0, -539, 0, 2,
+    0, -540, 9, 0, -543, 0, -544, 0,
+    0, -546, -547, 0, -550, -552, 0, 4,
+    -558, -563, -567, 2, 6, 0, 2, 6,
+    -572, 0, 3, 0, -573, 6, 7, 0,
+    0, -574, 2, 0, 0, 0, -576, 4,
+    1, 0, 1, 3, 0, -578, -582, 0,
+    -584, -586, 0, 1, 0, 1, -588, 2,
+    -593, -595, 1, -597, 0, -600, 3, 2,
+    2, -603, -604, -612, 2, -613, 0, 0,
+    2, 0, -616, 2, 0, -617, 0, -623,
+    0, 1, 0, 0, -629, -630, 2, 0,
+    4, -632, 1, -635, -639, -641, 5, 10,
+    8, 0, 0, 4, 0, 0, 0, 0,
+    1, 0, -642, 0, -643, 1, -645, 0,
+    2, 0, 0, -648, 0, 9, -649, -650,
+    0, -651, 0, 2, -654, 0, -660, 0,
+    0, -666, 0, -672, 0, 0, 6, 0,
+    -675, 1, -676, 0, 0, 0, 4, 3,
+    0, 6, -682, -683, 3, 15, -685, 0,
+    6, 0, -688, -689, 9, 4, 0, -690,
+    -694, -696, 0, -699, -701, -703, 2, -704,
+    3, 8, 27, 1, 3, 0, 0, 0,
+    0, -708, 0, -713, -715, 0, 0, 0,
+    -723, 0, 0, -736, -741, 0, -744, -746,
+    -747, 3, 6, 5, -748, 1, 0, -751,
+    -760, 0, -765, 0, 0, 0, -767, 0,
+    -773, 6, 0, 0, -780, -785, -788, -790,
+    -798, 2, 2, 0, 0, -799, 0, -805,
+    0, -808, 0, -814, 2, 8, -815, -816,
+    0, -818, 0, 3, 0, 0, -823, 6,
+    10, -827, -831, 1, 0, 0, -833, -837,
+    1, 1, 6, 0, 0, -845, 0, -846,
+    -847, 0,
+};
+
+constexpr CartDataEntry CartData[] =
 {
-    0x57, 0x47, 0x56, 0x3d, 0x00, 0x00, 
-    0xe3, 0x51, 0x12, 0x17, 0x00, 0x00, 
-    0xc7, 0xd5, 0xc6, 0x12, 0x02, 0x44, 
-    0xb2, 0x77, 0xa4, 0xe6, 0x02, 0x4c, 
-    0xe0, 0x45, 0xf7, 0x49, 0x01, 0x04, 
-    0xb6, 0xb3, 0x6a, 0x32, 0x04, 0x00, 
-    0x13, 0xd7, 0x34, 0xb1, 0x01, 0x00, 
-    0x53, 0x56, 0x3e, 0x06, 0x01, 0x00, 
-    0xae, 0x8e, 0x51, 0x65, 0x01, 0x00, 
-    0xa7, 0x08, 0x59, 0x2c, 0x04, 0x00, 
-    0xf3, 0x74, 0x75, 0xb1, 0x01, 0x02, 
-    0x39, 0x16, 0xe6, 0x5d, 0x01, 0x06, 
-    0x41, 0x21, 0x95, 0x25, 0x04, 0x02, 
-    0xbe, 0x13, 0xa7, 0xf8, 0x03, 0x48, 
-    0x5d, 0xd2, 0xbf, 0xbf, 0x04, 0x00, 
-    0x55, 0x88, 0x1c, 0x77, 0x04, 0x00, 
-    0x99, 0x60, 0xbd, 0x5d, 0x01, 0x00, 
-    0x94, 0x10, 0x75, 0x67, 0x01, 0x00, 
-    0x67, 0x32, 0xde, 0x9b, 0x03, 0x48, 
-    0x80, 0x38, 0x77, 0x55, 0x02, 0x4c, 
-    0x5f, 0x07, 0xbf, 0x71, 0x01, 0xa0, 
-    0x63, 0xd1, 0x92, 0x19, 0x04, 0x00, 
-    0x25, 0x27, 0xd9, 0x8d, 0x01, 0x00, 
-    0x69, 0x76, 0xee, 0xd8, 0x01, 0x00, 
-    0x77, 0xf5, 0x7c, 0x22, 0x04, 0x00, 
-    0xdd, 0xd8, 0x85, 0x6e, 0x01, 0x00, 
-    0xd4, 0x1c, 0xc4, 0x35, 0x01, 0x01, 
-    0xa2, 0xf6, 0x9e, 0x48, 0x01, 0xa0, 
-    0xa1, 0xd7, 0xc9, 0x5b, 0x01, 0x02, 
-    0x56, 0xda, 0xb0, 0xa8, 0x01, 0x00, 
-    0xac, 0x92, 0xe9, 0x63, 0x02, 0x44, 
-    0x97, 0xc2, 0x27, 0xc5, 0x04, 0x60, 
-    0x4a, 0xb1, 0x4d, 0x93, 0x01, 0x00, 
-    0x72, 0x07, 0xf9, 0xdb, 0x03, 0x40, 
-    0x68, 0x3a, 0xb4, 0xe2, 0x02, 0x4c, 
-    0xa8, 0xae, 0x73, 0x19, 0x01, 0x00, 
-    0x7e, 0xf5, 0xa9, 0x99, 0x01, 0xa0, 
-    0x46, 0xeb, 0x40, 0xc7, 0x07, 0x44, 
-    0xb9, 0xf1, 0x04, 0xf3, 0x02, 0x4c, 
-    0x83, 0x05, 0xfb, 0x32, 0x03, 0x40, 
-    0xf4, 0xd7, 0x25, 0x14, 0x03, 0x40, 
-    0xeb, 0xb4, 0x4c, 0x05, 0x04, 0x00, 
-    0x27, 0xf2, 0xdd, 0x27, 0x02, 0x4c, 
-    0x8f, 0xea, 0x71, 0x17, 0x03, 0x48, 
-    0x5f, 0x61, 0x6f, 0x7c, 0x01, 0x00, 
-    0x97, 0xa3, 0x5f, 0xa5, 0x03, 0x40, 
-    0x61, 0x32, 0xba, 0x37, 0x01, 0x00, 
-    0x7b, 0x71, 0x1d, 0x16, 0x04, 0x00, 
-    0xba, 0xfc, 0xda, 0x40, 0x01, 0x00, 
-    0x33, 0xb9, 0xe7, 0x1a, 0x01, 0x04, 
-    0xa8, 0x49, 0x13, 0x40, 0x00, 0x00, 
-    0x79, 0x69, 0xd4, 0x6c, 0x03, 0x48, 
-    0x0f, 0x6d, 0xfe, 0x15, 0x05, 0x03, 
-    0xe5, 0x49, 0xb2, 0x18, 0x01, 0x00, 
-    0x83, 0x1a, 0x82, 0x9b, 0x01, 0x06, 
-    0xf8, 0xa2, 0x18, 0x43, 0x01, 0x00, 
-    0x24, 0xbd, 0xdc, 0xaf, 0x00, 0x00, 
-    0x23, 0xa4, 0x6e, 0x1f, 0x01, 0x02, 
-    0xb6, 0x59, 0xd1, 0x40, 0x01, 0x02, 
-    0xd9, 0xf0, 0xa9, 0x18, 0x04, 0x02, 
-    0x66, 0xd3, 0xba, 0x6a, 0x01, 0x00, 
-    0xda, 0x3d, 0xca, 0x3e, 0x04, 0x00, 
-    0x1f, 0xb4, 0xf9, 0x28, 0x04, 0x00, 
-    0x1f, 0x17, 0xcf, 0xb9, 0x01, 0x00, 
-    0xaf, 0x46, 0xec, 0x03, 0x45, 0x01, 
-    0x7e, 0x61, 0xc6, 0x13, 0x04, 0x00, 
-    0x3d, 0xa2, 0x47, 0xc2, 0x04, 0x00, 
-    0xb4, 0xdf, 0x2d, 0x2c, 0x01, 0x04, 
-    0x6a, 0x00, 0x53, 0x6b, 0x01, 0x04, 
-    0xed, 0xc8, 0xcc, 0x50, 0x03, 0x40, 
-    0xdc, 0x10, 0x97, 0x27, 0x07, 0x44, 
-    0x06, 0x5b, 0xb6, 0xce, 0x07, 0x44, 
-    0x4c, 0xc5, 0x84, 0xeb, 0x07, 0x44, 
-    0xb8, 0x25, 0xa7, 0xa6, 0x02, 0x4c, 
-    0x8a, 0x64, 0x2e, 0xc4, 0x01, 0x00, 
-    0x3c, 0xed, 0xb6, 0xc4, 0x01, 0x00, 
-    0x2d, 0x67, 0x7d, 0x84, 0x04, 0x09, 
-    0x20, 0x47, 0x57, 0xd2, 0x01, 0x04, 
-    0x6b, 0x4d, 0x0f, 0x1d, 0x02, 0x4c, 
-    0x24, 0x2a, 0xb5, 0x8a, 0x02, 0x4c, 
-    0x64, 0xd7, 0x0f, 0x3f, 0x01, 0x00, 
-    0xd5, 0xef, 0x7b, 0xf3, 0x04, 0x00, 
-    0x20, 0xef, 0x2e, 0x9f, 0x02, 0x4c, 
-    0xb1, 0xaa, 0xd2, 0x5f, 0x04, 0x01, 
-    0x89, 0xcf, 0x9d, 0xdb, 0x00, 0x08, 
-    0x42, 0x5b, 0xbb, 0x1e, 0x01, 0x05, 
-    0x44, 0xff, 0x44, 0x4e, 0x04, 0x00, 
-    0x9e, 0xd9, 0xf4, 0xa8, 0x01, 0xa0, 
-    0xf1, 0x11, 0xa1, 0xdf, 0x04, 0x01, 
-    0x2a, 0xce, 0x0b, 0x5f, 0x01, 0x00, 
-    0xcd, 0xd2, 0xe8, 0xa5, 0x01, 0x00, 
-    0x22, 0x05, 0x90, 0x5e, 0x01, 0x00, 
-    0xf2, 0xc3, 0x95, 0xe0, 0x04, 0x00, 
-    0x9c, 0xe9, 0x9e, 0xe1, 0x04, 0x00, 
-    0x66, 0xbf, 0x6e, 0x12, 0x04, 0x01, 
-    0x30, 0x91, 0x0a, 0xe5, 0x01, 0x00, 
-    0xc4, 0x95, 0xa0, 0xa0, 0x03, 0x40, 
-    0x74, 0x88, 0x22, 0xce, 0x04, 0x00, 
-    0xe3, 0xd7, 0xf9, 0xda, 0x00, 0x00, 
-    0xef, 0x46, 0xf0, 0xbd, 0x07, 0x44, 
-    0xe5, 0x03, 0x1d, 0xdb, 0x02, 0x4c, 
-    0x02, 0xe3, 0x66, 0x2f, 0x02, 0x4c, 
-    0x88, 0x03, 0x25, 0xbe, 0x04, 0x0a, 
-    0xaf, 0xdd, 0xc7, 0x58, 0x04, 0x00, 
-    0x15, 0x49, 0x40, 0x0b, 0x04, 0x00, 
-    0x37, 0x6e, 0xd2, 0xef, 0x07, 0x44, 
-    0xc8, 0x88, 0xa6, 0x05, 0x02, 0x44, 
-    0x8d, 0x11, 0x29, 0x73, 0x02, 0x44, 
-    0xe2, 0xc9, 0xe6, 0x0a, 0x02, 0x4c, 
-    0xa9, 0x1f, 0x2d, 0x2f, 0x02, 0x4c, 
-    0x64, 0x66, 0x90, 0x12, 0x03, 0x48, 
-    0xfc, 0xc7, 0x68, 0xb6, 0x02, 0x4c, 
-    0x2d, 0xe4, 0x71, 0xc4, 0x01, 0x00, 
-    0xbe, 0x65, 0x24, 0xed, 0x05, 0x00, 
-    0xc3, 0x84, 0xea, 0xd1, 0x01, 0x00, 
-    0x05, 0x81, 0xc3, 0xea, 0x03, 0x48, 
-    0xfc, 0x41, 0xc6, 0xcd, 0x02, 0x4c, 
-    0x6b, 0xca, 0xf4, 0x19, 0x01, 0x01, 
-    0xb6, 0x9c, 0xf2, 0x8b, 0x01, 0x00, 
-    0xa7, 0x83, 0x57, 0xfc, 0x01, 0x00, 
-    0xeb, 0x37, 0x9e, 0xf9, 0x01, 0x00, 
-    0x16, 0x30, 0x83, 0x77, 0x00, 0x08, 
-    0x02, 0xfb, 0x52, 0xd1, 0x01, 0x00, 
-    0xb4, 0x66, 0x86, 0xae, 0x03, 0x48, 
-    0x28, 0xa8, 0xaf, 0x82, 0x01, 0x00, 
-    0x9f, 0xd4, 0xc0, 0xa3, 0x02, 0x4c, 
-    0x4e, 0xae, 0xc2, 0x57, 0x04, 0x00, 
-    0x40, 0x8d, 0xf6, 0x48, 0x00, 0x00, 
-    0xa9, 0xc7, 0x75, 0x2d, 0x01, 0x00, 
-    0x32, 0x4f, 0xad, 0xc8, 0x07, 0x24, 
-    0x13, 0x38, 0x31, 0xe2, 0x04, 0x00, 
-    0xfe, 0xbf, 0x23, 0x01, 0x02, 0x4c, 
-    0x24, 0x47, 0xbe, 0x82, 0x02, 0x44, 
-    0x85, 0x00, 0x00, 0xc6, 0x02, 0x44, 
-    0x07, 0x43, 0xcf, 0x32, 0x01, 0x01, 
-    0x9b, 0x21, 0xa5, 0x20, 0x04, 0x00, 
-    0x30, 0x50, 0x03, 0xf6, 0x02, 0x4c, 
-    0xb0, 0x91, 0x45, 0xa9, 0x04, 0x00, 
-    0x4c, 0xa0, 0x3a, 0xd7, 0x01, 0x00, 
-    0xe3, 0x6b, 0x8e, 0xd1, 0x04, 0x00, 
-    0x57, 0xc4, 0xf0, 0xc7, 0x04, 0x00, 
-    0x05, 0xcb, 0x35, 0x13, 0x04, 0x02, 
-    0xb6, 0x84, 0x05, 0xf0, 0x04, 0x02, 
-    0xd5, 0x8e, 0x33, 0x88, 0x04, 0x00, 
-    0xea, 0xcd, 0x8d, 0xac, 0x03, 0x48, 
-    0xbf, 0x2e, 0x38, 0x9e, 0x01, 0x00, 
-    0x07, 0x32, 0xb4, 0xc1, 0x07, 0x44, 
-    0x82, 0x81, 0x8b, 0x39, 0x01, 0x00, 
-    0xea, 0x2e, 0xce, 0x5d, 0x01, 0x00, 
-    0xa6, 0x1d, 0x81, 0x67, 0x03, 0x48, 
-    0x8c, 0xc5, 0x1a, 0x4d, 0x01, 0x00, 
-    0x41, 0xb4, 0x45, 0xe1, 0x01, 0x00, 
-    0x78, 0x86, 0x74, 0x12, 0x04, 0x00, 
-    0x30, 0x0c, 0x73, 0xc2, 0x22, 0x44, 
-    0xd0, 0x25, 0xaf, 0xa2, 0x00, 0x08, 
-    0xae, 0x71, 0xfb, 0x28, 0x01, 0x04, 
-    0xd3, 0xb2, 0x25, 0xa7, 0x04, 0x00, 
-    0x10, 0x1c, 0xd0, 0x43, 0x04, 0x02, 
-    0x1a, 0x69, 0x81, 0x46, 0x01, 0x00, 
-    0xcb, 0x97, 0xec, 0x68, 0x01, 0x01, 
-    0xee, 0x60, 0x99, 0xeb, 0x03, 0x48, 
-    0x52, 0xfb, 0x58, 0xa5, 0x01, 0x06, 
-    0x59, 0xc0, 0x38, 0xd7, 0x02, 0x4c, 
-    0xc9, 0xe7, 0x5d, 0x08, 0x01, 0x00, 
-    0x25, 0x6a, 0xb0, 0xdb, 0x00, 0x08, 
-    0x21, 0x0c, 0xee, 0x1c, 0x07, 0x44, 
-    0x63, 0x78, 0x2e, 0x0c, 0x04, 0x00, 
-    0x21, 0xc7, 0x97, 0x6f, 0x00, 0x00, 
-    0x0d, 0x4c, 0xd7, 0xb3, 0x00, 0x08, 
-    0x04, 0xc3, 0x64, 0x48, 0x00, 0x08, 
-    0x07, 0xb0, 0x04, 0x05, 0x00, 0x08, 
-    0x11, 0x8d, 0x37, 0x2b, 0x07, 0x24, 
-    0x48, 0xc0, 0x1c, 0x0f, 0x01, 0x00, 
-    0xef, 0x0a, 0x64, 0x8a, 0x04, 0x00, 
-    0xc6, 0x0c, 0xfd, 0x50, 0x04, 0x00, 
-    0x6b, 0x6f, 0xe9, 0xd0, 0x02, 0x4c, 
-    0x01, 0x09, 0x62, 0x73, 0x02, 0x4c, 
-    0x78, 0xba, 0x3f, 0x4d, 0x01, 0x00, 
-    0x55, 0x13, 0x58, 0xde, 0x01, 0xa0, 
-    0x8f, 0x54, 0x66, 0xa1, 0x01, 0x00, 
-    0xd9, 0x06, 0x1f, 0x81, 0x42, 0x08, 
-    0x03, 0x9c, 0xe2, 0xd7, 0x04, 0x00, 
-    0x4c, 0x21, 0x45, 0x25, 0x01, 0x02, 
-    0x4e, 0x78, 0x5a, 0x8c, 0x01, 0x06, 
-    0x18, 0x53, 0x6a, 0xa8, 0x01, 0x06, 
-    0x9d, 0x25, 0x6e, 0x50, 0x01, 0x06, 
-    0x3a, 0x3b, 0x03, 0xca, 0x02, 0x4c, 
-    0x91, 0x87, 0x59, 0x24, 0x00, 0x08, 
-    0x75, 0x90, 0xb0, 0xef, 0x02, 0x4c, 
-    0xf4, 0xfc, 0xc7, 0x73, 0x02, 0x4c, 
-    0x2d, 0xfb, 0xc3, 0x23, 0x01, 0x02, 
-    0xe4, 0x90, 0xb5, 0x38, 0x01, 0x00, 
-    0x99, 0x39, 0xe9, 0xbd, 0x01, 0x00, 
-    0x83, 0x72, 0xc8, 0x2a, 0x00, 0x00, 
-    0xdf, 0x0c, 0x9e, 0x05, 0x01, 0x00, 
-    0x2b, 0x76, 0x18, 0x9c, 0x05, 0x03, 
-    0xa6, 0xb3, 0xae, 0x49, 0x00, 0x08, 
-    0xd4, 0x62, 0x7e, 0x0a, 0x04, 0x00, 
-    0xd7, 0xa4, 0xca, 0x0b, 0x04, 0x00, 
-    0xea, 0xe3, 0xbe, 0x51, 0x01, 0xa0, 
-    0x2e, 0x3d, 0xf0, 0x45, 0x01, 0x02, 
-    0x68, 0xb2, 0x1d, 0xe7, 0x01, 0x04, 
-    0x1c, 0xe0, 0xaa, 0x2c, 0x04, 0x01, 
-    0xbe, 0xb4, 0x77, 0xce, 0x01, 0x00, 
-    0x37, 0x51, 0xbf, 0xb6, 0x01, 0x00, 
-    0x31, 0x2a, 0xbd, 0xce, 0x01, 0x06, 
-    0x8e, 0xc9, 0x34, 0xd5, 0x04, 0x00, 
-    0x43, 0x6c, 0x94, 0x38, 0x03, 0x48, 
-    0xcc, 0xe4, 0x7d, 0x26, 0x03, 0x48, 
-    0xa8, 0x2d, 0x76, 0xb9, 0x03, 0x48, 
-    0x83, 0x2c, 0xd7, 0x06, 0x02, 0x4c, 
-    0xf2, 0xe7, 0x2b, 0xf9, 0x02, 0x4c, 
-    0x79, 0x0d, 0xe2, 0x2f, 0x04, 0x00, 
-    0x9c, 0x4a, 0xb8, 0xda, 0x04, 0x00, 
-    0xb8, 0xd9, 0xfe, 0xf1, 0x02, 0x4c, 
-    0x72, 0x00, 0x18, 0x10, 0x01, 0x00, 
-    0xa8, 0x4d, 0x8b, 0x5a, 0x01, 0x02, 
-    0x63, 0x3e, 0x35, 0x20, 0x01, 0x00, 
-    0x4d, 0xec, 0x43, 0xe9, 0x01, 0x00, 
-    0x7e, 0xa8, 0x58, 0x3e, 0x01, 0x00, 
-    0x55, 0x58, 0xb1, 0xbe, 0x03, 0x48, 
-    0xe8, 0x0d, 0x6a, 0x57, 0x02, 0x4c, 
-    0xff, 0x93, 0x2d, 0x1d, 0x04, 0x00, 
-    0xb6, 0xed, 0x8d, 0x8c, 0x04, 0x00, 
-    0x0d, 0x7c, 0xb0, 0x1d, 0x00, 0x00, 
-    0xc6, 0xa5, 0x20, 0x1d, 0x04, 0x00, 
-    0x1b, 0x97, 0xe9, 0xf0, 0x04, 0x00, 
-    0x43, 0x8a, 0xd6, 0x90, 0x03, 0x40, 
-    0x51, 0x8c, 0x96, 0xec, 0xce, 0x10, 
-    0xdb, 0xcc, 0x71, 0x1b, 0x04, 0x01, 
-    0x23, 0xc0, 0xc6, 0x0e, 0x05, 0x02, 
-    0x0f, 0xc2, 0x25, 0x22, 0x01, 0x07, 
-    0x7e, 0xf3, 0x05, 0xaf, 0x04, 0x60, 
-    0x30, 0x61, 0x76, 0x04, 0x01, 0x02, 
-    0x68, 0x4b, 0x15, 0x6a, 0x03, 0x40, 
-    0x60, 0x76, 0xe9, 0x2a, 0x01, 0x00, 
-    0x9e, 0x87, 0xe4, 0xb4, 0x02, 0x4c, 
-    0x5a, 0x5d, 0xc2, 0x2b, 0x01, 0x00, 
-    0x73, 0x8f, 0x14, 0x84, 0x01, 0x00, 
-    0xc1, 0x73, 0xc7, 0x90, 0x76, 0x00, 
-    0x15, 0x6f, 0x38, 0x74, 0x01, 0x00, 
-    0x23, 0x29, 0xb3, 0x9f, 0x01, 0x00, 
-    0x9d, 0xc4, 0xd2, 0xe7, 0x00, 0x00, 
-    0xf0, 0x8a, 0x5f, 0xcf, 0x01, 0x00, 
-    0x9a, 0xf0, 0x32, 0xf5, 0x01, 0x00, 
-    0xb6, 0x77, 0x95, 0x99, 0x02, 0x4c, 
-    0x73, 0x91, 0x95, 0x4e, 0x03, 0x48, 
-    0x5e, 0x83, 0x0d, 0x35, 0x03, 0x48, 
-    0xdc, 0x7f, 0xff, 0x2d, 0x01, 0x00, 
-    0xb9, 0xf1, 0x52, 0x13, 0x01, 0x06, 
-    0x42, 0x6f, 0xd9, 0x0e, 0x04, 0x00, 
-    0x6b, 0x14, 0x43, 0xfa, 0x02, 0x4c, 
-    0x86, 0xd8, 0xec, 0x6d, 0x01, 0x00, 
-    0x01, 0xab, 0xb8, 0xbe, 0x42, 0x08, 
-    0x2b, 0xcb, 0x9d, 0xd1, 0x04, 0x00, 
-    0x32, 0x49, 0x78, 0xa8, 0x02, 0x44, 
-    0x32, 0x5a, 0x3a, 0x02, 0x00, 0x08, 
-    0x8c, 0xcc, 0x41, 0x1d, 0x03, 0x48, 
-    0x8d, 0xe9, 0x6e, 0x2e, 0x01, 0x00, 
-    0xb6, 0x69, 0x1b, 0x84, 0x01, 0x05, 
-    0x34, 0xb0, 0xea, 0x34, 0x04, 0x00, 
-    0x9e, 0x16, 0x15, 0xeb, 0x01, 0x00, 
-    0xbf, 0xab, 0x3c, 0x38, 0x77, 0x04, 
-    0x94, 0xd7, 0x24, 0xff, 0x00, 0x08, 
-    0x98, 0xe5, 0x69, 0x38, 0x02, 0x4c, 
-    0xa3, 0x36, 0x1d, 0xf3, 0x04, 0x01, 
-    0xb6, 0x41, 0x07, 0x2e, 0x04, 0x00, 
-    0x0e, 0x0d, 0x23, 0xd8, 0x01, 0x00, 
-    0x36, 0x50, 0x61, 0xf4, 0x01, 0x00, 
-    0x6d, 0x15, 0x4f, 0x5a, 0x01, 0x00, 
-    0x3a, 0x73, 0x77, 0x4e, 0x04, 0x00, 
-    0x23, 0x8b, 0xbf, 0x77, 0x00, 0x00, 
-    0x6e, 0xd4, 0x98, 0xfb, 0x00, 0x00, 
-    0x77, 0xca, 0x64, 0xae, 0x00, 0x08, 
-    0x20, 0x16, 0x7e, 0x56, 0x01, 0x00, 
-    0xa4, 0x3a, 0x27, 0x2d, 0x02, 0x44, 
-    0x10, 0x74, 0x46, 0x4f, 0x01, 0x04, 
-    0xa2, 0x23, 0x8f, 0x05, 0x04, 0x01, 
-    0x64, 0xc5, 0x89, 0x88, 0x04, 0x00, 
-    0x01, 0x0f, 0x0a, 0xa8, 0x04, 0x60, 
-    0x46, 0x51, 0xca, 0x8b, 0x01, 0x04, 
-    0x16, 0xcc, 0xa8, 0x2e, 0x02, 0x44, 
-    0xdb, 0x1a, 0xc8, 0xb4, 0x04, 0x00, 
-    0x3b, 0x96, 0x64, 0xdf, 0x04, 0x00, 
-    0xd2, 0xa4, 0x4e, 0xb1, 0x01, 0x00, 
-    0x6e, 0x04, 0x28, 0x23, 0x07, 0x24, 
-    0x1a, 0xa0, 0x44, 0x69, 0x04, 0x00, 
-    0x6b, 0x1b, 0x04, 0x4b, 0x07, 0x44, 
-    0x54, 0xef, 0x13, 0xc3, 0x02, 0x4c, 
-    0xa5, 0x03, 0x5b, 0x1d, 0x02, 0x4c, 
-    0x84, 0x17, 0xa4, 0x45, 0x04, 0x00, 
-    0x59, 0x8a, 0x89, 0xf6, 0x04, 0x00, 
-    0x54, 0x4a, 0xd1, 0x27, 0x03, 0x40, 
-    0xc7, 0x2a, 0x66, 0x2a, 0x07, 0x24, 
-    0xd9, 0x8d, 0xdd, 0x0b, 0x07, 0x24, 
-    0x9f, 0x57, 0x88, 0x6a, 0x07, 0x24, 
-    0x53, 0x1c, 0xf6, 0x2b, 0x04, 0x00, 
-    0x86, 0x5d, 0xe9, 0x00, 0x02, 0x4c, 
-    0x2c, 0x08, 0xd3, 0x26, 0x04, 0x00, 
-    0xb3, 0x2b, 0x32, 0xcf, 0x03, 0x48, 
-    0x71, 0x43, 0x3d, 0x30, 0x02, 0x4c, 
-    0xce, 0xed, 0xc4, 0xe2, 0x01, 0x00, 
-    0xf0, 0x7a, 0x38, 0xbe, 0x03, 0x40, 
-    0xfa, 0x9b, 0x17, 0x61, 0x04, 0x00, 
-    0x3b, 0x5b, 0x7f, 0x3b, 0x04, 0x01, 
-    0x92, 0xac, 0x74, 0x74, 0x04, 0x00, 
-    0xbd, 0x0d, 0x2b, 0xf4, 0x03, 0x40, 
-    0xa5, 0x48, 0x39, 0x98, 0x03, 0x48, 
-    0x3c, 0x2c, 0x8a, 0x54, 0xce, 0x00, 
-    0xe2, 0xdc, 0x10, 0xcd, 0x04, 0x00, 
-    0x3e, 0x83, 0x04, 0x51, 0x04, 0x00, 
-    0xa6, 0xd6, 0x7f, 0xd6, 0x01, 0x05, 
-    0x3e, 0xc4, 0xe7, 0x8e, 0x04, 0x01, 
-    0x85, 0xb9, 0x6b, 0xaa, 0x02, 0x4c, 
-    0x62, 0x55, 0x41, 0xa9, 0x01, 0x04, 
-    0x89, 0xca, 0xb4, 0x01, 0x03, 0x40, 
-    0x60, 0x79, 0x83, 0x00, 0x04, 0x01, 
-    0xbd, 0x34, 0x4b, 0xf5, 0x03, 0x48, 
-    0x21, 0xf2, 0xd6, 0x5e, 0x04, 0x02, 
-    0xc0, 0x2c, 0x3c, 0x56, 0x04, 0x00, 
-    0x14, 0xdb, 0xdf, 0xf4, 0x02, 0x44, 
-    0xc5, 0xe7, 0xcf, 0xeb, 0x01, 0x00, 
-    0x9b, 0x2e, 0x27, 0x03, 0x04, 0x00, 
-    0x8f, 0x4b, 0xdf, 0xa0, 0x04, 0x00, 
-    0x57, 0x42, 0xc6, 0xd5, 0x00, 0x08, 
-    0xd8, 0xa4, 0x74, 0xaa, 0x03, 0x40, 
-    0xe9, 0x0a, 0x48, 0xb0, 0x05, 0x00, 
-    0x04, 0x8a, 0xda, 0xe7, 0x04, 0x00, 
-    0x9f, 0x96, 0x53, 0xe3, 0x04, 0x00, 
-    0xe1, 0xf5, 0x97, 0x69, 0x03, 0x48, 
-    0xf4, 0xa5, 0xe1, 0x88, 0x01, 0x00, 
-    0x21, 0xc0, 0x81, 0xf1, 0x04, 0x00, 
-    0x6e, 0x6e, 0xed, 0xbb, 0x03, 0x40, 
-    0x72, 0xed, 0xf7, 0xea, 0x01, 0x06, 
-    0xad, 0x4c, 0x19, 0xa2, 0x02, 0x4c, 
-    0x0c, 0x56, 0xce, 0x05, 0x04, 0x00, 
-    0xfa, 0x29, 0x9f, 0xa6, 0x01, 0x00, 
-    0x75, 0xb0, 0x77, 0x70, 0x01, 0x00, 
-    0xa2, 0x85, 0xbc, 0xc4, 0x02, 0x4c, 
-    0xe1, 0x65, 0x9c, 0x85, 0x01, 0x00, 
-    0xef, 0x44, 0xe2, 0x3b, 0x02, 0x4c, 
-    0x56, 0x60, 0x4b, 0x5b, 0x04, 0x00, 
-    0xb9, 0xed, 0x7f, 0xbc, 0x04, 0x00, 
-    0xe2, 0x92, 0xe3, 0xb5, 0x04, 0x00, 
-    0xde, 0x76, 0x56, 0xaf, 0x00, 0x08, 
-    0x5e, 0x7f, 0xd1, 0x23, 0x04, 0x00, 
-    0x75, 0x6c, 0x8d, 0xfd, 0x02, 0x4c, 
-    0x33, 0x14, 0x99, 0x93, 0x04, 0x00, 
-    0x6d, 0x44, 0x8b, 0x98, 0x00, 0x08, 
-    0xdb, 0xf3, 0xeb, 0xb0, 0x04, 0x01, 
-    0x2f, 0x85, 0x39, 0x09, 0x01, 0x05, 
-    0x96, 0x18, 0xf3, 0x8f, 0x00, 0x08, 
-    0x91, 0x0a, 0x81, 0x38, 0x00, 0x08, 
-    0xc5, 0x41, 0x6e, 0x02, 0x04, 0x00, 
-    0xd6, 0x3c, 0x04, 0x8a, 0x04, 0x00, 
-    0x07, 0xe7, 0xb8, 0x5e, 0x01, 0x00, 
-    0xb5, 0xed, 0xc2, 0xc6, 0x01, 0x00, 
-    0x73, 0x71, 0x19, 0x92, 0x01, 0x00, 
-    0x63, 0xe8, 0xe2, 0x91, 0x04, 0x02, 
-    0x07, 0x96, 0x38, 0x81, 0x00, 0x00, 
-    0xce, 0xc1, 0xe6, 0x96, 0x03, 0x48, 
-    0xd1, 0x5b, 0x9f, 0x0d, 0x01, 0x06, 
-    0xf8, 0x38, 0xfc, 0x83, 0x04, 0x00, 
-    0x77, 0x47, 0x87, 0x09, 0x07, 0x24, 
-    0x9a, 0x94, 0xc3, 0xc4, 0x00, 0x00, 
-    0x1a, 0x97, 0x55, 0x20, 0x04, 0x00, 
-    0x2a, 0x7e, 0xdb, 0x55, 0x04, 0x00, 
-    0x8e, 0x00, 0xe6, 0x5e, 0x01, 0x00, 
-    0x0a, 0xbb, 0xe4, 0x6e, 0x02, 0x4c, 
-    0x4d, 0xc0, 0xcf, 0x0f, 0x01, 0x04, 
-    0x57, 0xaa, 0x3a, 0x60, 0x04, 0x00, 
-    0x4f, 0xe7, 0xa2, 0x18, 0x04, 0x04, 
-    0xe8, 0xf7, 0xdc, 0x3e, 0x04, 0x00, 
-    0xa8, 0x98, 0x87, 0x98, 0x04, 0x04, 
-    0xfd, 0x8a, 0x07, 0x12, 0x04, 0x00, 
-    0xec, 0x31, 0x74, 0x81, 0x02, 0x4c, 
-    0xf4, 0xbb, 0xac, 0xbc, 0x04, 0x00, 
-    0x07, 0x86, 0x37, 0x05, 0x01, 0x00, 
-    0x10, 0x08, 0x08, 0x70, 0x01, 0x05, 
-    0x10, 0x12, 0x2b, 0x94, 0x04, 0x00, 
-    0x51, 0x3d, 0x6a, 0x7c, 0x03, 0x48, 
-    0xe2, 0x49, 0xb3, 0x6f, 0x04, 0x00, 
-    0x38, 0xfb, 0x2d, 0x98, 0x04, 0x60, 
-    0xe6, 0x27, 0x2a, 0x53, 0x04, 0x02, 
-    0x5e, 0xe7, 0xc2, 0xaa, 0x03, 0x40, 
-    0x7c, 0x03, 0x78, 0x3f, 0x04, 0x00, 
-    0x14, 0x80, 0x81, 0x2c, 0x09, 0x00, 
-    0xce, 0xde, 0x52, 0xae, 0x00, 0x08, 
-    0x77, 0x32, 0x6a, 0x58, 0x03, 0x48, 
-    0xe4, 0x38, 0xc1, 0x92, 0x01, 0x01, 
-    0x3d, 0xbb, 0xc5, 0xe3, 0x04, 0x00, 
-    0x09, 0xac, 0x47, 0x97, 0x01, 0x00, 
-    0xcf, 0xe3, 0x42, 0xe5, 0x04, 0x00, 
-    0xc2, 0xe7, 0xb9, 0x02, 0x01, 0x00, 
-    0x4d, 0x8c, 0x69, 0x2f, 0x03, 0x48, 
-    0xbd, 0x26, 0x09, 0x0a, 0x01, 0x00, 
-    0x00, 0xd3, 0xd2, 0xb6, 0x00, 0x08, 
-    0x4d, 0xcb, 0x56, 0x71, 0x01, 0x04, 
-    0x18, 0x4c, 0xcb, 0x7d, 0x01, 0x00, 
-    0xa2, 0x8e, 0xd2, 0xb5, 0x03, 0x48, 
-    0x2a, 0x32, 0x37, 0x05, 0x07, 0x44, 
-    0x9c, 0x79, 0xb9, 0xf6, 0x01, 0x06, 
-    0xe0, 0xd9, 0xb4, 0xb9, 0x76, 0x00, 
-    0xbf, 0xfe, 0xb6, 0x35, 0x02, 0x4c, 
-    0x51, 0xa7, 0x51, 0x47, 0x01, 0x00, 
-    0x9a, 0xb5, 0x2c, 0xda, 0x07, 0x44, 
-    0xd6, 0xa3, 0x0c, 0xa6, 0x04, 0x00, 
-    0x94, 0x48, 0x1c, 0x3d, 0x04, 0x04, 
-    0xd8, 0x72, 0x4a, 0x7c, 0x01, 0x00, 
-    0x1c, 0x52, 0x80, 0xb7, 0x04, 0x00, 
-    0x68, 0x31, 0x2e, 0x90, 0x04, 0x00, 
-    0x73, 0x39, 0xcc, 0x02, 0x03, 0x48, 
-    0xd5, 0x03, 0x82, 0xff, 0x04, 0x00, 
-    0xa6, 0xdd, 0x42, 0x46, 0x01, 0x07, 
-    0xdb, 0x78, 0xe4, 0x8c, 0x05, 0x03, 
-    0xd0, 0x33, 0x9f, 0xae, 0x04, 0x01, 
-    0x2b, 0x66, 0xc3, 0xed, 0x01, 0x00, 
-    0xae, 0x4b, 0x8e, 0x95, 0x01, 0x00, 
-    0x85, 0xa0, 0x9f, 0x69, 0x00, 0x00, 
-    0x1f, 0x11, 0x56, 0x28, 0x01, 0x06, 
-    0x88, 0x5f, 0x25, 0x75, 0x01, 0x00, 
-    0x4f, 0xf4, 0xbb, 0xa9, 0x00, 0x00, 
-    0xce, 0xa0, 0xb6, 0x6b, 0x01, 0xa0, 
-    0xc6, 0xee, 0x5a, 0x43, 0x04, 0x00, 
-    0x26, 0x68, 0x08, 0x32, 0x03, 0x40, 
-    0xb1, 0x65, 0x09, 0x3a, 0x02, 0x44, 
-    0x4c, 0x09, 0x37, 0xcc, 0x01, 0x04, 
-    0x95, 0xf0, 0x02, 0xdc, 0x01, 0x00, 
-    0xeb, 0xdd, 0x9a, 0xd1, 0x77, 0x04, 
-    0xe9, 0xc2, 0x5d, 0x03, 0x00, 0x00, 
-    0x60, 0xd8, 0x38, 0x25, 0x01, 0x00, 
-    0x71, 0x78, 0xe7, 0xbc, 0x03, 0x48, 
-    0xb2, 0x96, 0x09, 0x3d, 0x01, 0x02, 
-    0xa2, 0x15, 0x55, 0x69, 0x01, 0x00, 
-    0xca, 0x0f, 0x86, 0x70, 0x00, 0x00, 
-    0xf4, 0x36, 0xf5, 0x5c, 0x04, 0x00, 
-    0x09, 0xb4, 0x73, 0xd2, 0x04, 0x00, 
-    0x40, 0x6e, 0x22, 0x90, 0x04, 0x00, 
-    0xe4, 0x65, 0xde, 0xa7, 0x01, 0x00, 
-    0x71, 0x37, 0xce, 0x70, 0x02, 0x4c, 
-    0x15, 0x66, 0x75, 0x56, 0x01, 0x04, 
-    0xaa, 0xe0, 0xf9, 0x41, 0x76, 0x00, 
-    0xd2, 0x10, 0xb7, 0x64, 0x02, 0x4c, 
-    0xd2, 0xd0, 0xf8, 0x27, 0x04, 0x00, 
-    0x3e, 0xb4, 0x0e, 0x6e, 0x02, 0x4c, 
-    0x3b, 0x13, 0x61, 0xeb, 0x03, 0x40, 
-    0x20, 0x35, 0xb2, 0xc0, 0x03, 0x48, 
-    0x94, 0xe5, 0xe4, 0x95, 0x01, 0x05, 
-    0xd4, 0x81, 0x5c, 0x3c, 0xce, 0x08, 
-    0x5c, 0x29, 0xed, 0xaa, 0x01, 0xa0, 
-    0x59, 0x21, 0xdd, 0x9e, 0x07, 0x44, 
-    0x89, 0x40, 0xcd, 0xec, 0x01, 0x00, 
-    0x9c, 0x3e, 0x9d, 0x8b, 0x01, 0x04, 
-    0x8b, 0x2e, 0x4b, 0x40, 0x04, 0x10, 
-    0x2c, 0xd5, 0x08, 0xd3, 0x00, 0x08, 
-    0x76, 0xdc, 0xa1, 0x9e, 0x02, 0x44, 
-    0x7c, 0x1d, 0xc4, 0xe1, 0x02, 0x4c, 
-    0xe5, 0xbb, 0x9d, 0x4f, 0x02, 0x4c, 
-    0xa0, 0xc8, 0x3a, 0x26, 0x04, 0x00, 
-    0x58, 0x67, 0x79, 0x26, 0x04, 0x00, 
-    0x9c, 0x11, 0x6c, 0x9f, 0x01, 0x00, 
-    0x43, 0xb9, 0x8a, 0xe9, 0x04, 0x00, 
-    0x1d, 0x8e, 0x56, 0xa0, 0x02, 0x4c, 
-    0xdd, 0xc0, 0xfc, 0x63, 0x01, 0x00, 
-    0x88, 0x26, 0xb6, 0x5b, 0xce, 0x08, 
-    0xec, 0x87, 0xc3, 0xe9, 0x04, 0x00, 
-    0x97, 0x34, 0xda, 0x8a, 0x01, 0x00, 
-    0x93, 0xc4, 0xcc, 0xc3, 0x01, 0x04, 
-    0xb9, 0x7a, 0x0b, 0x81, 0x02, 0x4c, 
-    0x6f, 0x54, 0x2d, 0x19, 0x04, 0x00, 
-    0xc0, 0x85, 0x09, 0x99, 0x01, 0x00, 
-    0x88, 0x79, 0x08, 0x96, 0x01, 0x00, 
-    0x2b, 0x02, 0x6e, 0x47, 0x04, 0x00, 
-    0x18, 0x71, 0xf7, 0x67, 0x01, 0x04, 
-    0xcc, 0xec, 0x6d, 0x1d, 0x01, 0x04, 
-    0x4c, 0xfd, 0x27, 0x89, 0x04, 0x00, 
-    0x2f, 0x6e, 0x4d, 0x39, 0x04, 0x60, 
-    0x6e, 0x5a, 0x63, 0x69, 0x01, 0x00, 
-    0xa9, 0xc0, 0x70, 0x23, 0x04, 0x60, 
-    0xc1, 0x97, 0x49, 0xaa, 0x04, 0x00, 
-    0x24, 0x20, 0x18, 0xc6, 0x01, 0x07, 
-    0x90, 0xe4, 0x11, 0xf0, 0x05, 0x42, 
-    0xd2, 0xcf, 0x4d, 0x6e, 0x04, 0x01, 
-    0x0f, 0xb9, 0x25, 0xde, 0x02, 0x4c, 
-    0xd5, 0x74, 0xc4, 0x37, 0x02, 0x4c, 
-    0x12, 0x9e, 0x18, 0x74, 0x01, 0x00, 
-    0xd2, 0x90, 0xec, 0x0f, 0x02, 0x4c, 
-    0x33, 0x39, 0xaa, 0x27, 0x00, 0x08, 
-    0xf6, 0x37, 0x94, 0x33, 0x01, 0xa0, 
-    0xde, 0xc2, 0x0f, 0xec, 0x01, 0xa0, 
-    0xed, 0xc7, 0xe1, 0xfd, 0x01, 0x00, 
-    0x2e, 0xa8, 0xf6, 0x5c, 0x01, 0x00, 
-    0x39, 0x0c, 0xd9, 0xdd, 0x04, 0x00, 
-    0x8a, 0x62, 0x1f, 0x6a, 0x04, 0x02, 
-    0x3d, 0xf7, 0x20, 0xaa, 0x04, 0x00, 
-    0xb3, 0xf3, 0x3b, 0xbe, 0x01, 0x06, 
-    0xbe, 0xb9, 0x1e, 0x85, 0x03, 0x48, 
-    0x95, 0xc0, 0x35, 0x64, 0x01, 0x00, 
-    0xd4, 0xa5, 0x4d, 0xdc, 0x02, 0x44, 
-    0x84, 0xeb, 0x43, 0xb8, 0x02, 0x4c, 
-    0xbb, 0x91, 0x4a, 0xe7, 0x01, 0x00, 
-    0xd9, 0xc0, 0xe1, 0xbe, 0x04, 0x01, 
-    0xf3, 0xca, 0x48, 0x52, 0x01, 0x00, 
-    0x3f, 0x90, 0x16, 0x74, 0x04, 0x60, 
-    0xd0, 0xb9, 0x91, 0x59, 0x04, 0x60, 
-    0x8e, 0xda, 0x3a, 0x42, 0x02, 0x4c, 
-    0xe4, 0x1b, 0x96, 0x06, 0x01, 0x00, 
-    0x11, 0xc2, 0xa6, 0xe9, 0x01, 0x00, 
-    0x5a, 0x10, 0x22, 0x33, 0x01, 0xa0, 
-    0x55, 0x2f, 0xfe, 0x9f, 0x01, 0x00, 
-    0x93, 0x0c, 0x67, 0x86, 0x00, 0x08, 
-    0x32, 0x4d, 0xe9, 0x6e, 0x04, 0x00, 
-    0x9b, 0x56, 0xf4, 0xfd, 0x01, 0xa0, 
-    0xd0, 0x04, 0xe9, 0x48, 0x01, 0x00, 
-    0x56, 0x32, 0x92, 0xa8, 0x01, 0x00, 
-    0x08, 0x62, 0xac, 0x1d, 0x01, 0x00, 
-    0x75, 0x78, 0x7f, 0x65, 0x00, 0x08, 
-    0x08, 0xba, 0x11, 0x81, 0x07, 0x44, 
-    0x95, 0x4e, 0x68, 0x40, 0x03, 0x40, 
-    0x71, 0x1b, 0xcf, 0xed, 0x07, 0x24, 
-    0x4a, 0xe1, 0x20, 0x22, 0x01, 0x04, 
-    0x91, 0x5a, 0xd1, 0x99, 0x00, 0x08, 
-    0x7a, 0x62, 0x79, 0xd6, 0x04, 0x60, 
-    0xfa, 0x9d, 0xae, 0xcf, 0x01, 0x05, 
-    0xb1, 0x7f, 0x19, 0xc7, 0x03, 0x40, 
-    0x12, 0x27, 0xa0, 0xc4, 0x00, 0x08, 
-    0x72, 0x41, 0xf3, 0x44, 0x00, 0x08, 
-    0xa1, 0xda, 0x67, 0xdf, 0x00, 0x00, 
-    0xfc, 0xe7, 0xe2, 0x62, 0x04, 0x00, 
-    0xa4, 0x08, 0xe4, 0xfc, 0x03, 0x48, 
-    0x1d, 0x5a, 0x2b, 0x26, 0x03, 0x48, 
-    0x0a, 0xa5, 0xeb, 0x16, 0x04, 0x00, 
-    0x7c, 0x68, 0x75, 0xe5, 0x02, 0x44, 
-    0x38, 0x33, 0x72, 0xb1, 0x03, 0x40, 
-    0x36, 0xe7, 0x0d, 0x24, 0x04, 0x00, 
-    0x6b, 0x63, 0xc3, 0xc1, 0x04, 0x01, 
-    0x94, 0x25, 0x43, 0x9f, 0x02, 0x4c, 
-    0xcb, 0x29, 0x91, 0x88, 0x04, 0x22, 
-    0x69, 0x7e, 0xdd, 0xc6, 0x01, 0x00, 
-    0xab, 0xb1, 0xb0, 0xc5, 0x02, 0x4c, 
-    0x67, 0x61, 0xd8, 0x61, 0x01, 0x00, 
-    0xd4, 0x51, 0xa6, 0x8d, 0x04, 0x00, 
-    0x06, 0x37, 0xee, 0x02, 0x01, 0x04, 
-    0x62, 0x4e, 0x5b, 0x30, 0x04, 0x00, 
-    0xd0, 0x61, 0x94, 0x41, 0x02, 0x4c, 
-    0xf9, 0x71, 0x99, 0x68, 0x01, 0x00, 
-    0x5d, 0x37, 0xcf, 0xef, 0x02, 0x4c, 
-    0xa2, 0x87, 0x44, 0xcf, 0x01, 0x00, 
-    0x98, 0xf6, 0x45, 0xd4, 0x00, 0x08, 
-    0xce, 0x4a, 0x59, 0xca, 0x04, 0x01, 
-    0xed, 0x01, 0x63, 0x2e, 0x04, 0x01, 
-    0x14, 0x53, 0x9c, 0x97, 0x02, 0x4c, 
-    0x21, 0xfd, 0x40, 0xe8, 0x04, 0x00, 
-    0x5e, 0x44, 0x41, 0xab, 0x04, 0x00, 
-    0x19, 0x27, 0x4b, 0xd7, 0x03, 0x48, 
-    0xa4, 0xc4, 0xa8, 0x1f, 0x01, 0x00, 
-    0x1d, 0x4e, 0xff, 0xa1, 0x01, 0x00, 
-    0x83, 0x54, 0x5e, 0x46, 0x04, 0x00, 
-    0x46, 0xec, 0x17, 0x34, 0x02, 0x4c, 
-    0xaf, 0x79, 0x2c, 0x48, 0x01, 0xa0, 
-    0xf2, 0x0a, 0x25, 0xbf, 0x00, 0x00, 
-    0x98, 0xeb, 0x8e, 0x79, 0x01, 0x00, 
-    0x82, 0x95, 0xb4, 0x93, 0x01, 0x00, 
-    0x4f, 0xa3, 0x12, 0xad, 0x01, 0x04, 
-    0xd5, 0xc0, 0xa6, 0x85, 0x01, 0x00, 
-    0x39, 0x78, 0x6d, 0x69, 0x01, 0x00, 
-    0xf4, 0x4a, 0x8e, 0xda, 0x04, 0x02, 
-    0x57, 0x0d, 0x9a, 0x17, 0x04, 0x02, 
-    0x19, 0x62, 0xf7, 0x7f, 0x01, 0x00, 
-    0xdd, 0x4e, 0x96, 0x86, 0x04, 0x00, 
-    0x8e, 0x1d, 0x92, 0xee, 0x01, 0x00, 
-    0xa2, 0x7e, 0x21, 0xa9, 0x04, 0x00, 
-    0x49, 0x79, 0x6d, 0xbb, 0x04, 0x00, 
-    0x1a, 0xe2, 0xd9, 0xd4, 0x00, 0x00, 
-    0x77, 0xb4, 0x27, 0xea, 0x04, 0x60, 
-    0x49, 0xc5, 0x72, 0x62, 0x04, 0x00, 
-    0x7f, 0xb5, 0x46, 0x2a, 0x02, 0x44, 
-    0x7e, 0xf5, 0x94, 0x13, 0x01, 0xa0, 
-    0x19, 0x79, 0x53, 0x9c, 0x04, 0x01, 
-    0xea, 0xd2, 0x8c, 0x53, 0x01, 0x00, 
-    0xbc, 0x44, 0x0b, 0xd8, 0x42, 0x00, 
-    0xc3, 0x2d, 0xdc, 0x2d, 0x01, 0x00, 
-    0xd6, 0x6d, 0xb4, 0xaf, 0x02, 0x44, 
-    0x68, 0xa5, 0xc7, 0xc3, 0x03, 0x40, 
-    0xa4, 0xb1, 0xd5, 0x13, 0x07, 0x44, 
-    0xb4, 0xfe, 0x86, 0x0f, 0x02, 0x4c, 
-    0x04, 0xdb, 0xdd, 0x99, 0x04, 0x00, 
-    0x65, 0xeb, 0xa5, 0x81, 0x04, 0x00, 
-    0xa4, 0x92, 0x60, 0x9e, 0x04, 0x01, 
-    0x35, 0xd9, 0x8f, 0xde, 0x04, 0x00, 
-    0x43, 0x4a, 0xb7, 0x7f, 0x04, 0x00, 
-    0xf5, 0x30, 0x3b, 0xd6, 0x04, 0x00, 
-    0xb3, 0x96, 0xd2, 0x50, 0x01, 0x04, 
-    0xe8, 0xf3, 0x8a, 0x6f, 0x04, 0x00, 
-    0x7a, 0x0d, 0x6d, 0xcf, 0x02, 0x44, 
-    0xa7, 0x66, 0x85, 0x24, 0x02, 0x4c, 
-    0x55, 0xd5, 0x29, 0xb6, 0x04, 0x00, 
-    0x9e, 0xb6, 0x4e, 0xea, 0x01, 0x00, 
-    0xec, 0xfb, 0x57, 0x7e, 0x04, 0x60, 
-    0x2e, 0xf7, 0xbf, 0xd3, 0x03, 0x48, 
-    0xd2, 0xdd, 0x09, 0xf0, 0x04, 0x00, 
-    0x71, 0x35, 0x9f, 0x9c, 0x03, 0x48, 
-    0xe7, 0x91, 0xa1, 0x7f, 0x01, 0x00, 
-    0x0c, 0x58, 0x18, 0xb9, 0x01, 0x00, 
-    0xeb, 0x92, 0x68, 0xee, 0x02, 0x4c, 
-    0x86, 0x5c, 0x3e, 0xfc, 0x02, 0x4c, 
-    0xe7, 0x30, 0xf7, 0x0e, 0x04, 0x00, 
-    0x49, 0xa1, 0x26, 0xcf, 0x02, 0x4c, 
-    0x17, 0x20, 0x06, 0xa4, 0x01, 0x06, 
-    0x0f, 0x75, 0x5a, 0xa2, 0x01, 0x06, 
-    0xfe, 0xee, 0x23, 0x48, 0x01, 0x06, 
-    0x7f, 0xc7, 0x87, 0xe3, 0x04, 0x00, 
-    0x71, 0xe1, 0x6c, 0x9f, 0x04, 0x00, 
-    0x92, 0xef, 0x41, 0x2d, 0x02, 0x4c, 
-    0x43, 0x56, 0xa1, 0xac, 0x05, 0x03, 
-    0xef, 0x73, 0xac, 0x9b, 0x04, 0x02, 
-    0xeb, 0x95, 0xc7, 0x20, 0x01, 0x00, 
-    0x65, 0x42, 0x6d, 0x65, 0x00, 0x08, 
-    0x9d, 0x69, 0x73, 0xc9, 0x01, 0x01, 
-    0xa6, 0x68, 0x37, 0x75, 0x04, 0x00, 
-    0xea, 0xea, 0x66, 0x5e, 0x0d, 0x0c, 
-    0x35, 0x76, 0x77, 0x27, 0x00, 0x08, 
-    0xf7, 0x21, 0x15, 0x40, 0x04, 0x00, 
-    0xda, 0x1b, 0x66, 0xb6, 0x02, 0x44, 
-    0xd7, 0x75, 0x9a, 0xf7, 0x04, 0x02, 
-    0xf1, 0xd3, 0xf0, 0x15, 0x02, 0x4c, 
-    0x0f, 0x00, 0xcd, 0xb0, 0x04, 0x00, 
-    0x10, 0xd4, 0xa7, 0x5e, 0x04, 0x00, 
-    0xa0, 0x48, 0x3c, 0x33, 0x04, 0x00, 
-    0xbe, 0xf6, 0x9a, 0x00, 0x07, 0x24, 
-    0x07, 0x36, 0x38, 0x68, 0x07, 0x24, 
-    0xfb, 0xf7, 0x68, 0x33, 0x07, 0x24, 
-    0x70, 0xc1, 0x20, 0x42, 0x07, 0x24, 
-    0xd8, 0x70, 0x77, 0x91, 0x04, 0x01, 
-    0x3d, 0x3a, 0x46, 0xc3, 0x04, 0x01, 
-    0x61, 0xc3, 0xb2, 0x12, 0x07, 0x24, 
-    0x71, 0xa2, 0xd5, 0x6f, 0x04, 0x00, 
-    0xa2, 0x81, 0xc9, 0xe7, 0x04, 0x00, 
-    0x21, 0xdc, 0x12, 0x51, 0x00, 0x08, 
-    0x7f, 0x7e, 0x3e, 0x10, 0x01, 0x00, 
-    0x91, 0xfc, 0x4d, 0xf7, 0x01, 0x04, 
-    0xe4, 0xf9, 0x9e, 0x96, 0x02, 0x44, 
-    0x2f, 0x3d, 0xc3, 0x6b, 0x04, 0x02, 
-    0x2c, 0x57, 0xbb, 0xd9, 0x01, 0x02, 
-    0xf5, 0x5e, 0x53, 0x26, 0x07, 0x24, 
-    0x72, 0x20, 0x56, 0xd2, 0x07, 0x44, 
-    0x87, 0x6e, 0x47, 0x35, 0x04, 0x00, 
-    0xad, 0xe5, 0x93, 0x85, 0x04, 0x00, 
-    0xea, 0x10, 0x40, 0xaf, 0x03, 0x40, 
-    0xf9, 0xa8, 0x13, 0xf6, 0x07, 0x24, 
-    0xb9, 0x23, 0x87, 0x3a, 0x01, 0x00, 
-    0x48, 0x6a, 0x50, 0x9b, 0x00, 0x00, 
-    0x10, 0x36, 0x80, 0xeb, 0x04, 0x00, 
-    0xbb, 0xd0, 0x4e, 0x7b, 0x04, 0x60, 
-    0x79, 0x1b, 0x61, 0xd4, 0x04, 0x60, 
-    0x39, 0x80, 0x13, 0x37, 0x07, 0x24, 
-    0x75, 0x0d, 0x23, 0xa0, 0x02, 0x4c, 
-    0xb8, 0x96, 0x18, 0x71, 0x01, 0x00, 
-    0x27, 0x0e, 0xd7, 0xdf, 0x00, 0x00, 
-    0xe6, 0x2f, 0x61, 0xb1, 0x01, 0x00, 
-    0xfc, 0x41, 0xd1, 0x50, 0x01, 0x00, 
-    0x3b, 0xd9, 0xea, 0xe7, 0x01, 0x00, 
-    0x32, 0x87, 0xb5, 0x52, 0x04, 0x00, 
-    0x74, 0xf5, 0xc6, 0x35, 0x04, 0x00, 
-    0x10, 0xaa, 0x92, 0xe2, 0x02, 0x44, 
-    0x65, 0x28, 0x32, 0xba, 0x01, 0x02, 
-    0xfd, 0x8b, 0x57, 0xd8, 0x04, 0x00, 
-    0xb0, 0xff, 0x54, 0xd0, 0x04, 0x22, 
-    0xb6, 0x57, 0xfb, 0x03, 0x04, 0x00, 
-    0x54, 0xa6, 0x6c, 0x5b, 0x01, 0x00, 
-    0xf2, 0x19, 0xee, 0xda, 0x01, 0x00, 
-    0xcc, 0x1f, 0x24, 0xb4, 0x01, 0x00, 
-    0x58, 0xdd, 0x18, 0xf5, 0x07, 0x44, 
-    0x8f, 0xaa, 0xc1, 0x0a, 0x02, 0x4c, 
-    0x0c, 0x32, 0xf6, 0xd7, 0x01, 0x01, 
-    0xdd, 0x74, 0xc7, 0x13, 0x04, 0x00, 
-    0x69, 0x7b, 0x7e, 0x43, 0x02, 0x4c, 
-    0x41, 0x2f, 0x8c, 0x19, 0x01, 0xa0, 
-    0xf0, 0x88, 0x3f, 0x3b, 0x01, 0x02, 
-    0xd1, 0x23, 0xdd, 0x57, 0x01, 0x04, 
-    0xfc, 0xdb, 0x5e, 0xca, 0x04, 0x01, 
-    0xcd, 0x99, 0xf8, 0x03, 0x04, 0x00, 
-    0xed, 0xfe, 0x5e, 0x65, 0x02, 0x44, 
-    0x57, 0x1a, 0xc3, 0xa0, 0x04, 0x00, 
-    0x5c, 0x0d, 0xd1, 0xb5, 0x07, 0x24, 
-    0xd8, 0x45, 0xa1, 0xac, 0x03, 0x40, 
-    0x9f, 0x74, 0xf0, 0xd9, 0x01, 0x05, 
-    0xe7, 0xd2, 0x92, 0x81, 0x01, 0x04, 
-    0xfc, 0x4a, 0x79, 0xd7, 0x04, 0x02, 
-    0xfb, 0x72, 0xe2, 0x3f, 0x01, 0x06, 
-    0x46, 0x7a, 0x97, 0x59, 0x00, 0x08, 
-    0x2b, 0x42, 0x3a, 0xa0, 0x03, 0x48, 
-    0xa8, 0x7a, 0xc6, 0x2b, 0x04, 0x04, 
-    0x5c, 0x18, 0xa2, 0x92, 0x09, 0x00, 
-    0xfa, 0x57, 0x26, 0xa2, 0x04, 0x00, 
-    0xc2, 0x9c, 0x4e, 0x9e, 0x00, 0x00, 
-    0x51, 0x9a, 0x76, 0xb3, 0x01, 0x00, 
-    0x93, 0x8e, 0xf0, 0xe6, 0x02, 0x4c, 
-    0x9c, 0x2f, 0x06, 0xdd, 0x07, 0x24, 
-    0xfd, 0xa5, 0x42, 0xa3, 0x02, 0x4c, 
-    0xcf, 0xd1, 0xb0, 0x86, 0x01, 0x04, 
-    0x5f, 0xf9, 0xcd, 0xb4, 0x01, 0x00, 
-    0x99, 0x86, 0x8a, 0x01, 0x04, 0x60, 
-    0x2a, 0x3f, 0x78, 0xb3, 0x02, 0x4c, 
-    0x71, 0x76, 0x76, 0x5e, 0x02, 0x4c, 
-    0x7d, 0x09, 0x10, 0x6f, 0x01, 0x00, 
-    0x1f, 0x62, 0x9b, 0x52, 0x01, 0x00, 
-    0xaf, 0x67, 0xac, 0x57, 0x04, 0x01, 
-    0x42, 0xb7, 0xb0, 0xa0, 0x04, 0x01, 
-    0x9d, 0x2a, 0xed, 0x40, 0x01, 0xa0, 
-    0x2d, 0x02, 0x00, 0xce, 0x01, 0x00, 
-    0x27, 0xf2, 0x51, 0x26, 0x04, 0x02, 
-    0x8d, 0x36, 0x22, 0x4e, 0x02, 0x44, 
-    0xb7, 0x83, 0xc0, 0x09, 0x01, 0x00, 
-    0xfe, 0x31, 0x8a, 0x58, 0x01, 0x00, 
-    0x87, 0x35, 0x9f, 0x20, 0x01, 0x00, 
-    0x85, 0xa7, 0xf8, 0xfb, 0x07, 0x24, 
-    0xa3, 0xac, 0xb9, 0xb8, 0x00, 0x08, 
-    0x95, 0x02, 0x88, 0x52, 0x01, 0x04, 
-    0x15, 0x97, 0x5f, 0x50, 0x07, 0x24, 
-    0x9e, 0xeb, 0x34, 0x57, 0x03, 0x40, 
-    0x8d, 0x39, 0x51, 0xf6, 0x01, 0x00, 
-    0xb4, 0x06, 0x20, 0xab, 0x03, 0x48, 
-    0xff, 0x8e, 0x08, 0x37, 0x04, 0x02, 
-    0x8f, 0x12, 0x0e, 0x0b, 0x69, 0x05, 
-    0x19, 0xa1, 0xf1, 0x47, 0xff, 0x05, 
-    0x7f, 0x9e, 0x5e, 0xb9, 0x09, 0x00, 
-    0x15, 0xcc, 0xee, 0x24, 0x01, 0x00, 
-    0x11, 0x13, 0xe7, 0xfc, 0x03, 0x40, 
-    0x78, 0xfd, 0x6e, 0xd2, 0x42, 0x08, 
-    0x37, 0x35, 0xe6, 0x60, 0x01, 0x00, 
-    0xfd, 0x6f, 0x7d, 0x40, 0x2f, 0x00, 
-    0xbe, 0xae, 0x4b, 0xb5, 0x04, 0x02, 
-    0x7e, 0xb2, 0xc0, 0x51, 0xe4, 0x00, 
-    0x7e, 0xee, 0x99, 0xf6, 0x44, 0x00, 
-    0x6f, 0x36, 0xf4, 0xcb, 0x9e, 0x00, 
-    0xc4, 0x0d, 0xe4, 0xbb, 0x0b, 0x08, 
-    0x7c, 0x37, 0x93, 0x6c, 0x47, 0x0c, 
-    0x8b, 0x1a, 0x01, 0x8e, 0x0b, 0x08, 
-    0x62, 0xac, 0xd5, 0xcf, 0x0b, 0x08, 
-    0xc6, 0xbf, 0xdc, 0xcc, 0x47, 0x0c, 
-    0x3e, 0x4c, 0x15, 0xbd, 0x47, 0x0c, 
-    0x2e, 0x61, 0xa4, 0xc2, 0x4f, 0x08, 
-    0x5f, 0xef, 0xaf, 0x68, 0x94, 0x08, 
-    0xdd, 0xc5, 0x86, 0x46, 0x29, 0x08, 
-    0x75, 0x96, 0xe8, 0xa5, 0x0b, 0x08, 
-    0x1a, 0x3a, 0x5d, 0x34, 0x0b, 0x08, 
-    0x3d, 0x96, 0x88, 0xd1, 0x0b, 0x08, 
-    0xae, 0x74, 0xb2, 0x9a, 0xe4, 0x00, 
-    0x51, 0x26, 0x9f, 0xb7, 0x0b, 0x08, 
-    0x92, 0x63, 0xe6, 0x72, 0x0b, 0x08, 
-    0x61, 0x3e, 0xaa, 0x5c, 0x90, 0x08, 
-    0x1c, 0x38, 0xab, 0x8e, 0x4f, 0x08, 
-    0xcb, 0xd0, 0x99, 0xdb, 0x47, 0x0c, 
-    0x20, 0xa9, 0xb4, 0x1e, 0x4f, 0x08, 
-    0x4c, 0xb5, 0x55, 0x09, 0x4f, 0x00, 
-    0x54, 0xfa, 0x5b, 0x5f, 0x0b, 0x08, 
-    0xcd, 0x1d, 0x84, 0xf3, 0x4f, 0x00, 
-    0xfd, 0xc8, 0x32, 0xf7, 0x47, 0x0c, 
-    0x58, 0xe2, 0xfd, 0x0f, 0xce, 0x00, 
-    0xa8, 0x86, 0xc6, 0x1b, 0x47, 0x24, 
-    0xd4, 0x1c, 0xc3, 0x09, 0x0b, 0x00, 
-    0x92, 0xa0, 0x50, 0xcd, 0xce, 0x10, 
-    0x2f, 0xb1, 0xa1, 0xad, 0x94, 0x00, 
-    0x07, 0xd0, 0xa3, 0x92, 0x22, 0x29, 
-    0xb5, 0xb5, 0x9e, 0x13, 0xce, 0x00, 
-    0x3a, 0x3b, 0x08, 0x99, 0x0b, 0x08, 
-    0x23, 0xc5, 0x53, 0xcb, 0x0b, 0x08, 
-    0x5c, 0xda, 0xab, 0x7e, 0x0b, 0x08, 
-    0x90, 0xa4, 0xf3, 0x93, 0x40, 0x00, 
-    0x5c, 0xe6, 0x7f, 0x63, 0x4f, 0x08, 
-    0x98, 0x96, 0x37, 0x9e, 0x47, 0x0c, 
-    0xf5, 0x38, 0x7e, 0x3c, 0x0b, 0x08, 
-    0x13, 0x9a, 0xae, 0x7e, 0xea, 0x00, 
-    0x13, 0x62, 0x27, 0x22, 0x0b, 0x08, 
-    0xd5, 0x70, 0x58, 0xf0, 0x4f, 0x08, 
-    0xc6, 0x8c, 0xd0, 0x11, 0x0b, 0x08, 
-    0xdd, 0x12, 0xba, 0x24, 0x47, 0x0c, 
-    0x82, 0x33, 0x2e, 0xe6, 0x47, 0x0c, 
-    0xc8, 0xce, 0xa9, 0x5d, 0x0b, 0x00, 
-    0x35, 0x16, 0xa8, 0x14, 0x0b, 0x08, 
-    0x2f, 0x0c, 0xd3, 0x43, 0x00, 0x00, 
-    0x28, 0x31, 0x11, 0xea, 0x0b, 0x08, 
-    0x95, 0x9a, 0x74, 0x42, 0x0b, 0x08, 
-    0xf9, 0xf8, 0x38, 0x9d, 0x00, 0x00, 
-    0x60, 0x72, 0x3e, 0xe7, 0xce, 0x08, 
-    0x73, 0x66, 0xf1, 0xe9, 0x94, 0x00, 
-    0x73, 0x30, 0x48, 0x6a, 0x0b, 0x08, 
-    0x0a, 0x08, 0x19, 0xea, 0x4f, 0x00, 
-    0xeb, 0xc3, 0x72, 0x24, 0x00, 0x08, 
-    0xc9, 0x88, 0x98, 0xb8, 0xe8, 0x0c, 
-    0xa9, 0x70, 0x20, 0x79, 0xe8, 0x0c, 
-    0x68, 0xf3, 0xca, 0xcc, 0xe8, 0x0c, 
-    0x1d, 0x6a, 0x32, 0x2e, 0xce, 0x08, 
-    0x76, 0xc7, 0xdf, 0x96, 0xce, 0x08, 
-    0xac, 0xe7, 0x63, 0xfd, 0xce, 0x08, 
-    0x75, 0xcb, 0xa9, 0xf6, 0xa8, 0x0c, 
-    0xb5, 0xa7, 0xe7, 0xbd, 0x4f, 0x08, 
-    0x1c, 0x3d, 0x25, 0x61, 0x0b, 0x08, 
-    0xdd, 0x55, 0x9a, 0xb1, 0x40, 0x00, 
-    0x09, 0x4e, 0x12, 0x10, 0x0b, 0x08, 
-    0xec, 0xe3, 0x2b, 0xf9, 0x40, 0x00, 
-    0x75, 0xbf, 0x3b, 0x97, 0x0b, 0x08, 
-    0x7e, 0xda, 0x0b, 0xeb, 0x40, 0x00, 
-    0xfc, 0x82, 0x3b, 0xc7, 0x0b, 0x08, 
-    0x9e, 0x86, 0x0a, 0xca, 0x0b, 0x08, 
-    0x7a, 0xa6, 0x22, 0xb4, 0x40, 0x00, 
-    0x81, 0xb9, 0xa2, 0xb6, 0x4f, 0x08, 
-    0x13, 0x5c, 0x10, 0x14, 0x0b, 0x08, 
-    0xe0, 0x0e, 0x99, 0x3a, 0x47, 0x0c, 
-    0xc8, 0xa3, 0x16, 0x5b, 0x0b, 0x08, 
-    0x95, 0x31, 0x2c, 0x5f, 0xce, 0x08, 
-    0x4a, 0x7d, 0x52, 0x4d, 0x0b, 0x08, 
-    0xb0, 0x7b, 0x3c, 0x34, 0x94, 0x08, 
-    0xd5, 0x71, 0x12, 0x3e, 0x4f, 0x08, 
-    0x2d, 0xbe, 0x00, 0x58, 0xce, 0x00, 
-    0x0e, 0xfc, 0x7e, 0xc4, 0x4f, 0x00, 
-    0x1a, 0x9c, 0x1f, 0x83, 0x4f, 0x00, 
-    0xdd, 0x34, 0x24, 0x89, 0x47, 0x0c, 
-    0x01, 0x19, 0x2e, 0x88, 0x4f, 0x08, 
-    0xab, 0xc2, 0xf5, 0xa8, 0xce, 0x08, 
-    0x0d, 0xda, 0xec, 0x81, 0x0b, 0x0c, 
-    0x95, 0x24, 0x22, 0x0c, 0xe4, 0x00, 
-    0x76, 0xe6, 0xa5, 0x40, 0x0b, 0x08, 
-    0xd4, 0x46, 0xc2, 0x73, 0x0b, 0x08, 
-    0xc0, 0xef, 0x24, 0x7f, 0x0b, 0x08, 
-    0xef, 0x0e, 0x14, 0x73, 0x0b, 0x08, 
-    0x8d, 0xa7, 0x0d, 0x68, 0x0b, 0x08, 
-    0x26, 0x44, 0xe5, 0xbe, 0x4f, 0x08, 
-    0x88, 0x59, 0xb3, 0x36, 0x4f, 0x08, 
-    0x8a, 0x17, 0x29, 0xbd, 0x4f, 0x00, 
-    0xb6, 0x6d, 0xb2, 0x0a, 0x0b, 0x08, 
-    0x92, 0xb1, 0xa6, 0x88, 0x4f, 0x00, 
-    0x85, 0xcc, 0xfb, 0x38, 0x47, 0x0c, 
-    0x47, 0x02, 0xc7, 0x51, 0x0b, 0x08, 
-    0xdd, 0x01, 0x57, 0xa5, 0x0b, 0x08, 
-    0xa6, 0xf5, 0x0b, 0x56, 0x0b, 0x08, 
-    0xcc, 0x4c, 0x97, 0x86, 0x0b, 0x08, 
-    0xd6, 0x3f, 0x32, 0x85, 0x4f, 0x08, 
-    0xeb, 0xea, 0x05, 0x27, 0xea, 0x00, 
-    0x7b, 0xb5, 0x35, 0x92, 0x47, 0x0c, 
-    0xc1, 0xa5, 0x69, 0x29, 0x00, 0x08, 
-    0xc3, 0x53, 0x15, 0x04, 0xa8, 0x0c, 
-    0x13, 0x0c, 0x92, 0x74, 0xa8, 0x0c, 
-    0x64, 0x22, 0xef, 0xaa, 0xa8, 0x0c, 
-    0x37, 0x75, 0x33, 0x61, 0xa8, 0x0c, 
-    0x51, 0xe9, 0x59, 0x3e, 0xa8, 0x0c, 
-    0x79, 0x62, 0x21, 0x93, 0x2e, 0x08, 
-    0x0e, 0x81, 0x48, 0x19, 0x0b, 0x08, 
-    0xac, 0xc2, 0x86, 0xb7, 0x0b, 0x08
+    { 0x6e0eb43e, 0x02, 0x4c },
+    { 0x9fb32923, 0x01, 0x00 },
+    { 0x3368f7fb, 0x07, 0x24 },
+    { 0x792070a9, 0xe8, 0x0c },
+    { 0x5ea7d410, 0x04, 0x00 },
+    { 0x5bb62688, 0xce, 0x08 },
+    { 0xa0230d75, 0x02, 0x4c },
+    { 0x4e44ff44, 0x04, 0x00 },
+    { 0xf304f1b9, 0x02, 0x4c },
+    { 0x2ea8cc16, 0x02, 0x44 },
+    { 0x506e259d, 0x01, 0x06 },
+    { 0x8eab381c, 0x4f, 0x08 },
+    { 0x9bde3267, 0x03, 0x48 },
+    { 0x11d08cc6, 0x0b, 0x08 },
+    { 0x5112dc21, 0x00, 0x08 },
+    { 0xb5e392e2, 0x04, 0x00 },
+    { 0xe73e7260, 0xce, 0x08 },
+    { 0x3edcf7e8, 0x04, 0x00 },
+    { 0x57ac67af, 0x04, 0x01 },
+    { 0x7c4a72d8, 0x01, 0x00 },
+    { 0xf37befd5, 0x04, 0x00 },
+    { 0x4e22368d, 0x02, 0x44 },
+    { 0x50d296b3, 0x01, 0x04 },
+    { 0xd9f0749f, 0x01, 0x05 },
+    { 0x482c79af, 0x01, 0xa0 },
+    { 0x2538d860, 0x01, 0x00 },
+    { 0x3322105a, 0x01, 0xa0 },
+    { 0xa2af25d0, 0x00, 0x08 },
+    { 0x0537322a, 0x07, 0x44 },
+    { 0x9c537919, 0x04, 0x01 },
+    { 0xac8dcdea, 0x03, 0x48 },
+    { 0xb918580c, 0x01, 0x00 },
+    { 0xaf4010ea, 0x03, 0x40 },
+    { 0xb6d2d300, 0x00, 0x08 },
+    { 0x3e1271d5, 0x4f, 0x08 },
+    { 0xd8578bfd, 0x04, 0x00 },
+    { 0xbf250af2, 0x00, 0x00 },
+    { 0x2370c0a9, 0x04, 0x60 },
+    { 0x3f0fd764, 0x01, 0x00 },
+    { 0xde8fd935, 0x04, 0x00 },
+    { 0xb422a67a, 0x40, 0x00 },
+    { 0xf54b34bd, 0x03, 0x48 },
+    { 0x7329118d, 0x02, 0x44 },
+    { 0xdfd70e27, 0x00, 0x00 },
+    { 0x10180072, 0x01, 0x00 },
+    { 0x973bbf75, 0x0b, 0x08 },
+    { 0x41f9e0aa, 0x76, 0x00 },
+    { 0x9f432594, 0x02, 0x4c },
+    { 0x5248caf3, 0x01, 0x00 },
+    { 0xcf26a149, 0x02, 0x4c },
+    { 0x72e66392, 0x0b, 0x08 },
+    { 0x2b378d11, 0x07, 0x24 },
+    { 0x8192d2e7, 0x01, 0x04 },
+    { 0x24eecc15, 0x01, 0x00 },
+    { 0x263ac8a0, 0x04, 0x00 },
+    { 0x35b6febf, 0x02, 0x4c },
+    { 0x1d5b03a5, 0x02, 0x4c },
+    { 0xd26efd78, 0x42, 0x08 },
+    { 0x63e992ac, 0x02, 0x44 },
+    { 0x40a5e676, 0x0b, 0x08 },
+    { 0xbbed6e6e, 0x03, 0x40 },
+    { 0x90226e40, 0x04, 0x00 },
+    { 0xec968c51, 0xce, 0x10 },
+    { 0xc471e42d, 0x01, 0x00 },
+    { 0x00e95d86, 0x02, 0x4c },
+    { 0x810b7ab9, 0x02, 0x4c },
+    { 0x1cee0c21, 0x07, 0x44 },
+    { 0xc8ad4f32, 0x07, 0x24 },
+    { 0x4681691a, 0x01, 0x00 },
+    { 0x2ae97660, 0x01, 0x00 },
+    { 0x892434dd, 0x47, 0x0c },
+    { 0x5dbd6099, 0x01, 0x00 },
+    { 0x67f77118, 0x01, 0x04 },
+    { 0x0b404915, 0x04, 0x00 },
+    { 0x77833016, 0x00, 0x08 },
+    { 0x3e59e951, 0xa8, 0x0c },
+    { 0xff24d794, 0x00, 0x08 },
+    { 0x2969a5c1, 0x00, 0x08 },
+    { 0x3d0996b2, 0x01, 0x02 },
+    { 0x1771ea8f, 0x03, 0x48 },
+    { 0xb4cdf95f, 0x01, 0x00 },
+    { 0x902e3168, 0x04, 0x00 },
+    { 0xcd50a092, 0xce, 0x10 },
+    { 0x86670c93, 0x00, 0x08 },
+    { 0x2e6ee98d, 0x01, 0x00 },
+    { 0xdab84a9c, 0x04, 0x00 },
+    { 0xf3841dcd, 0x4f, 0x00 },
+    { 0x93f3a490, 0x40, 0x00 },
+    { 0x817431ec, 0x02, 0x4c },
+    { 0xba322865, 0x01, 0x02 },
+    { 0xab2006b4, 0x03, 0x48 },
+    { 0xa94591b0, 0x04, 0x00 },
+    { 0xd0e96f6b, 0x02, 0x4c },
+    { 0x57c2ae4e, 0x04, 0x00 },
+    { 0x14a81635, 0x0b, 0x08 },
+    { 0x51c0b27e, 0xe4, 0x00 },
+    { 0xf651398d, 0x01, 0x00 },
+    { 0xa0c31a57, 0x04, 0x00 },
+    { 0xa5e89675, 0x0b, 0x08 },
+    { 0x5eb8e707, 0x01, 0x00 },
+    { 0xa0df4b8f, 0x04, 0x00 },
+    { 0x56756615, 0x01, 0x04 },
+    { 0x47f1a119, 0xff, 0x05 },
+    { 0xefb09075, 0x02, 0x4c },
+    { 0x57dd23d1, 0x01, 0x04 },
+    { 0xc313ef54, 0x02, 0x4c },
+    { 0x9f6c119c, 0x01, 0x00 },
+    { 0xd4611b79, 0x04, 0x60 },
+    { 0xe6a477b2, 0x02, 0x4c },
+    { 0x9f2eef20, 0x02, 0x4c },
+    { 0xbbe40dc4, 0x0b, 0x08 },
+    { 0x99dddb04, 0x04, 0x00 },
+    { 0x05a688c8, 0x02, 0x44 },
+    { 0xbde93999, 0x01, 0x00 },
+    { 0x2dff7fdc, 0x01, 0x00 },
+    { 0x567e1620, 0x01, 0x00 },
+    { 0xca594ace, 0x04, 0x01 },
+    { 0xd8230d0e, 0x01, 0x00 },
+    { 0x50ccc8ed, 0x03, 0x40 },
+    { 0x419461d0, 0x02, 0x4c },
+    { 0x4d3fba78, 0x01, 0x00 },
+    { 0x0ab26db6, 0x0b, 0x08 },
+    { 0x2e0741b6, 0x04, 0x00 },
+    { 0xaf05f37e, 0x04, 0x60 },
+    { 0xc973699d, 0x01, 0x01 },
+    { 0x1ae7b933, 0x01, 0x04 },
+    { 0xe7da8a04, 0x04, 0x00 },
+    { 0x3a990ee0, 0x47, 0x0c },
+    { 0x9e382ebf, 0x01, 0x00 },
+    { 0x5de61639, 0x01, 0x06 },
+    { 0x28fb71ae, 0x01, 0x04 },
+    { 0xe2c4edce, 0x01, 0x00 },
+    { 0xb4241fcc, 0x01, 0x00 },
+    { 0x44f34172, 0x00, 0x08 },
+    { 0xc247a23d, 0x04, 0x00 },
+    { 0xe74a91bb, 0x01, 0x00 },
+    { 0x345d3a1a, 0x0b, 0x08 },
+    { 0x70080810, 0x01, 0x05 },
+    { 0xfce71311, 0x03, 0x40 },
+    { 0x6a1f628a, 0x04, 0x02 },
+    { 0x0a7e62d4, 0x04, 0x00 },
+    { 0x06961be4, 0x01, 0x00 },
+    { 0xad12a34f, 0x01, 0x04 },
+    { 0x041553c3, 0xa8, 0x0c },
+    { 0x198c2f41, 0x01, 0xa0 },
+    { 0x8593e5ad, 0x04, 0x00 },
+    { 0x9ea1dc76, 0x02, 0x44 },
+    { 0x2220e14a, 0x01, 0x04 },
+    { 0x81a5eb65, 0x04, 0x00 },
+    { 0x1948810e, 0x0b, 0x08 },
+    { 0xfce408a4, 0x03, 0x48 },
+    { 0xfbf8a785, 0x07, 0x24 },
+    { 0xbb6d7949, 0x04, 0x00 },
+    { 0x13c774dd, 0x04, 0x00 },
+    { 0xa8f4d99e, 0x01, 0xa0 },
+    { 0x0f1cc048, 0x01, 0x00 },
+    { 0x06d72c83, 0x02, 0x4c },
+    { 0x43d01c10, 0x04, 0x02 },
+    { 0x65518eae, 0x01, 0x00 },
+    { 0x588a31fe, 0x01, 0x00 },
+    { 0x83fc38f8, 0x04, 0x00 },
+    { 0xc7f0c457, 0x04, 0x00 },
+    { 0x999577b6, 0x02, 0x4c },
+    { 0x3d564757, 0x00, 0x00 },
+    { 0x03ec46af, 0x45, 0x01 },
+    { 0x20c795eb, 0x01, 0x00 },
+    { 0x13c6617e, 0x04, 0x00 },
+    { 0x93991433, 0x04, 0x00 },
+    { 0x0ffde258, 0xce, 0x00 },
+    { 0x0ed96f42, 0x04, 0x00 },
+    { 0xdbb06a25, 0x00, 0x08 },
+    { 0x99a9f57e, 0x01, 0xa0 },
+    { 0x404b2e8b, 0x04, 0x10 },
+    { 0x5f2c3195, 0xce, 0x08 },
+    { 0x93216279, 0x2e, 0x08 },
+    { 0xcebd2a31, 0x01, 0x06 },
+    { 0x73140eef, 0x0b, 0x08 },
+    { 0x16eba50a, 0x04, 0x00 },
+    { 0x0f86feb4, 0x02, 0x4c },
+    { 0x4d527d4a, 0x0b, 0x08 },
+    { 0x69635a6e, 0x01, 0x00 },
+    { 0xc3463a3d, 0x04, 0x01 },
+    { 0x35c6f574, 0x04, 0x00 },
+    { 0x25952141, 0x04, 0x02 },
+    { 0x96dfc776, 0xce, 0x08 },
+    { 0xb1723338, 0x03, 0x40 },
+    { 0xc527c297, 0x04, 0x60 },
+    { 0x465e5483, 0x04, 0x00 },
+    { 0x576a0de8, 0x02, 0x4c },
+    { 0x5991b9d0, 0x04, 0x60 },
+    { 0x00837960, 0x04, 0x01 },
+    { 0x103e7e7f, 0x01, 0x00 },
+    { 0x8c8dedb6, 0x04, 0x00 },
+    { 0xb0cd000f, 0x04, 0x00 },
+    { 0xcccaf368, 0xe8, 0x0c },
+    { 0xaac2e75e, 0x03, 0x40 },
+    { 0x3417ec46, 0x02, 0x4c },
+    { 0x851eb9be, 0x03, 0x48 },
+    { 0x476e022b, 0x04, 0x00 },
+    { 0x74386f15, 0x01, 0x00 },
+    { 0x27d14a54, 0x03, 0x40 },
+    { 0xd63b30f5, 0x04, 0x00 },
+    { 0x3a8723b9, 0x01, 0x00 },
+    { 0xd738c059, 0x02, 0x4c },
+    { 0xf4dfdb14, 0x02, 0x44 },
+    { 0x7156cb4d, 0x01, 0x04 },
+    { 0xb668c7fc, 0x02, 0x4c },
+    { 0x6fd5a271, 0x04, 0x00 },
+    { 0x20353e63, 0x01, 0x00 },
+    { 0xddd90c39, 0x04, 0x00 },
+    { 0x2f698c4d, 0x03, 0x48 },
+    { 0x9c18762b, 0x05, 0x03 },
+    { 0x988b446d, 0x00, 0x08 },
+    { 0xfc5783a7, 0x01, 0x00 },
+    { 0xf42b0dbd, 0x03, 0x40 },
+    { 0xfd63e7ac, 0xce, 0x08 },
+    { 0xd534c98e, 0x04, 0x00 },
+    { 0x86964edd, 0x04, 0x00 },
+    { 0xd74b2719, 0x03, 0x48 },
+    { 0x92c138e4, 0x01, 0x01 },
+    { 0x171251e3, 0x00, 0x00 },
+    { 0x6a483073, 0x0b, 0x08 },
+    { 0x401521f7, 0x04, 0x00 },
+    { 0x99083b3a, 0x0b, 0x08 },
+    { 0x0fec90d2, 0x02, 0x4c },
+    { 0x64b710d2, 0x02, 0x4c },
+    { 0xa8923256, 0x01, 0x00 },
+    { 0x12b2c361, 0x07, 0x24 },
+    { 0xf009ddd2, 0x04, 0x00 },
+    { 0x10124e09, 0x0b, 0x08 },
+    { 0xc0b23520, 0x03, 0x48 },
+    { 0x8dd92725, 0x01, 0x00 },
+    { 0xe7c981a2, 0x04, 0x00 },
+    { 0xfd8d6c75, 0x02, 0x4c },
+    { 0x9d38f8f9, 0x00, 0x00 },
+    { 0x51bee3ea, 0x01, 0xa0 },
+    { 0x23c3fb2d, 0x01, 0x02 },
+    { 0xfdf4569b, 0x01, 0xa0 },
+    { 0x40d159b6, 0x01, 0x02 },
+    { 0xc4b6ed3c, 0x01, 0x00 },
+    { 0xdb9dcf89, 0x00, 0x08 },
+    { 0x5cf6a82e, 0x01, 0x00 },
+    { 0xbd154c3e, 0x47, 0x0c },
+    { 0xc42e648a, 0x01, 0x00 },
+    { 0xc4a02712, 0x00, 0x08 },
+    { 0x85a6c0d5, 0x01, 0x00 },
+    { 0xd19dcb2b, 0x04, 0x00 },
+    { 0x84148f73, 0x01, 0x00 },
+    { 0x1335cb05, 0x04, 0x02 },
+    { 0x5a4f156d, 0x01, 0x00 },
+    { 0x9bac73ef, 0x04, 0x02 },
+    { 0xe943ec4d, 0x01, 0x00 },
+    { 0x8a043cd6, 0x04, 0x00 },
+    { 0x35476e87, 0x04, 0x00 },
+    { 0x40ed2a9d, 0x01, 0xa0 },
+    { 0x49f745e0, 0x01, 0x04 },
+    { 0x699fa085, 0x00, 0x00 },
+    { 0xeac38105, 0x03, 0x48 },
+    { 0xc4c3949a, 0x00, 0x00 },
+    { 0x2c5908a7, 0x04, 0x00 },
+    { 0xbd29178a, 0x4f, 0x00 },
+    { 0xe9f16673, 0x94, 0x00 },
+    { 0x4318a2f8, 0x01, 0x00 },
+    { 0x9e6092a4, 0x04, 0x01 },
+    { 0x2d41ef92, 0x02, 0x4c },
+    { 0x2f66e302, 0x02, 0x4c },
+    { 0x0ec6c023, 0x05, 0x02 },
+    { 0xbee1c0d9, 0x04, 0x01 },
+    { 0xdc02f095, 0x01, 0x00 },
+    { 0x3d1c4894, 0x04, 0x04 },
+    { 0xca033b3a, 0x02, 0x4c },
+    { 0x82be4724, 0x02, 0x44 },
+    { 0x811f06d9, 0x42, 0x08 },
+    { 0xf1fed9b8, 0x02, 0x4c },
+    { 0x753768a6, 0x04, 0x00 },
+    { 0xaaef2264, 0xa8, 0x0c },
+    { 0xbce77871, 0x03, 0x48 },
+    { 0x023a5a32, 0x00, 0x08 },
+    { 0xd273b409, 0x04, 0x00 },
+    { 0xa558fb52, 0x01, 0x06 },
+    { 0x2c818014, 0x09, 0x00 },
+    { 0x0ef730e7, 0x04, 0x00 },
+    { 0x1fa8c4a4, 0x01, 0x00 },
+    { 0x209f3587, 0x01, 0x00 },
+    { 0xd445f698, 0x00, 0x08 },
+    { 0x969ef9e4, 0x02, 0x44 },
+    { 0x934db14a, 0x01, 0x00 },
+    { 0xe6f08e93, 0x02, 0x4c },
+    { 0xb6a2b981, 0x4f, 0x08 },
+    { 0x61d86167, 0x01, 0x00 },
+    { 0xa8f5c2ab, 0xce, 0x08 },
+    { 0xea4eb69e, 0x01, 0x00 },
+    { 0x36b35988, 0x4f, 0x08 },
+    { 0xd188963d, 0x0b, 0x08 },
+    { 0xe7d2c49d, 0x00, 0x00 },
+    { 0xd2574720, 0x01, 0x04 },
+    { 0xb629d555, 0x04, 0x00 },
+    { 0x3c7e38f5, 0x0b, 0x08 },
+    { 0x5f5bfa54, 0x0b, 0x08 },
+    { 0xaa6bb985, 0x02, 0x4c },
+    { 0x847d672d, 0x04, 0x09 },
+    { 0xe71db268, 0x01, 0x04 },
+    { 0x3b3f88f0, 0x01, 0x02 },
+    { 0xde25b90f, 0x02, 0x4c },
+    { 0x4823eefe, 0x01, 0x06 },
+    { 0xb0ebf3db, 0x04, 0x01 },
+    { 0x1ebb5b42, 0x01, 0x05 },
+    { 0x179a0d57, 0x04, 0x02 },
+    { 0x03fb57b6, 0x04, 0x00 },
+    { 0x771c8855, 0x04, 0x00 },
+    { 0x695515a2, 0x01, 0x00 },
+    { 0xbe250388, 0x04, 0x0a },
+    { 0xc73b82fc, 0x0b, 0x08 },
+    { 0x3be244ef, 0x02, 0x4c },
+    { 0xe145b441, 0x01, 0x00 },
+    { 0xb14ea4d2, 0x01, 0x00 },
+    { 0x059e0cdf, 0x01, 0x00 },
+    { 0x063e5653, 0x01, 0x00 },
+    { 0xd054ffb0, 0x04, 0x22 },
+    { 0x67751094, 0x01, 0x00 },
+    { 0xbeb15855, 0x03, 0x48 },
+    { 0x23d17f5e, 0x04, 0x00 },
+    { 0xe9a6c211, 0x01, 0x00 },
+    { 0xae9f33d0, 0x04, 0x01 },
+    { 0x6f8af3e8, 0x04, 0x00 },
+    { 0xf4615036, 0x01, 0x00 },
+    { 0x42749a95, 0x0b, 0x08 },
+    { 0x161d717b, 0x04, 0x00 },
+    { 0x680da78d, 0x0b, 0x08 },
+    { 0x61253d1c, 0x0b, 0x08 },
+    { 0x5b16a3c8, 0x0b, 0x08 },
+    { 0xdaf9d7e3, 0x00, 0x00 },
+    { 0xc1b43207, 0x07, 0x44 },
+    { 0xf011e490, 0x05, 0x42 },
+    { 0xe98ab943, 0x04, 0x00 },
+    { 0x6a88579f, 0x07, 0x24 },
+    { 0xd8ee7669, 0x01, 0x00 },
+    { 0x2e326a1d, 0xce, 0x08 },
+    { 0x8ce478db, 0x05, 0x03 },
+    { 0xbde7a7b5, 0x4f, 0x08 },
+    { 0xa8784932, 0x02, 0x44 },
+    { 0xb6661bda, 0x02, 0x44 },
+    { 0xbdf046ef, 0x07, 0x44 },
+    { 0xea19080a, 0x4f, 0x00 },
+    { 0x15f0d3f1, 0x02, 0x4c },
+    { 0x12748678, 0x04, 0x00 },
+    { 0x841b69b6, 0x01, 0x05 },
+    { 0xedcf1b71, 0x07, 0x24 },
+    { 0x2651f227, 0x04, 0x02 },
+    { 0x3e58a87e, 0x01, 0x00 },
+    { 0xeaf7ed72, 0x01, 0x06 },
+    { 0x62e2e7fc, 0x04, 0x00 },
+    { 0x8e011a8b, 0x0b, 0x08 },
+    { 0x0fcfc04d, 0x01, 0x04 },
+    { 0xa25a750f, 0x01, 0x06 },
+    { 0x92197173, 0x01, 0x00 },
+    { 0xed2465be, 0x05, 0x00 },
+    { 0xcbf4366f, 0x9e, 0x00 },
+    { 0x15fe6d0f, 0x05, 0x03 },
+    { 0x326ab3b6, 0x04, 0x00 },
+    { 0xb9b4d9e0, 0x76, 0x00 },
+    { 0xb95e9e7f, 0x09, 0x00 },
+    { 0x1d6deccc, 0x01, 0x04 },
+    { 0x81ecda0d, 0x0b, 0x0c },
+    { 0x09874777, 0x07, 0x24 },
+    { 0xe7ead93b, 0x01, 0x00 },
+    { 0x8da651d4, 0x04, 0x00 },
+    { 0xce00022d, 0x01, 0x00 },
+    { 0x267de4cc, 0x03, 0x48 },
+    { 0xbee54426, 0x4f, 0x08 },
+    { 0x88a6b192, 0x4f, 0x00 },
+    { 0x12906664, 0x03, 0x48 },
+    { 0xa03a422b, 0x03, 0x48 },
+    { 0x74920c13, 0xa8, 0x0c },
+    { 0xfa43146b, 0x02, 0x4c },
+    { 0x9747ac09, 0x01, 0x00 },
+    { 0x401349a8, 0x00, 0x00 },
+    { 0xcfae9dfa, 0x01, 0x05 },
+    { 0x71bf075f, 0x01, 0xa0 },
+    { 0x6ee94d32, 0x04, 0x00 },
+    { 0x6cd46979, 0x03, 0x48 },
+    { 0xe095c3f2, 0x04, 0x00 },
+    { 0xd67fd6a6, 0x01, 0x05 },
+    { 0x2fe20d79, 0x04, 0x00 },
+    { 0x0c222495, 0xe4, 0x00 },
+    { 0xa725b2d3, 0x04, 0x00 },
+    { 0xfc3e5c86, 0x02, 0x4c },
+    { 0xbe387af0, 0x03, 0x40 },
+    { 0x6e4dcfd2, 0x04, 0x01 },
+    { 0xbfbfd25d, 0x04, 0x00 },
+    { 0x18a2e74f, 0x04, 0x04 },
+    { 0xaa74a4d8, 0x03, 0x40 },
+    { 0x6944a01a, 0x04, 0x00 },
+    { 0x4642dda6, 0x01, 0x07 },
+    { 0x5e900522, 0x01, 0x00 },
+    { 0xa22657fa, 0x04, 0x00 },
+    { 0xf6898a59, 0x04, 0x00 },
+    { 0xeb9960ee, 0x03, 0x48 },
+    { 0x2a662ac7, 0x07, 0x24 },
+    { 0x248566a7, 0x02, 0x4c },
+    { 0xd19addeb, 0x77, 0x04 },
+    { 0x8bca5146, 0x01, 0x04 },
+    { 0x32086826, 0x03, 0x40 },
+    { 0xd4d9e21a, 0x00, 0x00 },
+    { 0x7fa191e7, 0x01, 0x00 },
+    { 0xcb53c523, 0x0b, 0x08 },
+    { 0x70ce3771, 0x02, 0x4c },
+    { 0x6b53006a, 0x01, 0x04 },
+    { 0xbe3bf3b3, 0x01, 0x06 },
+    { 0x0939852f, 0x01, 0x05 },
+    { 0xa7de65e4, 0x01, 0x00 },
+    { 0x5a8b4da8, 0x01, 0x02 },
+    { 0x03f899cd, 0x04, 0x00 },
+    { 0x8ab52a24, 0x02, 0x4c },
+    { 0x227cf577, 0x04, 0x00 },
+    { 0x6f97c721, 0x00, 0x00 },
+    { 0xaa20f73d, 0x04, 0x00 },
+    { 0x60e63537, 0x01, 0x00 },
+    { 0x560bf5a6, 0x0b, 0x08 },
+    { 0x5ed6f221, 0x04, 0x02 },
+    { 0x01b4ca89, 0x03, 0x40 },
+    { 0x03272e9b, 0x04, 0x00 },
+    { 0xb3769a51, 0x01, 0x00 },
+    { 0x50fd0cc6, 0x04, 0x00 },
+    { 0xf6035030, 0x02, 0x4c },
+    { 0xb843eb84, 0x02, 0x4c },
+    { 0xc5b0b1ab, 0x02, 0x4c },
+    { 0x20a5219b, 0x04, 0x00 },
+    { 0x383cabbf, 0x77, 0x04 },
+    { 0xf699ee7e, 0x44, 0x00 },
+    { 0x1d41cc8c, 0x03, 0x48 },
+    { 0x92a3d007, 0x22, 0x29 },
+    { 0x407d6ffd, 0x2f, 0x00 },
+    { 0xe2b43a68, 0x02, 0x4c },
+    { 0xb4e4879e, 0x02, 0x4c },
+    { 0xf732c8fd, 0x47, 0x0c },
+    { 0xc3c7a568, 0x03, 0x40 },
+    { 0x1352f1b9, 0x01, 0x06 },
+    { 0xeccd4089, 0x01, 0x00 },
+    { 0x24598791, 0x00, 0x08 },
+    { 0xca5edbfc, 0x04, 0x01 },
+    { 0xeb15169e, 0x01, 0x00 },
+    { 0x5da9cec8, 0x0b, 0x00 },
+    { 0xf6a9cb75, 0xa8, 0x0c },
+    { 0xee921d8e, 0x01, 0x00 },
+    { 0xe575687c, 0x02, 0x44 },
+    { 0xc3ccc493, 0x01, 0x04 },
+    { 0x77bf8b23, 0x00, 0x00 },
+    { 0x4d1ac58c, 0x01, 0x00 },
+    { 0x9c9f3571, 0x03, 0x48 },
+    { 0x32cf4307, 0x01, 0x01 },
+    { 0xb79f2651, 0x0b, 0x08 },
+    { 0xdf64963b, 0x04, 0x00 },
+    { 0xafb46dd6, 0x02, 0x44 },
+    { 0xf613a8f9, 0x07, 0x24 },
+    { 0x37ba3261, 0x01, 0x00 },
+    { 0xa4062017, 0x01, 0x06 },
+    { 0x350d835e, 0x03, 0x48 },
+    { 0xc2a4612e, 0x4f, 0x08 },
+    { 0xa3c0d49f, 0x02, 0x4c },
+    { 0x3eca3dda, 0x04, 0x00 },
+    { 0xb1612fe6, 0x01, 0x00 },
+    { 0x5b6ca654, 0x01, 0x00 },
+    { 0xea27b477, 0x04, 0x60 },
+    { 0x9edd2159, 0x07, 0x44 },
+    { 0x2d75c7a9, 0x01, 0x00 },
+    { 0x9ab274ae, 0xe4, 0x00 },
+    { 0x92a2185c, 0x09, 0x00 },
+    { 0x8b9d3e9c, 0x01, 0x04 },
+    { 0x38810a91, 0x00, 0x08 },
+    { 0x696d7839, 0x01, 0x00 },
+    { 0x889129cb, 0x04, 0x22 },
+    { 0x655efeed, 0x02, 0x44 },
+    { 0xa80a0f01, 0x04, 0x60 },
+    { 0xe542e3cf, 0x04, 0x00 },
+    { 0x5caa3e61, 0x90, 0x08 },
+    { 0xa69f29fa, 0x01, 0x00 },
+    { 0x1db07c0d, 0x00, 0x00 },
+    { 0xae8666b4, 0x03, 0x48 },
+    { 0xb89888c9, 0xe8, 0x0c },
+    { 0x988798a8, 0x04, 0x04 },
+    { 0x51c70247, 0x0b, 0x08 },
+    { 0x74189e12, 0x01, 0x00 },
+    { 0x085de7c9, 0x01, 0x00 },
+    { 0x603aaa57, 0x04, 0x00 },
+    { 0x26796758, 0x04, 0x00 },
+    { 0x2856111f, 0x01, 0x06 },
+    { 0x73c246d4, 0x0b, 0x08 },
+    { 0xeb61133b, 0x03, 0x40 },
+    { 0xcf5f8af0, 0x01, 0x00 },
+    { 0x2c2ddfb4, 0x01, 0x04 },
+    { 0x38b590e4, 0x01, 0x00 },
+    { 0x4220c170, 0x07, 0x24 },
+    { 0x798eeb98, 0x01, 0x00 },
+    { 0x40684e95, 0x03, 0x40 },
+    { 0xb6bf5137, 0x01, 0x00 },
+    { 0xd7794afc, 0x04, 0x02 },
+    { 0x3b7f5b3b, 0x04, 0x01 },
+    { 0x1394f57e, 0x01, 0xa0 },
+    { 0xbc7fedb9, 0x04, 0x00 },
+    { 0x6bb6a0ce, 0x01, 0xa0 },
+    { 0x88e1a5f4, 0x01, 0x00 },
+    { 0xe3c5bb3d, 0x04, 0x00 },
+    { 0x68383607, 0x07, 0x24 },
+    { 0x2225c20f, 0x01, 0x07 },
+    { 0x26d3082c, 0x04, 0x00 },
+    { 0x09c083b7, 0x01, 0x00 },
+    { 0xdd062f9c, 0x07, 0x24 },
+    { 0xb780521c, 0x04, 0x00 },
+    { 0xc6dd7e69, 0x01, 0x00 },
+    { 0x0955b54c, 0x4f, 0x00 },
+    { 0x6272c549, 0x04, 0x00 },
+    { 0xd679627a, 0x04, 0x60 },
+    { 0x2e6301ed, 0x04, 0x01 },
+    { 0xdb99d0cb, 0x47, 0x0c },
+    { 0x5bc9d7a1, 0x01, 0x02 },
+    { 0xb786c2ac, 0x0b, 0x08 },
+    { 0x009af6be, 0x07, 0x24 },
+    { 0x279710dc, 0x07, 0x44 },
+    { 0x983948a5, 0x03, 0x48 },
+    { 0xb19a55dd, 0x40, 0x00 },
+    { 0x8bf29cb6, 0x01, 0x00 },
+    { 0xdb1d03e5, 0x02, 0x4c },
+    { 0x55db7e2a, 0x04, 0x00 },
+    { 0x3f78037c, 0x04, 0x00 },
+    { 0x0123bffe, 0x02, 0x4c },
+    { 0x38fbcc85, 0x47, 0x0c },
+    { 0x40dafcba, 0x01, 0x00 },
+    { 0x529b621f, 0x01, 0x00 },
+    { 0xb8b9aca3, 0x00, 0x08 },
+    { 0x9e4e9cc2, 0x00, 0x00 },
+    { 0x52880295, 0x01, 0x04 },
+    { 0x4e77733a, 0x04, 0x00 },
+    { 0xec0fc2de, 0x01, 0xa0 },
+    { 0x02cc3973, 0x03, 0x48 },
+    { 0x55773880, 0x02, 0x4c },
+    { 0x4f467410, 0x01, 0x04 },
+    { 0x91e2e863, 0x04, 0x02 },
+    { 0x5dce2eea, 0x01, 0x00 },
+    { 0x59977a46, 0x00, 0x08 },
+    { 0x05ce560c, 0x04, 0x00 },
+    { 0x61337537, 0xa8, 0x0c },
+    { 0xa55fa397, 0x03, 0x40 },
+    { 0x5e66eaea, 0x0d, 0x0c },
+    { 0x61179bfa, 0x04, 0x00 },
+    { 0x5104833e, 0x04, 0x00 },
+    { 0xa9415562, 0x01, 0x04 },
+    { 0xa342a5fd, 0x02, 0x4c },
+    { 0x12c6d5c7, 0x02, 0x44 },
+    { 0xb9cf171f, 0x01, 0x00 },
+    { 0xdaee19f2, 0x01, 0x00 },
+    { 0xcf322bb3, 0x03, 0x48 },
+    { 0xb3783f2a, 0x02, 0x4c },
+    { 0x0504b007, 0x00, 0x08 },
+    { 0x657f7875, 0x00, 0x08 },
+    { 0x0ac1aa8f, 0x02, 0x4c },
+    { 0xe62e3382, 0x47, 0x0c },
+    { 0x882e1901, 0x4f, 0x08 },
+    { 0xa0a095c4, 0x03, 0x40 },
+    { 0xa6a725b8, 0x02, 0x4c },
+    { 0x1d2d93ff, 0x04, 0x00 },
+    { 0x0bdd8dd9, 0x07, 0x24 },
+    { 0x04766130, 0x01, 0x02 },
+    { 0x12078afd, 0x04, 0x00 },
+    { 0x27ddf227, 0x02, 0x4c },
+    { 0x548a2c3c, 0xce, 0x00 },
+    { 0xda2cb59a, 0x07, 0x44 },
+    { 0x50d141fc, 0x01, 0x00 },
+    { 0xeb84c54c, 0x07, 0x44 },
+    { 0x28f9b41f, 0x04, 0x00 },
+    { 0x437e7b69, 0x02, 0x4c },
+    { 0x489ef6a2, 0x01, 0xa0 },
+    { 0x7077b075, 0x01, 0x00 },
+    { 0xb5d10d5c, 0x07, 0x24 },
+    { 0x82afa828, 0x01, 0x00 },
+    { 0x2bc67aa8, 0x04, 0x04 },
+    { 0x8ada3497, 0x01, 0x00 },
+    { 0x26535ef5, 0x07, 0x24 },
+    { 0x2328046e, 0x07, 0x24 },
+    { 0x02ee3706, 0x01, 0x04 },
+    { 0x19f4ca6b, 0x01, 0x01 },
+    { 0x73c7fcf4, 0x02, 0x4c },
+    { 0xa60ca3d6, 0x04, 0x00 },
+    { 0xd18e6be3, 0x04, 0x00 },
+    { 0x6c93377c, 0x47, 0x0c },
+    { 0xe387c77f, 0x04, 0x00 },
+    { 0xbeb8ab01, 0x42, 0x08 },
+    { 0x9ffe2f55, 0x01, 0x00 },
+    { 0x02b9e7c2, 0x01, 0x00 },
+    { 0x5cf536f4, 0x04, 0x00 },
+    { 0x1992d163, 0x04, 0x00 },
+    { 0x586a3277, 0x03, 0x48 },
+    { 0xf92be3ec, 0x40, 0x00 },
+    { 0xd2562072, 0x07, 0x44 },
+    { 0xf05870d5, 0x4f, 0x08 },
+    { 0x99d15a91, 0x00, 0x08 },
+    { 0x5b4b6056, 0x04, 0x00 },
+    { 0x1bc686a8, 0x47, 0x24 },
+    { 0xe19ee99c, 0x04, 0x00 },
+    { 0xd1ea84c3, 0x01, 0x00 },
+    { 0x6decd886, 0x01, 0x00 },
+    { 0x8c5a784e, 0x01, 0x06 },
+    { 0x6abad366, 0x01, 0x00 },
+    { 0xa1ff4e1d, 0x01, 0x00 },
+    { 0x7e57fbec, 0x04, 0x60 },
+    { 0x6f10097d, 0x01, 0x00 },
+    { 0xe353969f, 0x04, 0x00 },
+    { 0x1b71ccdb, 0x04, 0x01 },
+    { 0xd80b44bc, 0x42, 0x00 },
+    { 0x7eae9a13, 0xea, 0x00 },
+    { 0xccdcbfc6, 0x47, 0x0c },
+    { 0x958e4bae, 0x01, 0x00 },
+    { 0xeb803610, 0x04, 0x00 },
+    { 0xe2313813, 0x04, 0x00 },
+    { 0x979c5314, 0x02, 0x4c },
+    { 0x3869e598, 0x02, 0x4c },
+    { 0xa0568e1d, 0x02, 0x4c },
+    { 0x93b49582, 0x01, 0x00 },
+    { 0xda8e4af4, 0x04, 0x02 },
+    { 0xdfa111f1, 0x04, 0x01 },
+    { 0x2bf61c53, 0x04, 0x00 },
+    { 0xb9762da8, 0x03, 0x48 },
+    { 0x24ba12dd, 0x47, 0x0c },
+    { 0xe292aa10, 0x02, 0x44 },
+    { 0x2d273aa4, 0x02, 0x44 },
+    { 0xce77b4be, 0x01, 0x00 },
+    { 0x0c2e7863, 0x04, 0x00 },
+    { 0x6bc33d2f, 0x04, 0x02 },
+    { 0x8111ba08, 0x07, 0x44 },
+    { 0x13d5b1a4, 0x07, 0x44 },
+    { 0x75255f88, 0x01, 0x00 },
+    { 0x86974ccc, 0x0b, 0x08 },
+    { 0xf8a713be, 0x03, 0x48 },
+    { 0x27777635, 0x00, 0x08 },
+    { 0xa2194cad, 0x02, 0x4c },
+    { 0xf31d36a3, 0x04, 0x01 },
+    { 0x018a8699, 0x04, 0x60 },
+    { 0x6fb349e2, 0x04, 0x00 },
+    { 0xb4c81adb, 0x04, 0x00 },
+    { 0x0bcaa4d7, 0x04, 0x00 },
+    { 0xc1c3636b, 0x04, 0x01 },
+    { 0xc6c2edb5, 0x01, 0x00 },
+    { 0xcc37094c, 0x01, 0x04 },
+    { 0x398b8182, 0x01, 0x00 },
+    { 0x0a0926bd, 0x01, 0x00 },
+    { 0x96e6c1ce, 0x03, 0x48 },
+    { 0x18b249e5, 0x01, 0x00 },
+    { 0xb3d74c0d, 0x00, 0x08 },
+    { 0xf79a75d7, 0x04, 0x02 },
+    { 0x4686c5dd, 0x29, 0x08 },
+    { 0xada1b12f, 0x94, 0x00 },
+    { 0x2a46b57f, 0x02, 0x44 },
+    { 0x0d9f5bd1, 0x01, 0x06 },
+    { 0x9b821a83, 0x01, 0x06 },
+    { 0x37088eff, 0x04, 0x02 },
+    { 0x656d4265, 0x00, 0x08 },
+    { 0x2472c3eb, 0x00, 0x08 },
+    { 0x505f9715, 0x07, 0x24 },
+    { 0x8a640aef, 0x04, 0x00 },
+    { 0xa9bbf44f, 0x00, 0x00 },
+    { 0xf99e37eb, 0x01, 0x00 },
+    { 0x8927fd4c, 0x04, 0x00 },
+    { 0x9b506a48, 0x00, 0x00 },
+    { 0x1dac6208, 0x01, 0x00 },
+    { 0xceb65b06, 0x07, 0x44 },
+    { 0xae52dece, 0x00, 0x08 },
+    { 0xd308d52c, 0x00, 0x08 },
+    { 0x9f6ce171, 0x04, 0x00 },
+    { 0x262b5a1d, 0x03, 0x48 },
+    { 0x126ebf66, 0x04, 0x01 },
+    { 0x9235b57b, 0x47, 0x0c },
+    { 0x942b1210, 0x04, 0x00 },
+    { 0x09c31cd4, 0x0b, 0x00 },
+    { 0x1f6ea423, 0x01, 0x02 },
+    { 0xa86a5318, 0x01, 0x06 },
+    { 0x1d20a5c6, 0x04, 0x00 },
+    { 0xd3bff72e, 0x03, 0x48 },
+    { 0x6e85d8dd, 0x01, 0x00 },
+    { 0xde581355, 0x01, 0xa0 },
+    { 0x303d4371, 0x02, 0x4c },
+    { 0xee6892eb, 0x02, 0x4c },
+    { 0x9e379698, 0x47, 0x0c },
+    { 0xaca145d8, 0x03, 0x40 },
+    { 0x3fe272fb, 0x01, 0x06 },
+    { 0xf0e9971b, 0x04, 0x00 },
+    { 0x026e41c5, 0x04, 0x00 },
+    { 0x1d0f4d6b, 0x02, 0x4c },
+    { 0x22276213, 0x0b, 0x08 },
+    { 0x435aeec6, 0x04, 0x00 },
+    { 0x6a154b68, 0x03, 0x40 },
+    { 0x35c41cd4, 0x01, 0x01 },
+    { 0x8ee7c43e, 0x04, 0x01 },
+    { 0x8ff31896, 0x00, 0x08 },
+    { 0xebcfe7c5, 0x01, 0x00 },
+    { 0x58c7ddaf, 0x04, 0x00 },
+    { 0x32fb0583, 0x03, 0x40 },
+    { 0x4b041b6b, 0x07, 0x44 },
+    { 0x34eab034, 0x04, 0x00 },
+    { 0x5fd2aab1, 0x04, 0x01 },
+    { 0x37138039, 0x07, 0x24 },
+    { 0x859c65e1, 0x01, 0x00 },
+    { 0x2055971a, 0x04, 0x00 },
+    { 0x305b4e62, 0x04, 0x00 },
+    { 0x054cb4eb, 0x04, 0x00 },
+    { 0xcdc641fc, 0x02, 0x4c },
+    { 0xeb0bda7e, 0x40, 0x00 },
+    { 0xe1c41d7c, 0x02, 0x4c },
+    { 0x563c2cc0, 0x04, 0x00 },
+    { 0xafdcbd24, 0x00, 0x00 },
+    { 0x4f9dbbe5, 0x02, 0x4c },
+    { 0x7ff76219, 0x01, 0x00 },
+    { 0x711896b8, 0x01, 0x00 },
+    { 0x7fb74a43, 0x04, 0x00 },
+    { 0xc4bc85a2, 0x02, 0x4c },
+    { 0x2f2d1fa9, 0x02, 0x4c },
+    { 0x43d30c2f, 0x00, 0x00 },
+    { 0x2bc25d5a, 0x01, 0x00 },
+    { 0xaaed295c, 0x01, 0xa0 },
+    { 0xa55701dd, 0x0b, 0x08 },
+    { 0xc7197fb1, 0x03, 0x40 },
+    { 0x0b0e128f, 0x69, 0x05 },
+    { 0x423ada8e, 0x02, 0x4c },
+    { 0x85323fd6, 0x4f, 0x08 },
+    { 0x1eb4a920, 0x4f, 0x08 },
+    { 0x831f9c1a, 0x4f, 0x00 },
+    { 0xca0a869e, 0x0b, 0x08 },
+    { 0x343c7bb0, 0x94, 0x08 },
+    { 0x7eabda5c, 0x0b, 0x08 },
+    { 0x6435c095, 0x01, 0x00 },
+    { 0xcf6d0d7a, 0x02, 0x44 },
+    { 0xc2730c30, 0x22, 0x44 },
+    { 0xe50a9130, 0x01, 0x00 },
+    { 0xaca15643, 0x05, 0x03 },
+    { 0x88338ed5, 0x04, 0x00 },
+    { 0xb17574f3, 0x01, 0x02 },
+    { 0xa8b0da56, 0x01, 0x00 },
+    { 0xaa4997c1, 0x04, 0x00 },
+    { 0xb5d28ea2, 0x03, 0x48 },
+    { 0x68ec97cb, 0x01, 0x01 },
+    { 0xc6000085, 0x02, 0x44 },
+    { 0x49aeb3a6, 0x00, 0x08 },
+    { 0x339437f6, 0x01, 0xa0 },
+    { 0xcf4487a2, 0x01, 0x00 },
+    { 0x532a27e6, 0x04, 0x02 },
+    { 0x7f24efc0, 0x0b, 0x08 },
+    { 0x7dcb4c18, 0x01, 0x00 },
+    { 0x1425d7f4, 0x03, 0x40 },
+    { 0xc740eb46, 0x07, 0x44 },
+    { 0x538cd2ea, 0x01, 0x00 },
+    { 0x1973aea8, 0x01, 0x00 },
+    { 0x8889c564, 0x04, 0x00 },
+    { 0xd9bb572c, 0x01, 0x02 },
+    { 0x035dc2e9, 0x00, 0x00 },
+    { 0x192d546f, 0x04, 0x00 },
+    { 0xf532f09a, 0x01, 0x00 },
+    { 0xa5e8d2cd, 0x01, 0x00 },
+    { 0x7c6a3d51, 0x03, 0x48 },
+    { 0xe9c387ec, 0x04, 0x00 },
+    { 0xfde1c7ed, 0x01, 0x00 },
+    { 0x48f68d40, 0x00, 0x00 },
+    { 0xdbf90772, 0x03, 0x40 },
+    { 0x4864c304, 0x00, 0x08 },
+    { 0x058f23a2, 0x04, 0x01 },
+    { 0x2caae01c, 0x04, 0x01 },
+    { 0x5ee6008e, 0x01, 0x00 },
+    { 0x7c6f615f, 0x01, 0x00 },
+    { 0x27f8d0d2, 0x04, 0x00 },
+    { 0x6997f5e1, 0x03, 0x48 },
+    { 0xab41445e, 0x04, 0x00 },
+    { 0xfb98d46e, 0x00, 0x00 },
+    { 0x637fe65c, 0x4f, 0x08 },
+    { 0xcd10dce2, 0x04, 0x00 },
+    { 0x4751a751, 0x01, 0x00 },
+    { 0x81389607, 0x00, 0x00 },
+    { 0x2545214c, 0x01, 0x02 },
+    { 0x52b58732, 0x04, 0x00 },
+    { 0xf74dfc91, 0x01, 0x04 },
+    { 0xce228874, 0x04, 0x00 },
+    { 0x2ddc2dc3, 0x01, 0x00 },
+    { 0x18a9f0d9, 0x04, 0x02 },
+    { 0xd152fb02, 0x01, 0x00 },
+    { 0x689971f9, 0x01, 0x00 },
+    { 0xf00584b6, 0x04, 0x02 },
+    { 0xa166548f, 0x01, 0x00 },
+    { 0x4e959173, 0x03, 0x48 },
+    { 0x7416903f, 0x04, 0x60 },
+    { 0x45a41784, 0x04, 0x00 },
+    { 0xae64ca77, 0x00, 0x08 },
+    { 0xb134d713, 0x01, 0x00 },
+    { 0x14105c13, 0x0b, 0x08 },
+    { 0x333c48a0, 0x04, 0x00 },
+    { 0x95e4e594, 0x01, 0x05 },
+    { 0xf92be7f2, 0x02, 0x4c },
+    { 0x38946c43, 0x03, 0x48 },
+    { 0xefd26e37, 0x07, 0x44 },
+    { 0xff8203d5, 0x04, 0x00 },
+    { 0x68afef5f, 0x94, 0x08 },
+    { 0x2705eaeb, 0xea, 0x00 },
+    { 0xa0b0b742, 0x04, 0x01 },
+    { 0xf6b9799c, 0x01, 0x06 },
+    { 0x05378607, 0x01, 0x00 },
+    { 0xf518dd58, 0x07, 0x44 },
+    { 0x90c773c1, 0x76, 0x00 },
+    { 0xb0480ae9, 0x05, 0x00 },
+    { 0xc6182024, 0x01, 0x07 },
+    { 0x7474ac92, 0x04, 0x00 },
+    { 0x73620901, 0x02, 0x4c },
+    { 0x63fcc0dd, 0x01, 0x00 },
+    { 0x5800be2d, 0xce, 0x00 },
+    { 0xf181c021, 0x04, 0x00 },
+    { 0x2ac87283, 0x00, 0x00 },
+    { 0xd7f6320c, 0x01, 0x01 },
+    { 0xaf5676de, 0x00, 0x08 },
+    { 0xe840fd21, 0x04, 0x00 },
+    { 0x37c474d5, 0x02, 0x4c },
+    { 0x982dfb38, 0x04, 0x60 },
+    { 0xdc4da5d4, 0x02, 0x44 },
+    { 0x5e767671, 0x02, 0x4c },
+    { 0xb54baebe, 0x04, 0x02 },
+    { 0x0ae6c9e2, 0x02, 0x4c },
+    { 0xea113128, 0x0b, 0x08 },
+    { 0x5f0bce2a, 0x01, 0x00 },
+    { 0xedc3662b, 0x01, 0x00 },
+    { 0xd7e29c03, 0x04, 0x00 },
+    { 0x990985c0, 0x01, 0x00 },
+    { 0x3a0965b1, 0x02, 0x44 },
+    { 0x5734eb9e, 0x03, 0x40 },
+    { 0x7b4ed0bb, 0x04, 0x60 },
+    { 0x86b0d1cf, 0x01, 0x04 },
+    { 0x139eb5b5, 0xce, 0x00 },
+    { 0xdf67daa1, 0x00, 0x00 },
+    { 0x240de736, 0x04, 0x00 },
+    { 0x917770d8, 0x04, 0x01 },
+    { 0x96087988, 0x01, 0x00 },
+    { 0xd73aa04c, 0x01, 0x00 },
+    { 0xbcacbbf4, 0x04, 0x00 },
+    { 0x67811da6, 0x03, 0x48 },
+    { 0xa9217ea2, 0x04, 0x00 },
+    { 0xd5c64257, 0x00, 0x08 },
+    { 0x3c5c81d4, 0xce, 0x08 },
+    { 0xcfd5ac62, 0x0b, 0x08 },
+    { 0xc47efc0e, 0x4f, 0x00 },
+    { 0x90d68a43, 0x03, 0x40 },
+    { 0xefcf375d, 0x02, 0x4c },
+    { 0x48e904d0, 0x01, 0x00 },
+    { 0x6ee4bb0a, 0x02, 0x4c },
+    { 0x394d6e2f, 0x04, 0x60 },
+    { 0x45f03d2e, 0x01, 0x02 },
+    { 0x70860fca, 0x00, 0x00 },
+    { 0x27aa3933, 0x00, 0x08 },
 };
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+
+// an entry in the compiled game database.  See GameDatabase::DecodeDescriptor for the encoding.
+struct CartDataEntry
+{
+    uint32_t Crc32;
+    uint8_t MapperByte;
+    uint8_t ConfigByte;
+};
+
+// the database is a minimal perfect hash table.  Each key is first hashed with a seed of zero to pick a bucket, and
+// each bucket has a displacement.  A negative displacement places a single key directly in slot -(d + 1), otherwise
+// the key's slot is its hash seeded with the displacement.  NesCartDbCompiler uses the same function to build the
+// table.
+constexpr uint32_t CartDataHash(uint32_t crc32, uint32_t seed)
+{
+    // the CRC is already well distributed, but we need independent hashes for each seed.
+    auto hash = crc32 ^ (seed * 0x9e3779b9u);
+    hash ^= hash >> 16;
+    hash *= 0x7feb352du;
+    hash ^= hash >> 15;
+    hash *= 0x846ca68bu;
+    hash ^= hash >> 16;
+    return hash;
+}
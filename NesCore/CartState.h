@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CartCoreState.h"
+#include "DirtyPages.h"
 
 #include <array>
 #include <cstdint>
@@ -9,8 +10,14 @@ struct CartState
 {
     CartCoreState Core;
 
+    // the cart's banks are pointers into its own memory, so we store them as offsets which can be restored into another
+    // cart with the same ROM.
+    std::array<uint32_t, 8> CpuBankOffsets{};
+    std::array<uint32_t, 16> PpuBankOffsets{};
+
     // TODO: resize these dynamically
-    std::array<uint8_t, 0x8000> PrgRamBank1;
-    std::array<uint8_t, 0x8000> PrgRamBank2;
-    std::array<uint8_t, 0x4000> ChrRam;
+    PageState<0x8000> PrgRamBank1;
+    PageState<0x8000> PrgRamBank2;
+    PageState<0x4000> ChrRam;
+    PageState<0x400> ExtendedRam;
 };
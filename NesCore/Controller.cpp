@@ -1,6 +1,11 @@
 #include "Controller.h"
 
 
+void Controller::PowerOn()
+{
+    state_ = {};
+}
+
 void Controller::ButtonDown(Buttons button)
 {
     state_.Buttons |= button;
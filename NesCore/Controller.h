@@ -8,6 +8,8 @@
 class Controller
 {
 public:
+    void PowerOn();
+
     void ButtonDown(Buttons button);
     void ButtonUp(Buttons button);
 
@@ -9,4 +9,6 @@ struct ControllerState
     bool Strobe;
     uint8_t Noise;
     uint8_t State;
+
+    uint8_t Padding;
 };
\ No newline at end of file
@@ -9,12 +9,25 @@ Cpu::Cpu(Bus& bus) :
 {
 }
 
+void Cpu::PowerOn()
+{
+    address_ = 0;
+    inValue_ = 0;
+    outValue_ = 0;
+    state_ = {};
+}
+
 void Cpu::Reset()
 {
     // TODO: strictly, this probably shouldn't unhalt the CPU
     state_.InterruptVector = 0xfffc;
 }
 
+bool Cpu::Jammed() const
+{
+    return state_.InterruptVector == 1;
+}
+
 void Cpu::SetIrq(bool irq)
 {
 #ifdef DIAGNOSTIC
@@ -10,6 +10,7 @@ class Cpu
 public:
     Cpu(Bus& bus);
 
+    void PowerOn();
     void Reset();
 
     void SetIrq(bool irq);
@@ -18,6 +19,9 @@ public:
 
     void RunInstruction();
 
+    // whether the CPU has executed one of the STP opcodes, which lock it up until it is reset.
+    bool Jammed() const;
+
     void CaptureState(CpuState* state) const;
     void RestoreState(const CpuState& state);
 
@@ -1,41 +1,252 @@
 #include "Crc32.h"
 
-#include <memory>
+#include <array>
+#include <cstring>
 
-Crc32::Crc32()
-    : lookupTable_{}
+#if defined(_M_X64)
+#include <intrin.h>
+#include <wmmintrin.h>
+#elif defined(_M_ARM64)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#include <intrin.h>
+#endif
+
+namespace
 {
-    const uint32_t polynomial = 0xEDB88320UL;
+    const uint32_t Polynomial = 0xEDB88320UL;
 
-    for (uint32_t i = 0u; i < 256; i++)
+    // the lookup tables for slicing-by-8.  The first is the usual byte-at-a-time table, and each subsequent table
+    // gives the effect of a byte one position further from the end of the 8-byte block.
+    constexpr std::array<std::array<uint32_t, 256>, 8> BuildLookupTables()
     {
-        auto lookupValue = i;
+        std::array<std::array<uint32_t, 256>, 8> tables{};
 
-        for (auto j = 0; j < 8; j++)
+        for (uint32_t i = 0u; i < 256; i++)
         {
-            auto carry = (lookupValue & 1) != 0;
-            lookupValue >>= 1;
+            auto lookupValue = i;
+
+            for (auto j = 0; j < 8; j++)
+            {
+                auto carry = (lookupValue & 1) != 0;
+                lookupValue >>= 1;
 
-            if (carry)
-                lookupValue ^= polynomial;
+                if (carry)
+                    lookupValue ^= Polynomial;
+            }
+
+            tables[0][i] = lookupValue;
         }
 
-        lookupTable_[i] = lookupValue;
+        for (auto table = 1u; table < 8; table++)
+        {
+            for (auto i = 0u; i < 256; i++)
+            {
+                auto previous = tables[table - 1][i];
+                tables[table][i] = (previous >> 8) ^ tables[0][previous & 0xff];
+            }
+        }
+
+        return tables;
     }
 
-    hash_ = 0xffffffff;
-}
+    constexpr auto LookupTables = BuildLookupTables();
 
-void Crc32::AddData(const uint8_t* data, size_t length)
-{
-    auto end = data + length;
-    while (data != end)
+    uint32_t AddDataSliced(uint32_t hash, const uint8_t* data, size_t length)
+    {
+        auto& t = LookupTables;
+
+        for (; length >= 8; length -= 8)
+        {
+            uint32_t low, high;
+            std::memcpy(&low, data, 4);
+            std::memcpy(&high, data + 4, 4);
+            low ^= hash;
+
+            hash =
+                t[7][low & 0xff] ^ t[6][(low >> 8) & 0xff] ^ t[5][(low >> 16) & 0xff] ^ t[4][low >> 24] ^
+                t[3][high & 0xff] ^ t[2][(high >> 8) & 0xff] ^ t[1][(high >> 16) & 0xff] ^ t[0][high >> 24];
+
+            data += 8;
+        }
+
+        for (; length > 0; length--)
+        {
+            hash = (hash >> 8) ^ t[0][(hash ^ *data++) & 0xff];
+        }
+
+        return hash;
+    }
+
+#if defined(_M_X64)
+    bool SupportsClmul()
+    {
+        int info[4];
+        __cpuid(info, 1);
+        return (info[2] & (1 << 1)) != 0;
+    }
+
+    // folds 64 bytes at a time using carry-less multiplication, as described in Intel's "Fast CRC Computation for
+    // Generic Polynomials Using PCLMULQDQ Instruction".  The length must be at least 64, and a multiple of 16.
+    uint32_t AddDataClmulBlocks(uint32_t hash, const uint8_t* data, size_t length)
+    {
+        const auto k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+        const auto k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+        const auto k5k0 = _mm_set_epi64x(0x0000000000, 0x0163cd6124);
+        const auto poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+        const auto mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+        auto load = [](const uint8_t* address) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(address)); };
+        auto fold = [](__m128i value, __m128i next, __m128i k)
+        {
+            auto low = _mm_clmulepi64_si128(value, k, 0x00);
+            auto high = _mm_clmulepi64_si128(value, k, 0x11);
+            return _mm_xor_si128(_mm_xor_si128(high, low), next);
+        };
+
+        auto x1 = _mm_xor_si128(load(data), _mm_cvtsi32_si128(static_cast<int>(hash)));
+        auto x2 = load(data + 0x10);
+        auto x3 = load(data + 0x20);
+        auto x4 = load(data + 0x30);
+        data += 64;
+        length -= 64;
+
+        for (; length >= 64; length -= 64)
+        {
+            x1 = fold(x1, load(data), k1k2);
+            x2 = fold(x2, load(data + 0x10), k1k2);
+            x3 = fold(x3, load(data + 0x20), k1k2);
+            x4 = fold(x4, load(data + 0x30), k1k2);
+            data += 64;
+        }
+
+        // fold the four lanes into one, then any remaining 16 byte blocks
+        x1 = fold(x1, x2, k3k4);
+        x1 = fold(x1, x3, k3k4);
+        x1 = fold(x1, x4, k3k4);
+
+        for (; length >= 16; length -= 16)
+        {
+            x1 = fold(x1, load(data), k3k4);
+            data += 16;
+        }
+
+        // fold down to 64 bits
+        x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+        x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+        x2 = _mm_srli_si128(x1, 4);
+        x1 = _mm_and_si128(x1, mask32);
+        x1 = _mm_clmulepi64_si128(x1, k5k0, 0x00);
+        x1 = _mm_xor_si128(x1, x2);
+
+        // Barrett reduction to 32 bits
+        x2 = _mm_and_si128(x1, mask32);
+        x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+        x2 = _mm_and_si128(x2, mask32);
+        x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+        x1 = _mm_xor_si128(x1, x2);
+
+        return static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(x1, 4)));
+    }
+
+    uint32_t AddDataClmul(uint32_t hash, const uint8_t* data, size_t length)
     {
-        auto hashByte = hash_ & 0xff;
-        hashByte ^= *data++;
+        if (length >= 64)
+        {
+            auto blockLength = length & ~static_cast<size_t>(15);
+            hash = AddDataClmulBlocks(hash, data, blockLength);
+            data += blockLength;
+            length -= blockLength;
+        }
+
+        return AddDataSliced(hash, data, length);
+    }
+#elif defined(_M_ARM64)
+    bool SupportsCrc32Instructions()
+    {
+        return IsProcessorFeaturePresent(PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE);
+    }
+
+    uint32_t AddDataCrc32Instructions(uint32_t hash, const uint8_t* data, size_t length)
+    {
+        for (; length >= 8; length -= 8)
+        {
+            uint64_t value;
+            std::memcpy(&value, data, 8);
+            hash = __crc32d(hash, value);
+            data += 8;
+        }
+
+        for (; length > 0; length--)
+        {
+            hash = __crc32b(hash, *data++);
+        }
+
+        return hash;
+    }
+#endif
+
+    using AddDataFunction = uint32_t(*)(uint32_t hash, const uint8_t* data, size_t length);
+
+    // returns nullptr if the processor does not support the method.
+    AddDataFunction TryGetAddData(Crc32Method method)
+    {
+        switch (method)
+        {
+        case Crc32Method::Sliced:
+            return AddDataSliced;
+
+#if defined(_M_X64)
+        case Crc32Method::Clmul:
+            return SupportsClmul() ? AddDataClmul : nullptr;
+#elif defined(_M_ARM64)
+        case Crc32Method::Crc32Instructions:
+            return SupportsCrc32Instructions() ? AddDataCrc32Instructions : nullptr;
+#endif
+
+        default:
+            return nullptr;
+        }
+    }
+
+    AddDataFunction SelectAddData()
+    {
+        for (auto method : { Crc32Method::Clmul, Crc32Method::Crc32Instructions })
+        {
+            if (auto addData = TryGetAddData(method))
+                return addData;
+        }
 
-        hash_ = (hash_ >> 8) ^ lookupTable_[hashByte];
+        return AddDataSliced;
     }
+
+    const AddDataFunction DefaultAddData = SelectAddData();
+}
+
+Crc32::Crc32()
+    : addData_{ DefaultAddData },
+    hash_{ 0xffffffff }
+{
+}
+
+Crc32::Crc32(Crc32Method method)
+    : addData_{ TryGetAddData(method) },
+    hash_{ 0xffffffff }
+{
+    if (!addData_)
+        addData_ = AddDataSliced;
+}
+
+bool Crc32::IsSupported(Crc32Method method)
+{
+    return TryGetAddData(method) != nullptr;
+}
+
+void Crc32::AddData(const uint8_t* data, size_t length)
+{
+    hash_ = addData_(hash_, data, length);
 }
 
 uint32_t Crc32::GetHash() const
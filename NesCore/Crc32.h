@@ -1,18 +1,32 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
+// the ways the hash can be computed.  The default constructor picks the fastest one this processor supports; the
+// others are only chosen explicitly so that the tests can check every path gives the same answer.
+enum class Crc32Method : uint8_t
+{
+    Sliced,
+    Clmul,
+    Crc32Instructions
+};
+
 class Crc32
 {
 public:
     Crc32();
+    explicit Crc32(Crc32Method method);
+
+    static bool IsSupported(Crc32Method method);
 
     void AddData(const uint8_t* data, size_t length);
 
     uint32_t GetHash() const;
 
 private:
-    uint32_t lookupTable_[256];
+    using AddDataFunction = uint32_t(*)(uint32_t hash, const uint8_t* data, size_t length);
 
+    AddDataFunction addData_;
     uint32_t hash_;
-};
\ No newline at end of file
+};
@@ -0,0 +1,53 @@
+#include "DirtyPages.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace
+{
+    // shared by every tracker, so that a state captured from one system is never mistaken for another's.
+    std::atomic<uint64_t> NextVersion{ 1 };
+}
+
+void DirtyPages::Attach(uint8_t* memory, uint32_t size)
+{
+    memory_ = memory;
+    size_ = size;
+    versions_.assign((size + DIRTY_PAGE_SIZE - 1) >> DIRTY_PAGE_SHIFT, 0);
+}
+
+void DirtyPages::MarkAll()
+{
+    std::fill(begin(versions_), end(versions_), 0);
+}
+
+void DirtyPages::Capture(uint8_t* data, uint64_t* versions) const
+{
+    for (auto page = 0u; page < versions_.size(); page++)
+    {
+        if (versions_[page] == 0)
+            versions_[page] = NextVersion++;
+
+        if (versions[page] == versions_[page])
+            continue;
+
+        auto offset = page << DIRTY_PAGE_SHIFT;
+        auto size = std::min(DIRTY_PAGE_SIZE, size_ - offset);
+        std::copy(memory_ + offset, memory_ + offset + size, data + offset);
+        versions[page] = versions_[page];
+    }
+}
+
+void DirtyPages::Restore(const uint8_t* data, const uint64_t* versions)
+{
+    for (auto page = 0u; page < versions_.size(); page++)
+    {
+        if (versions[page] != 0 && versions[page] == versions_[page])
+            continue;
+
+        auto offset = page << DIRTY_PAGE_SHIFT;
+        auto size = std::min(DIRTY_PAGE_SIZE, size_ - offset);
+        std::copy(data + offset, data + offset + size, memory_ + offset);
+        versions_[page] = versions[page];
+    }
+}
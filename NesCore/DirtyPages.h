@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+// Memory is tracked for changes in 256 byte pages.
+const uint32_t DIRTY_PAGE_SHIFT{ 8 };
+const uint32_t DIRTY_PAGE_SIZE{ 1 << DIRTY_PAGE_SHIFT };
+
+// A saved copy of a block of memory, along with the version of each page that it holds.  A version of zero never
+// matches, so clearing the versions forces the whole block to be copied next time.
+template <uint32_t TSize>
+struct PageState
+{
+    std::array<uint8_t, TSize> Data{};
+    std::array<uint64_t, (TSize + DIRTY_PAGE_SIZE - 1) / DIRTY_PAGE_SIZE> Versions{};
+};
+
+// Tracks which pages of a block of memory have been written since they were last captured.  Capturing gives each
+// written page a new version number, unique across the process, so a saved copy only needs to be updated, or restored
+// from, where its versions differ from the memory's.  Anything that writes to the memory must mark the page.
+class DirtyPages
+{
+public:
+    // starts tracking a block of memory, treating every page as written.
+    void Attach(uint8_t* memory, uint32_t size);
+
+    void MarkAll();
+    void Mark(uint32_t offset);
+    // marks the page containing the address, if it is in this block of memory.
+    void Mark(const uint8_t* address);
+
+    template <uint32_t TSize>
+    void Capture(PageState<TSize>* state) const;
+    template <uint32_t TSize>
+    void Restore(const PageState<TSize>& state);
+
+private:
+    void Capture(uint8_t* data, uint64_t* versions) const;
+    void Restore(const uint8_t* data, const uint64_t* versions);
+
+    uint8_t* memory_{};
+    uint32_t size_{};
+
+    // zero for pages that have been written since they were last captured
+    mutable std::vector<uint64_t> versions_;
+};
+
+__forceinline void DirtyPages::Mark(uint32_t offset)
+{
+    versions_[offset >> DIRTY_PAGE_SHIFT] = 0;
+}
+
+__forceinline void DirtyPages::Mark(const uint8_t* address)
+{
+    auto offset = reinterpret_cast<uintptr_t>(address) - reinterpret_cast<uintptr_t>(memory_);
+    if (offset < size_)
+        versions_[offset >> DIRTY_PAGE_SHIFT] = 0;
+}
+
+template <uint32_t TSize>
+void DirtyPages::Capture(PageState<TSize>* state) const
+{
+    assert(size_ <= TSize);
+    Capture(state->Data.data(), state->Versions.data());
+}
+
+template <uint32_t TSize>
+void DirtyPages::Restore(const PageState<TSize>& state)
+{
+    assert(size_ <= TSize);
+    Restore(state.Data.data(), state.Versions.data());
+}
@@ -1,38 +1,199 @@
 #include "Display.h"
 
-Display::Display()
+#include <bit>
+#include <cassert>
+#include <cstring>
+
+Display::Display() :
+    format_{},
+    trackChanges_{},
+    scanlineHashesValid_{}
+{
+    SetTrackChanges(false);
+    ResetBuffers();
+}
+
+void Display::SetBuffers(PixelFormat format, uint8_t* const* buffers, uint32_t count, uint32_t pitch)
+{
+    assert(count > 0 && count <= MAX_BUFFERS);
+    assert(pitch >= WIDTH * BytesPerPixel(format));
+
+    // the hashes don't depend on where the frames are, so the next frame can still be compared with the last one as
+    // long as the format is the same.  This lets a frontend give us a different buffer for every frame.
+    if (format != format_)
+    {
+        scanlineHashesValid_ = false;
+        changedScanlines_.set();
+        completedChangedScanlines_.set();
+    }
+
+    format_ = format;
+    pitch_ = pitch;
+
+    for (auto i = 0u; i < count; i++)
+    {
+        buffers_[i] = buffers[i];
+    }
+
+    bufferCount_ = count;
+    currentBuffer_ = 0;
+    completedBuffer_ = 0;
+    completedColorPhase_ = 0;
+
+    BeginFrame();
+}
+
+void Display::SetTrackChanges(bool track)
+{
+    trackChanges_ = track;
+
+    // the hashes stopped being kept up to date when tracking was last turned off.
+    scanlineHashesValid_ = false;
+    changedScanlines_.set();
+    completedChangedScanlines_.set();
+}
+
+void Display::ResetBuffers()
+{
+    auto buffer = reinterpret_cast<uint8_t*>(&buffer_[0]);
+    SetBuffers(PixelFormat::Xrgb8888, &buffer, 1, WIDTH * sizeof(uint32_t));
+}
+
+PixelFormat Display::Format() const
+{
+    return format_;
+}
+
+uint32_t Display::Pitch() const
+{
+    return pitch_;
+}
+
+uint32_t Display::BytesPerPixel(PixelFormat format)
 {
-    VBlank();
+    return format == PixelFormat::Xrgb8888 ? 4 : 2;
 }
 
-uint32_t Display::GetPixel(uint8_t paletteIndex, uint8_t emphasis)
+uint32_t Display::GetPixel(uint8_t paletteIndex, uint8_t emphasis) const
 {
-    return Palette[emphasis][paletteIndex];
+    switch (format_)
+    {
+    case PixelFormat::PaletteIndex:
+        return paletteIndex | (emphasis << 6);
+
+    case PixelFormat::Rgb565:
+    {
+        auto rgb = Palette[emphasis][paletteIndex];
+        return ((rgb >> 8) & 0xf800) | ((rgb >> 5) & 0x07e0) | ((rgb >> 3) & 0x001f);
+    }
+
+    default:
+        return Palette[emphasis][paletteIndex];
+    }
 }
 
-uint32_t* Display::GetScanlinePtr()
+uint8_t* Display::GetScanlinePtr()
 {
     return currentPixelAddress_;
 }
 
-uint32_t* Display::GetScanlinePtr(int32_t scanline)
+uint8_t* Display::GetScanlinePtr(int32_t scanline)
 {
-    return &buffer_[scanline * WIDTH];
+    return buffers_[currentBuffer_] + scanline * pitch_;
 }
 
 void Display::HBlank()
 {
-    currentPixelAddress_ += WIDTH;
+    if (currentScanline_ < HEIGHT)
+    {
+        if (trackChanges_)
+        {
+            auto hash = HashScanline(currentPixelAddress_);
+            if (!scanlineHashesValid_ || hash != scanlineHashes_[currentScanline_])
+            {
+                scanlineHashes_[currentScanline_] = hash;
+                changedScanlines_.set(currentScanline_);
+            }
+        }
+
+        currentScanline_++;
+    }
+
+    currentPixelAddress_ += pitch_;
+}
+
+void Display::VBlank(uint8_t colorPhase)
+{
+    // the frame is complete, so move on to the next buffer.
+    completedBuffer_ = currentBuffer_;
+    completedColorPhase_ = colorPhase;
+
+    if (trackChanges_)
+    {
+        completedChangedScanlines_ = changedScanlines_;
+        changedScanlines_.reset();
+        scanlineHashesValid_ = currentScanline_ == HEIGHT;
+    }
+
+    currentBuffer_++;
+    if (currentBuffer_ == bufferCount_)
+        currentBuffer_ = 0;
+
+    BeginFrame();
+}
+
+const uint8_t* Display::Buffer() const
+{
+    return buffers_[completedBuffer_];
+}
+
+uint32_t Display::BufferIndex() const
+{
+    return completedBuffer_;
+}
+
+uint8_t Display::ColorPhase() const
+{
+    return completedColorPhase_;
+}
+
+bool Display::FrameUnchanged() const
+{
+    return completedChangedScanlines_.none();
+}
+
+bool Display::ScanlineChanged(int32_t scanline) const
+{
+    return completedChangedScanlines_.test(scanline);
 }
 
-void Display::VBlank()
+void Display::BeginFrame()
 {
-    currentPixelAddress_ = &buffer_[0];
+    currentPixelAddress_ = buffers_[currentBuffer_];
+    currentScanline_ = 0;
 }
 
-const uint32_t* Display::Buffer() const
+uint64_t Display::HashScanline(const uint8_t* scanline) const
 {
-    return &buffer_[0];
+    auto length = WIDTH * BytesPerPixel(format_);
+
+    uint64_t hash = 0xcbf29ce484222325;
+
+    // this only needs to catch changes, so we can hash a word at a time.
+    auto i = 0u;
+    for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, scanline + i, sizeof(uint64_t));
+        hash = (std::rotl(hash, 29) ^ word) * 0x100000001b3;
+    }
+
+    for (; i < length; i++)
+    {
+        hash = (hash ^ scanline[i]) * 0x100000001b3;
+    }
+
+    return hash;
 }
 
 // palette was generated with bisqwit's tool (https://bisqwit.iki.fi/utils/nespalette.php)
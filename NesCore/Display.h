@@ -1,6 +1,9 @@
 #pragma once
 
+#include "PixelFormat.h"
+
 #include <array>
+#include <bitset>
 #include <cstdint>
 
 class Display
@@ -8,14 +11,39 @@ class Display
 public:
     Display();
 
-    uint32_t GetPixel(uint8_t palleteIndex, uint8_t emphasis);
-    uint32_t* GetScanlinePtr();
-    uint32_t* GetScanlinePtr(int32_t scanline);
+    static const uint32_t MAX_BUFFERS{ 3 };
+
+    // Render into caller-owned buffers instead of our own.  With more than one buffer, each frame is rendered into
+    // the next buffer in turn, so the completed frame is left untouched while the following frames are rendered.  The
+    // buffers can be changed between any two frames.
+    void SetBuffers(PixelFormat format, uint8_t* const* buffers, uint32_t count, uint32_t pitch);
+    void ResetBuffers();
+
+    PixelFormat Format() const;
+    uint32_t Pitch() const;
+    static uint32_t BytesPerPixel(PixelFormat format);
+
+    uint32_t GetPixel(uint8_t palleteIndex, uint8_t emphasis) const;
+    uint8_t* GetScanlinePtr();
+    uint8_t* GetScanlinePtr(int32_t scanline);
 
     void HBlank();
-    void VBlank();
+    void VBlank(uint8_t colorPhase);
+
+    // the most recently completed frame.
+    const uint8_t* Buffer() const;
+    uint32_t BufferIndex() const;
+    // the phase of the colour subcarrier at the start of the frame (0-2), for simulating the NTSC signal.
+    uint8_t ColorPhase() const;
+
+    // hashing each scanline to find what has changed costs a little on every frame, so it is off unless a consumer of
+    // FrameUnchanged or ScanlineChanged turns it on.
+    void SetTrackChanges(bool track);
 
-    const uint32_t* Buffer() const;
+    // whether the most recently completed frame differs from the one before it, in total or by scanline.  Without
+    // change tracking, every scanline counts as changed.
+    bool FrameUnchanged() const;
+    bool ScanlineChanged(int32_t scanline) const;
 
 #ifdef DIAGNOSTIC
     static const int WIDTH{ 341 };
@@ -26,8 +54,29 @@ public:
 #endif
 
 private:
+    void BeginFrame();
+    uint64_t HashScanline(const uint8_t* scanline) const;
+
+    PixelFormat format_;
+    uint32_t pitch_;
+
+    std::array<uint8_t*, MAX_BUFFERS> buffers_;
+    uint32_t bufferCount_;
+    uint32_t currentBuffer_;
+    uint32_t completedBuffer_;
+    uint8_t completedColorPhase_;
+
+    uint8_t* currentPixelAddress_;
+    int32_t currentScanline_;
+
+    // we hash each scanline as it is completed, and compare it with the same scanline in the previous frame.
+    bool trackChanges_;
+    std::array<uint64_t, HEIGHT> scanlineHashes_;
+    bool scanlineHashesValid_;
+    std::bitset<HEIGHT> changedScanlines_;
+    std::bitset<HEIGHT> completedChangedScanlines_;
+
     std::array<uint32_t, WIDTH * HEIGHT> buffer_;
-    uint32_t* currentPixelAddress_;
 
     static std::array<std::array<uint32_t, 64>, 8> Palette;
 };
\ No newline at end of file
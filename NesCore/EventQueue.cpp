@@ -69,6 +69,17 @@ SyncEvent EventQueue::PopEvent()
     return value;
 }
 
+uint32_t EventQueue::CopySortedEvents(Event* events) const
+{
+    std::copy(begin(heap_), begin(heap_) + count_, events);
+    std::sort(events, events + count_, [](const Event& first, const Event& second)
+        {
+            return first.GetCompareValue() < second.GetCompareValue();
+        });
+
+    return count_;
+}
+
 void EventQueue::Tidy()
 {
     int count = 0;
@@ -88,7 +99,7 @@ EventQueue::Event::Event(uint32_t cycles, SyncEvent value)
 {
 }
 
-uint64_t EventQueue::Event::GetCompareValue()
+uint64_t EventQueue::Event::GetCompareValue() const
 {
     return (static_cast<uint64_t>(Cycles) << 32) | static_cast<uint32_t>(Value);
 }
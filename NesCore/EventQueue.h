@@ -20,9 +20,6 @@ public:
     uint32_t GetNextEventTime() const;
     SyncEvent PopEvent();
 
-private:
-    void Tidy();
-
     struct Event
     {
     public:
@@ -32,11 +29,18 @@ private:
         uint32_t Cycles;
         SyncEvent Value;
 
-        uint64_t GetCompareValue();
+        uint64_t GetCompareValue() const;
 
         bool operator<(Event other);
     };
 
+    // copies out the pending events sorted by time and value, and returns how many there are.  The layout of the heap
+    // depends on the order the events were scheduled in, so two queues holding the same events can only be compared
+    // this way.
+    uint32_t CopySortedEvents(Event* events) const;
+
+private:
+    void Tidy();
 
     uint32_t count_;
     std::array<Event, MAX_EVENTS> heap_;
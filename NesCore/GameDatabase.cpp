@@ -5,13 +5,13 @@
 
 #include <memory>
 
-std::unique_ptr<CartDescriptor> GameDatabase::Lookup(const std::vector<std::uint8_t>& prgData, const std::vector<std::uint8_t>& chrData)
+std::unique_ptr<CartDescriptor> GameDatabase::Lookup(std::span<const std::uint8_t> prgData, std::span<const std::uint8_t> chrData)
 {
     auto crc = HashData(prgData, chrData);
     return Lookup(crc);
 }
 
-uint32_t GameDatabase::HashData(const std::vector<std::uint8_t>& prgData, const std::vector<std::uint8_t>& chrData)
+uint32_t GameDatabase::HashData(std::span<const std::uint8_t> prgData, std::span<const std::uint8_t> chrData)
 {
     Crc32 crc;
 
@@ -25,17 +25,17 @@ uint32_t GameDatabase::HashData(const std::vector<std::uint8_t>& prgData, const
 
 std::unique_ptr<CartDescriptor> GameDatabase::Lookup(uint32_t crc32)
 {
-    auto currentEntry = CartData;
-    auto lastEntry = currentEntry + sizeof(CartData);
+    // the database is a perfect hash table - see CartDataEntry.h
+    auto displacement = CartDataDisplacements[CartDataHash(crc32, 0) % CartDataSize];
+    auto slot = displacement < 0
+        ? static_cast<uint32_t>(-displacement - 1)
+        : CartDataHash(crc32, static_cast<uint32_t>(displacement)) % CartDataSize;
 
-    // 6 bytes per game in the database
-    for (; currentEntry < lastEntry; currentEntry += 6)
-    {
-        if (*reinterpret_cast<const uint32_t*>(currentEntry) == crc32)
-            return DecodeDescriptor(currentEntry[4], currentEntry[5]);
-    }
+    auto& entry = CartData[slot];
+    if (entry.Crc32 != crc32)
+        return nullptr;
 
-    return nullptr;
+    return DecodeDescriptor(entry.MapperByte, entry.ConfigByte);
 }
 
 std::unique_ptr<CartDescriptor> GameDatabase::DecodeDescriptor(uint8_t mapperByte, uint8_t configByte)
@@ -4,21 +4,22 @@
 
 #include <cstdint>
 #include <memory>
-#include <vector>
+#include <span>
 
 class GameDatabase
 {
 public:
     static std::unique_ptr<CartDescriptor> Lookup(
-        const std::vector<std::uint8_t>& prgData,
-        const std::vector<std::uint8_t>& chrData);
+        std::span<const std::uint8_t> prgData,
+        std::span<const std::uint8_t> chrData);
 
-private:
     static uint32_t HashData(
-        const std::vector<std::uint8_t>& prgData,
-        const std::vector<std::uint8_t>& chrData);
+        std::span<const std::uint8_t> prgData,
+        std::span<const std::uint8_t> chrData);
 
     static std::unique_ptr<CartDescriptor> Lookup(uint32_t crc32);
 
+private:
+
     static std::unique_ptr<CartDescriptor> DecodeDescriptor(uint8_t mapperByte, uint8_t configByte);
 };
\ No newline at end of file
@@ -0,0 +1,92 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+std::shared_ptr<MappedFile> MappedFile::TryOpen(const std::filesystem::path& path)
+{
+#ifdef _WIN32
+    auto file = CreateFileW(
+        path.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        NULL,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL,
+        NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    // the view keeps the file open, so we can close our handles once it is created
+    auto mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (mapping == NULL)
+        return nullptr;
+
+    auto data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (data == NULL)
+        return nullptr;
+
+    return std::make_shared<MappedFile>(static_cast<const uint8_t*>(data), static_cast<size_t>(fileSize.QuadPart));
+#else
+    auto file = open(path.c_str(), O_RDONLY);
+    if (file < 0)
+        return nullptr;
+
+    struct stat fileStat;
+    if (fstat(file, &fileStat) != 0 || fileStat.st_size == 0)
+    {
+        close(file);
+        return nullptr;
+    }
+
+    auto size = static_cast<size_t>(fileStat.st_size);
+    auto data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+    if (data == MAP_FAILED)
+        return nullptr;
+
+    return std::make_shared<MappedFile>(static_cast<const uint8_t*>(data), size);
+#endif
+}
+
+MappedFile::MappedFile(const uint8_t* data, size_t size) :
+    data_{ data },
+    size_{ size }
+{
+}
+
+MappedFile::~MappedFile()
+{
+#ifdef _WIN32
+    UnmapViewOfFile(data_);
+#else
+    munmap(const_cast<uint8_t*>(data_), size_);
+#endif
+}
+
+const uint8_t* MappedFile::Data() const
+{
+    return data_;
+}
+
+size_t MappedFile::Size() const
+{
+    return size_;
+}
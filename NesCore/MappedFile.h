@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+// A read-only mapping of a file into memory.  The pages are shared with the file cache.
+class MappedFile
+{
+public:
+    static std::shared_ptr<MappedFile> TryOpen(const std::filesystem::path& path);
+
+    MappedFile(const uint8_t* data, size_t size);
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile();
+
+    const uint8_t* Data() const;
+    size_t Size() const;
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+};
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <initializer_list>
+
 enum class MapperType
 {
     NROM,
@@ -34,4 +36,37 @@ enum class MapperType
     ActiveEnterprises, // For Action 52 / Cheetahmen II
     Quattro, // Camerica BF9096
     Aladdin // Variant of Quatro
-};
\ No newline at end of file
+};
+
+// Builds can be limited to a subset of the mappers by defining NESCORE_MAPPERS as a comma separated list, e.g.
+// NESCORE_MAPPERS=MapperType::NROM,MapperType::MMC1,MapperType::MMC3.  Carts using any other mapper are rejected,
+// and the code for those mappers is compiled out.
+constexpr bool IsMapperEnabled(MapperType mapper)
+{
+#ifdef NESCORE_MAPPERS
+    for (auto enabled : { NESCORE_MAPPERS })
+    {
+        if (enabled == mapper)
+            return true;
+    }
+
+    return false;
+#else
+    return true;
+#endif
+}
+
+// are any of the mappers enabled, for code shared by a family of mappers.
+constexpr bool IsMapperEnabled(std::initializer_list<MapperType> mappers)
+{
+    for (auto mapper : mappers)
+    {
+        if (IsMapperEnabled(mapper))
+            return true;
+    }
+
+    return false;
+}
+
+// leaves a switch case when none of the given mappers are compiled in, so that the code for them is discarded.
+#define BREAK_UNLESS_MAPPER_ENABLED(...) if constexpr (!IsMapperEnabled({ __VA_ARGS__ })) break
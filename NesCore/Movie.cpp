@@ -0,0 +1,216 @@
+#include "Movie.h"
+
+#include "MappedFile.h"
+#include "MovieCheckpoints.h"
+#include "NesSystem.h"
+#include "StateSerializer.h"
+#include "SystemState.h"
+
+#include <cassert>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+    const uint32_t Magic{ 0x4d435241 }; // "ARCM"
+    const uint32_t FormatVersion{ 3 };
+
+    struct MovieHeader
+    {
+        uint32_t Magic;
+        uint32_t FormatVersion;
+        uint32_t LayoutVersion;
+        uint32_t CoreVersion;
+        uint32_t RomCrc32;
+        uint32_t SamplesPerFrame;
+        uint32_t StartStateSize;
+        uint32_t FrameCount;
+    };
+
+    // each frame is stored as the two button bytes followed by the fingerprint, without any padding.
+    const size_t FrameSize{ 6 };
+}
+
+bool SaveMovie(const Movie& movie, const std::filesystem::path& path)
+{
+    MovieHeader header{
+        Magic,
+        FormatVersion,
+        movie.LayoutVersion,
+        movie.CoreVersion,
+        movie.RomCrc32,
+        movie.SamplesPerFrame,
+        static_cast<uint32_t>(movie.StartState.size()),
+        static_cast<uint32_t>(movie.Frames.size()) };
+
+    std::vector<uint8_t> data(sizeof(header) + movie.StartState.size() + movie.Frames.size() * FrameSize);
+    auto position = data.data();
+
+    std::memcpy(position, &header, sizeof(header));
+    position += sizeof(header);
+
+    std::copy(movie.StartState.begin(), movie.StartState.end(), position);
+    position += movie.StartState.size();
+
+    for (auto& frame : movie.Frames)
+    {
+        position[0] = frame.Player1;
+        position[1] = frame.Player2;
+        std::memcpy(position + 2, &frame.Fingerprint, sizeof(frame.Fingerprint));
+        position += FrameSize;
+    }
+
+    std::ofstream stream(path, std::ios::binary);
+    return !!stream.write(reinterpret_cast<const char*>(data.data()), data.size());
+}
+
+std::unique_ptr<Movie> TryLoadMovie(const std::filesystem::path& path)
+{
+    auto file = MappedFile::TryOpen(path);
+    if (!file || file->Size() < sizeof(MovieHeader))
+        return nullptr;
+
+    auto position = file->Data();
+
+    MovieHeader header;
+    std::memcpy(&header, position, sizeof(header));
+    position += sizeof(header);
+
+    if (header.Magic != Magic || header.FormatVersion != FormatVersion)
+        return nullptr;
+
+    if (file->Size() != sizeof(header) + header.StartStateSize + static_cast<size_t>(header.FrameCount) * FrameSize)
+        return nullptr;
+
+    auto movie = std::make_unique<Movie>();
+    movie->RomCrc32 = header.RomCrc32;
+    movie->LayoutVersion = header.LayoutVersion;
+    movie->CoreVersion = header.CoreVersion;
+    movie->SamplesPerFrame = header.SamplesPerFrame;
+
+    movie->StartState.assign(position, position + header.StartStateSize);
+    position += header.StartStateSize;
+
+    movie->Frames.resize(header.FrameCount);
+    for (auto& frame : movie->Frames)
+    {
+        frame.Player1 = position[0];
+        frame.Player2 = position[1];
+        std::memcpy(&frame.Fingerprint, position + 2, sizeof(frame.Fingerprint));
+        position += FrameSize;
+    }
+
+    return movie;
+}
+
+uint32_t MovieFingerprint(const NesSystem& system)
+{
+    auto hash = system.StateHash();
+    return static_cast<uint32_t>(hash ^ (hash >> 32));
+}
+
+MovieRecorder::MovieRecorder(NesSystem& system, bool fromPowerOn, MovieCheckpoints* checkpoints) :
+    system_{ system },
+    checkpoints_{ checkpoints }
+{
+    movie_.RomCrc32 = system.RomCrc32();
+    movie_.LayoutVersion = STATE_LAYOUT_VERSION;
+    movie_.CoreVersion = CORE_VERSION;
+    movie_.SamplesPerFrame = system.Apu().SamplesPerFrame();
+
+    if (fromPowerOn)
+    {
+        system.PowerCycle();
+    }
+    else
+    {
+        auto state = std::make_unique<SystemState>();
+        system.CaptureState(state.get());
+
+        movie_.StartState.resize(SerializedStateSize(movie_.SamplesPerFrame));
+        SerializeState(*state, movie_.SamplesPerFrame, movie_.StartState.data());
+    }
+
+    if (checkpoints_)
+        checkpoints_->Update(0, system);
+}
+
+void MovieRecorder::RunFrame(uint8_t player1, uint8_t player2)
+{
+    system_.Controller1().SetButtonState(player1);
+    system_.Controller2().SetButtonState(player2);
+    system_.RunFrame();
+
+    movie_.Frames.push_back({ player1, player2, MovieFingerprint(system_) });
+
+    if (checkpoints_)
+        checkpoints_->Update(static_cast<uint32_t>(movie_.Frames.size()), system_);
+}
+
+const Movie& MovieRecorder::Recording() const
+{
+    return movie_;
+}
+
+MovieStartResult StartMovie(const Movie& movie, NesSystem& system)
+{
+    if (movie.RomCrc32 != system.RomCrc32())
+        return MovieStartResult::WrongRom;
+
+    // these are checked for movies from power-on too, as the fingerprints depend on them.
+    if (movie.LayoutVersion != STATE_LAYOUT_VERSION)
+        return MovieStartResult::WrongLayout;
+
+    if (movie.CoreVersion != CORE_VERSION)
+        return MovieStartResult::WrongCoreVersion;
+
+    if (movie.SamplesPerFrame != system.Apu().SamplesPerFrame())
+        return MovieStartResult::WrongSampleRate;
+
+    if (movie.StartState.empty())
+    {
+        system.PowerCycle();
+        return MovieStartResult::Started;
+    }
+
+    auto state = std::make_unique<SystemState>();
+    if (!TryDeserializeState(
+        movie.StartState.data(),
+        movie.StartState.size(),
+        system.Apu().SamplesPerFrame(),
+        state.get()))
+    {
+        return MovieStartResult::BadStartState;
+    }
+
+    if (!system.TryRestoreState(*state))
+        return MovieStartResult::BadStartState;
+
+    return MovieStartResult::Started;
+}
+
+uint32_t ReplayMovie(const Movie& movie, NesSystem& system, bool drawFrames, MovieCheckpoints* checkpoints)
+{
+    assert(movie.SamplesPerFrame == system.Apu().SamplesPerFrame());
+
+    for (auto index = 0u; index < movie.Frames.size(); index++)
+    {
+        if (checkpoints)
+            checkpoints->Update(index, system);
+
+        auto& frame = movie.Frames[index];
+
+        system.Controller1().SetButtonState(frame.Player1);
+        system.Controller2().SetButtonState(frame.Player2);
+
+        if (drawFrames)
+            system.RunFrame();
+        else
+            system.SkipFrames(1);
+
+        if (MovieFingerprint(system) != frame.Fingerprint)
+            return index;
+    }
+
+    return static_cast<uint32_t>(movie.Frames.size());
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "MovieStartResult.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+class MovieCheckpoints;
+class NesSystem;
+
+// the buttons held during a frame, and the fingerprint of the system at the end of it.
+struct MovieFrame
+{
+    uint8_t Player1{};
+    uint8_t Player2{};
+    uint32_t Fingerprint{};
+};
+
+// A recording of the buttons held on each frame, starting from power-on or from a saved state.  As the emulation is
+// deterministic, replaying it reproduces the original run exactly, and the fingerprints show where a replay diverges.
+struct Movie
+{
+    uint32_t RomCrc32{};
+    // the state layout of the build that recorded the movie.
+    uint32_t LayoutVersion{};
+    // the version of the emulation that recorded the movie, as a different one may not reach the same states.
+    uint32_t CoreVersion{};
+    uint32_t SamplesPerFrame{};
+
+    // the serialized state that the movie starts from, or empty if it starts from power-on.
+    std::vector<uint8_t> StartState;
+
+    std::vector<MovieFrame> Frames;
+};
+
+bool SaveMovie(const Movie& movie, const std::filesystem::path& path);
+std::unique_ptr<Movie> TryLoadMovie(const std::filesystem::path& path);
+
+// a cheap summary of the system's state, which is recorded after each frame.  This is the state hash folded to 32 bits,
+// so a replay is caught at the first frame where anything diverges.
+uint32_t MovieFingerprint(const NesSystem& system);
+
+// Drives a system from the given buttons, recording them as a movie.
+class MovieRecorder
+{
+public:
+    // the movie starts from the system's current state, or from power-on, in which case the system is power cycled.
+    // The checkpoints are optional, and are updated as the movie is recorded.
+    MovieRecorder(NesSystem& system, bool fromPowerOn, MovieCheckpoints* checkpoints = nullptr);
+
+    void RunFrame(uint8_t player1, uint8_t player2 = 0);
+
+    const Movie& Recording() const;
+
+private:
+    NesSystem& system_;
+    MovieCheckpoints* checkpoints_;
+    Movie movie_;
+};
+
+// puts the system into the movie's starting state.  Nothing is changed if the movie was recorded on a different ROM, by
+// a build with a different state layout or core version, or at a different sample rate, as it would not replay
+// faithfully.
+MovieStartResult StartMovie(const Movie& movie, NesSystem& system);
+
+// replays the movie's frames on a system that has been started with StartMovie, as fast as possible.  Frames are
+// only drawn to the display if asked for, and the checkpoints are updated if given.  Returns the number of frames
+// replayed before the first one whose fingerprint didn't match, which is the length of the movie if the replay was
+// faithful.
+uint32_t ReplayMovie(
+    const Movie& movie,
+    NesSystem& system,
+    bool drawFrames = false,
+    MovieCheckpoints* checkpoints = nullptr);
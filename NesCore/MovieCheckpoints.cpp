@@ -0,0 +1,206 @@
+#include "MovieCheckpoints.h"
+
+#include "Movie.h"
+#include "NesSystem.h"
+#include "StateSerializer.h"
+#include "SystemState.h"
+
+#include <algorithm>
+#include <memory>
+
+namespace
+{
+    void WriteLength(std::vector<uint8_t>& data, size_t length)
+    {
+        while (length >= 0x80)
+        {
+            data.push_back(static_cast<uint8_t>(length | 0x80));
+            length >>= 7;
+        }
+
+        data.push_back(static_cast<uint8_t>(length));
+    }
+
+    size_t ReadLength(const uint8_t*& data)
+    {
+        size_t length = 0;
+        auto shift = 0;
+        while (*data & 0x80)
+        {
+            length |= static_cast<size_t>(*data++ & 0x7f) << shift;
+            shift += 7;
+        }
+
+        return length | (static_cast<size_t>(*data++) << shift);
+    }
+
+    // the state is stored as a sequence of runs, each of which is the length of a run of bytes that match the base,
+    // followed by the length of a run of bytes that don't, and then those bytes.
+    void Compress(const std::vector<uint8_t>& state, const std::vector<uint8_t>& base, std::vector<uint8_t>& data)
+    {
+        data.clear();
+
+        auto position = 0u;
+        while (position < state.size())
+        {
+            auto matchStart = position;
+            while (position < state.size() && state[position] == base[position])
+                position++;
+
+            auto literalStart = position;
+            while (position < state.size() && state[position] != base[position])
+                position++;
+
+            WriteLength(data, literalStart - matchStart);
+            WriteLength(data, position - literalStart);
+            data.insert(data.end(), state.begin() + literalStart, state.begin() + position);
+        }
+    }
+
+    void Decompress(const std::vector<uint8_t>& data, const std::vector<uint8_t>& base, std::vector<uint8_t>& state)
+    {
+        state = base;
+
+        auto input = data.data();
+        auto end = input + data.size();
+        auto position = state.begin();
+        while (input < end)
+        {
+            position += ReadLength(input);
+
+            auto literalLength = ReadLength(input);
+            position = std::copy(input, input + literalLength, position);
+            input += literalLength;
+        }
+    }
+}
+
+MovieCheckpoints::MovieCheckpoints(uint32_t interval, size_t memoryBudget) :
+    interval_{ std::max(interval, 1u) },
+    memoryBudget_{ memoryBudget },
+    memoryUsed_{},
+    samplesPerFrame_{}
+{
+}
+
+void MovieCheckpoints::Update(uint32_t frame, NesSystem& system)
+{
+    if (frame % interval_ != 0)
+        return;
+
+    if (!checkpoints_.empty() && checkpoints_.back().Frame >= frame)
+        return;
+
+    // the states are all compressed against the first, so they must all be the same size, which depends on the sample
+    // rate.
+    auto samplesPerFrame = system.Apu().SamplesPerFrame();
+    if (!base_.empty() && samplesPerFrame != samplesPerFrame_)
+        return;
+
+    auto state = std::make_unique<SystemState>();
+    system.CaptureState(state.get());
+
+    samplesPerFrame_ = samplesPerFrame;
+    serialized_.resize(SerializedStateSize(samplesPerFrame_));
+    SerializeState(*state, samplesPerFrame_, serialized_.data());
+
+    if (base_.empty())
+    {
+        base_ = serialized_;
+        memoryUsed_ += base_.size();
+    }
+
+    Checkpoint checkpoint{ frame };
+    Compress(serialized_, base_, checkpoint.Data);
+    checkpoint.Data.shrink_to_fit();
+
+    memoryUsed_ += checkpoint.Data.size();
+    checkpoints_.push_back(std::move(checkpoint));
+
+    while (memoryUsed_ > memoryBudget_ && checkpoints_.size() > 1)
+        Thin();
+}
+
+bool MovieCheckpoints::TrySeek(const Movie& movie, uint32_t frame, NesSystem& system) const
+{
+    if (frame > movie.Frames.size())
+        return false;
+
+    auto checkpoint = std::upper_bound(
+        checkpoints_.begin(),
+        checkpoints_.end(),
+        frame,
+        [](uint32_t frame, const Checkpoint& checkpoint) { return frame < checkpoint.Frame; });
+
+    auto currentFrame = 0u;
+    if (checkpoint == checkpoints_.begin())
+    {
+        if (StartMovie(movie, system) != MovieStartResult::Started)
+            return false;
+    }
+    else
+    {
+        --checkpoint;
+
+        // a state restores the sample buffer at the system's own rate, so it must have been taken at that rate.
+        auto samplesPerFrame = system.Apu().SamplesPerFrame();
+        if (samplesPerFrame != samplesPerFrame_)
+            return false;
+
+        std::vector<uint8_t> serialized;
+        Decompress(checkpoint->Data, base_, serialized);
+
+        auto state = std::make_unique<SystemState>();
+        if (!TryDeserializeState(serialized.data(), serialized.size(), samplesPerFrame, state.get()))
+            return false;
+
+        if (!system.TryRestoreState(*state))
+            return false;
+
+        currentFrame = checkpoint->Frame;
+    }
+
+    for (; currentFrame < frame; currentFrame++)
+    {
+        auto& movieFrame = movie.Frames[currentFrame];
+        system.Controller1().SetButtonState(movieFrame.Player1);
+        system.Controller2().SetButtonState(movieFrame.Player2);
+        system.SkipFrames(1);
+    }
+
+    return true;
+}
+
+uint32_t MovieCheckpoints::Interval() const
+{
+    return interval_;
+}
+
+uint32_t MovieCheckpoints::Count() const
+{
+    return static_cast<uint32_t>(checkpoints_.size());
+}
+
+size_t MovieCheckpoints::MemoryUsed() const
+{
+    return memoryUsed_;
+}
+
+void MovieCheckpoints::Thin()
+{
+    interval_ *= 2;
+
+    auto kept = std::remove_if(
+        checkpoints_.begin(),
+        checkpoints_.end(),
+        [this](const Checkpoint& checkpoint)
+        {
+            if (checkpoint.Frame % interval_ == 0)
+                return false;
+
+            memoryUsed_ -= checkpoint.Data.size();
+            return true;
+        });
+
+    checkpoints_.erase(kept, checkpoints_.end());
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class NesSystem;
+struct Movie;
+
+// A sparse index of the states reached while recording or replaying a movie, so that we can jump to any frame without
+// emulating everything before it.  The states are serialized and compressed against the first one, which most of each
+// state matches.
+class MovieCheckpoints
+{
+public:
+    // a checkpoint is taken every interval frames.  If the checkpoints grow beyond the memory budget, every other one
+    // is dropped and the interval is doubled.
+    MovieCheckpoints(uint32_t interval = 600, size_t memoryBudget = 64 * 1024 * 1024);
+
+    // called with the system at the start of each frame of the movie, which takes a checkpoint if one is due.  The sample
+    // rate is fixed by the first checkpoint, and a system running at a different rate is ignored.
+    void Update(uint32_t frame, NesSystem& system);
+
+    // puts the system at the start of the given frame, by restoring the last checkpoint before it and emulating the
+    // movie's frames from there without drawing them.  Without a checkpoint, this starts from the start of the movie.
+    // Fails if the system isn't running at the checkpoints' sample rate.
+    bool TrySeek(const Movie& movie, uint32_t frame, NesSystem& system) const;
+
+    uint32_t Interval() const;
+    uint32_t Count() const;
+    size_t MemoryUsed() const;
+
+private:
+    struct Checkpoint
+    {
+        uint32_t Frame;
+        std::vector<uint8_t> Data;
+    };
+
+    void Thin();
+
+    uint32_t interval_;
+    size_t memoryBudget_;
+    size_t memoryUsed_;
+
+    uint32_t samplesPerFrame_;
+    // the serialized state of the first checkpoint, which the others are compressed against.
+    std::vector<uint8_t> base_;
+    std::vector<Checkpoint> checkpoints_;
+
+    std::vector<uint8_t> serialized_;
+};
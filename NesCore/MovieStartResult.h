@@ -0,0 +1,16 @@
+#pragma once
+
+enum class MovieStartResult
+{
+    Started = 0,
+    // the movie was recorded on a different ROM.
+    WrongRom,
+    // the movie was recorded by a build with a different state layout.
+    WrongLayout,
+    // the movie was recorded by a build whose emulation behaves differently, so it would desync.
+    WrongCoreVersion,
+    // the movie was recorded at a different sample rate, which changes the state that the fingerprints are taken from.
+    WrongSampleRate,
+    // the starting state is corrupt, or doesn't fit the cart.
+    BadStartState
+};
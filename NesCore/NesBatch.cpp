@@ -0,0 +1,334 @@
+#include "NesBatch.h"
+
+#include "RomFile.h"
+#include "SystemState.h"
+
+#include <algorithm>
+#include <cassert>
+
+NesBatch::NesBatch(std::vector<std::unique_ptr<NesSystem>> systems, const NesBatchOptions& options) :
+    systems_{ std::move(systems) },
+    lockstep_{ options.Lockstep },
+    grayscale_{ options.Grayscale },
+    downsample_{ std::max(options.Downsample, 1u) },
+    direct_{ !options.Grayscale && options.Downsample <= 1 },
+    frameWidth_{ Display::WIDTH / downsample_ },
+    frameHeight_{ Display::HEIGHT / downsample_ },
+    bytesPerPixel_{},
+    frameSize_{},
+    samplesPerFrame_{ options.AudioSampleRate / 60 },
+    threadPool_{ options.ThreadCount }
+{
+    auto format = direct_ ? options.Format : PixelFormat::Xrgb8888;
+
+    bytesPerPixel_ = grayscale_ ? 1 : Display::BytesPerPixel(format);
+    frameSize_ = static_cast<size_t>(frameWidth_) * frameHeight_ * bytesPerPixel_;
+
+    frames_.resize(frameSize_ * systems_.size());
+    ram_.resize(RAM_SIZE * systems_.size());
+    audio_.resize(static_cast<size_t>(samplesPerFrame_) * systems_.size());
+
+    for (auto index = 0u; index < systems_.size(); index++)
+    {
+        if (direct_)
+        {
+            // render straight into the frame array, so there is nothing to gather afterwards.
+            auto buffer = &frames_[index * frameSize_];
+            systems_[index]->SetFrameBuffers(format, &buffer, 1, frameWidth_ * bytesPerPixel_);
+        }
+        else
+        {
+            systems_[index]->ResetFrameBuffers();
+        }
+    }
+
+    leaders_.resize(systems_.size());
+    newLeaders_.resize(systems_.size());
+    states_.resize(systems_.size());
+
+    for (auto index = 0u; index < systems_.size(); index++)
+        leaders_[index] = lockstep_ ? 0 : index;
+}
+
+NesBatch::~NesBatch() = default;
+
+uint32_t NesBatch::Count() const
+{
+    return static_cast<uint32_t>(systems_.size());
+}
+
+NesSystem& NesBatch::System(uint32_t index)
+{
+    Separate(index);
+    return *systems_[index];
+}
+
+void NesBatch::PowerCycle()
+{
+    threadPool_.ParallelFor(Count(), [this](uint32_t index) { systems_[index]->PowerCycle(); });
+
+    // every system is in the same state again, so they can all follow the first one.
+    if (lockstep_)
+        std::fill(leaders_.begin(), leaders_.end(), 0);
+}
+
+void NesBatch::PowerCycle(uint32_t index)
+{
+    Separate(index);
+    systems_[index]->PowerCycle();
+}
+
+void NesBatch::Step(const uint8_t* player1Buttons, const uint8_t* player2Buttons, uint32_t skipFrames)
+{
+    if (lockstep_)
+        Regroup(player1Buttons, player2Buttons);
+
+    threadPool_.ParallelFor(Count(), [&](uint32_t index)
+        {
+            if (leaders_[index] == index)
+                StepSystem(index, player1Buttons[index], player2Buttons ? player2Buttons[index] : 0, skipFrames);
+        });
+
+    if (lockstep_)
+    {
+        threadPool_.ParallelFor(Count(), [this](uint32_t index)
+            {
+                if (leaders_[index] != index)
+                    CopyOutputs(leaders_[index], index);
+            });
+    }
+}
+
+uint32_t NesBatch::FrameWidth() const
+{
+    return frameWidth_;
+}
+
+uint32_t NesBatch::FrameHeight() const
+{
+    return frameHeight_;
+}
+
+uint32_t NesBatch::BytesPerPixel() const
+{
+    return bytesPerPixel_;
+}
+
+size_t NesBatch::FrameSize() const
+{
+    return frameSize_;
+}
+
+const uint8_t* NesBatch::Frames() const
+{
+    return frames_.data();
+}
+
+const uint8_t* NesBatch::Frame(uint32_t index) const
+{
+    return &frames_[index * frameSize_];
+}
+
+const uint8_t* NesBatch::Ram() const
+{
+    return ram_.data();
+}
+
+uint32_t NesBatch::SamplesPerFrame() const
+{
+    return samplesPerFrame_;
+}
+
+const int16_t* NesBatch::Audio() const
+{
+    return audio_.data();
+}
+
+void NesBatch::StepSystem(uint32_t index, uint8_t player1, uint8_t player2, uint32_t skipFrames)
+{
+    auto& system = *systems_[index];
+
+    system.Controller1().SetButtonState(player1);
+    system.Controller2().SetButtonState(player2);
+    system.RunFrame(skipFrames);
+
+    if (!direct_)
+        CaptureFrame(index);
+
+    auto& ram = system.CpuRam();
+    std::copy(ram.begin(), ram.end(), &ram_[index * RAM_SIZE]);
+
+    auto samples = system.Apu().Samples();
+    std::copy(samples, samples + samplesPerFrame_, &audio_[index * static_cast<size_t>(samplesPerFrame_)]);
+}
+
+void NesBatch::CaptureFrame(uint32_t index)
+{
+    auto& display = systems_[index]->Display();
+    assert(display.Format() == PixelFormat::Xrgb8888);
+
+    auto source = display.Buffer();
+    auto sourcePitch = display.Pitch();
+    auto target = &frames_[index * frameSize_];
+
+    auto area = downsample_ * downsample_;
+
+    for (auto y = 0u; y < frameHeight_; y++)
+    {
+        for (auto x = 0u; x < frameWidth_; x++)
+        {
+            uint32_t r = 0, g = 0, b = 0;
+            for (auto dy = 0u; dy < downsample_; dy++)
+            {
+                auto row = reinterpret_cast<const uint32_t*>(source + (y * downsample_ + dy) * sourcePitch);
+                for (auto dx = 0u; dx < downsample_; dx++)
+                {
+                    auto pixel = row[x * downsample_ + dx];
+                    r += (pixel >> 16) & 0xff;
+                    g += (pixel >> 8) & 0xff;
+                    b += pixel & 0xff;
+                }
+            }
+
+            r /= area;
+            g /= area;
+            b /= area;
+
+            if (grayscale_)
+            {
+                // the BT.601 luma weights, in 1/256ths.
+                *target++ = static_cast<uint8_t>((r * 77 + g * 150 + b * 29) >> 8);
+            }
+            else
+            {
+                auto pixel = (r << 16) | (g << 8) | b;
+                std::copy_n(reinterpret_cast<const uint8_t*>(&pixel), sizeof(pixel), target);
+                target += sizeof(pixel);
+            }
+        }
+    }
+}
+
+void NesBatch::CopyOutputs(uint32_t source, uint32_t target)
+{
+    std::copy_n(&frames_[source * frameSize_], frameSize_, &frames_[target * frameSize_]);
+    std::copy_n(&ram_[source * RAM_SIZE], RAM_SIZE, &ram_[target * RAM_SIZE]);
+
+    auto samples = static_cast<size_t>(samplesPerFrame_);
+    std::copy_n(&audio_[source * samples], samples, &audio_[target * samples]);
+}
+
+void NesBatch::Regroup(const uint8_t* player1Buttons, const uint8_t* player2Buttons)
+{
+    auto buttons = [&](uint32_t index)
+    {
+        return (player1Buttons[index] << 8) | (player2Buttons ? player2Buttons[index] : 0);
+    };
+
+    // a system stays with its group if it has the same buttons as the leader.  Otherwise it joins the first system in
+    // the group with the same buttons as it, or leads a new group if there isn't one.
+    auto split = false;
+    for (auto index = 0u; index < Count(); index++)
+    {
+        auto leader = leaders_[index];
+        newLeaders_[index] = index;
+
+        for (auto other = leader; other < index; other++)
+        {
+            if (newLeaders_[other] == other && leaders_[other] == leader && buttons(other) == buttons(index))
+            {
+                newLeaders_[index] = other;
+                break;
+            }
+        }
+
+        if (newLeaders_[index] == index && leader != index)
+            split = true;
+    }
+
+    if (!split)
+        return;
+
+    // the new leaders take on the state of the group they left, which has to be captured before anything moves on.
+    std::vector<bool> captured(Count());
+    for (auto index = 0u; index < Count(); index++)
+    {
+        auto leader = leaders_[index];
+        if (newLeaders_[index] == index && leader != index && !captured[leader])
+        {
+            CaptureState(leader);
+            captured[leader] = true;
+        }
+    }
+
+    threadPool_.ParallelFor(Count(), [this](uint32_t index)
+        {
+            auto leader = leaders_[index];
+            if (newLeaders_[index] == index && leader != index)
+                systems_[index]->RestoreState(*states_[leader]);
+        });
+
+    leaders_.swap(newLeaders_);
+}
+
+void NesBatch::Separate(uint32_t index)
+{
+    auto leader = leaders_[index];
+    if (leader != index)
+    {
+        CaptureState(leader);
+        systems_[index]->RestoreState(*states_[leader]);
+        leaders_[index] = index;
+        return;
+    }
+
+    // the next system in the group takes over as its leader.
+    auto next = Count();
+    for (auto other = index + 1; other < Count(); other++)
+    {
+        if (leaders_[other] != index)
+            continue;
+
+        if (next == Count())
+        {
+            next = other;
+            CaptureState(index);
+            systems_[next]->RestoreState(*states_[index]);
+        }
+
+        leaders_[other] = next;
+    }
+}
+
+void NesBatch::CaptureState(uint32_t index)
+{
+    if (!states_[index])
+        states_[index] = std::make_unique<SystemState>();
+
+    systems_[index]->CaptureState(states_[index].get());
+}
+
+std::unique_ptr<NesBatch> TryCreateBatch(const RomFile& rom, uint32_t count, const NesBatchOptions& options)
+{
+    std::vector<std::unique_ptr<NesSystem>> systems;
+    systems.reserve(count);
+
+    for (auto index = 0u; index < count; index++)
+    {
+        // each cart has its own RAM and mapper state, but they all point at the same ROM image.
+        auto cart = TryCreateCart(rom.Descriptor, rom.PrgData, rom.ChrData, rom.Storage);
+        if (!cart)
+            return nullptr;
+
+        cart->Initialize();
+
+        auto system = std::make_unique<NesSystem>(options.AudioSampleRate);
+        system->InsertCart(std::move(cart));
+        systems.push_back(std::move(system));
+    }
+
+    for (auto& system : systems)
+        system->PowerCycle();
+
+    return std::make_unique<NesBatch>(std::move(systems), options);
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "NesSystem.h"
+#include "PixelFormat.h"
+#include "ThreadPool.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+struct RomFile;
+struct SystemState;
+
+struct NesBatchOptions
+{
+    uint32_t AudioSampleRate{ 44100 };
+
+    // the format of the frames.  Grayscale frames have one byte per pixel, and ignore the pixel format.
+    PixelFormat Format{ PixelFormat::Xrgb8888 };
+    bool Grayscale{};
+
+    // each pixel of the frame is the average of a square of this many pixels in each direction.  Downsampled frames
+    // are always in Xrgb8888, unless they are grayscale.
+    uint32_t Downsample{ 1 };
+
+    // zero picks one thread per core.
+    uint32_t ThreadCount{};
+
+    // experimental: systems which are in the same state and are given the same buttons are only emulated once.  The
+    // systems must all start in the same state.
+    bool Lockstep{};
+};
+
+// Runs many copies of the same game side by side, each one a separate system, stepping them all one frame at a time
+// across a thread pool.  The frames, RAM and audio of every system are gathered into contiguous arrays, indexed by
+// system, which are overwritten by each step.
+class NesBatch
+{
+public:
+    NesBatch(std::vector<std::unique_ptr<NesSystem>> systems, const NesBatchOptions& options);
+    ~NesBatch();
+
+    uint32_t Count() const;
+    // in lockstep mode, this takes the system out of its group, so it can be changed independently.
+    NesSystem& System(uint32_t index);
+
+    void PowerCycle();
+    void PowerCycle(uint32_t index);
+
+    // the buttons hold a byte per system.  Player 2 is optional.  Skipped frames are run before the frame that is
+    // captured, with the same buttons held.
+    void Step(const uint8_t* player1Buttons, const uint8_t* player2Buttons = nullptr, uint32_t skipFrames = 0);
+
+    uint32_t FrameWidth() const;
+    uint32_t FrameHeight() const;
+    uint32_t BytesPerPixel() const;
+    size_t FrameSize() const;
+    const uint8_t* Frames() const;
+    const uint8_t* Frame(uint32_t index) const;
+
+    static const uint32_t RAM_SIZE{ 0x800 };
+    const uint8_t* Ram() const;
+
+    uint32_t SamplesPerFrame() const;
+    const int16_t* Audio() const;
+
+private:
+    void StepSystem(uint32_t index, uint8_t player1, uint8_t player2, uint32_t skipFrames);
+    void CaptureFrame(uint32_t index);
+    void CopyOutputs(uint32_t source, uint32_t target);
+
+    void Regroup(const uint8_t* player1Buttons, const uint8_t* player2Buttons);
+    void Separate(uint32_t index);
+    void CaptureState(uint32_t index);
+
+    std::vector<std::unique_ptr<NesSystem>> systems_;
+
+    // in lockstep mode, the system that each system is following.  Only the leaders are emulated, and the rest are
+    // left behind in whatever state they were in when they joined the group, until they split from it.  The leader is
+    // always the first system in its group.  Otherwise every system is its own leader.
+    bool lockstep_;
+    std::vector<uint32_t> leaders_;
+    std::vector<uint32_t> newLeaders_;
+    std::vector<std::unique_ptr<SystemState>> states_;
+
+    bool grayscale_;
+    uint32_t downsample_;
+    // whether the systems render straight into the frame array, or have to be converted.
+    bool direct_;
+
+    uint32_t frameWidth_;
+    uint32_t frameHeight_;
+    uint32_t bytesPerPixel_;
+    size_t frameSize_;
+    uint32_t samplesPerFrame_;
+
+    std::vector<uint8_t> frames_;
+    std::vector<uint8_t> ram_;
+    std::vector<int16_t> audio_;
+
+    ThreadPool threadPool_;
+};
+
+// creates a batch of systems which all share the ROM image.
+std::unique_ptr<NesBatch> TryCreateBatch(const RomFile& rom, uint32_t count, const NesBatchOptions& options = {});
@@ -17,6 +17,8 @@ NesSystem::NesSystem(uint32_t audioSampleRate)
     bus_.AttachPlayer2(&controller2_);
 }
 
+NesSystem::~NesSystem() = default;
+
 Controller& NesSystem::Controller1()
 {
     return controller1_;
@@ -37,6 +39,23 @@ Apu& NesSystem::Apu()
     return apu_;
 }
 
+void NesSystem::SetFrameBuffers(PixelFormat format, uint8_t* const* buffers, uint32_t count, uint32_t pitch)
+{
+    display_.SetBuffers(format, buffers, count, pitch);
+    ppu_.UpdateDisplayPalette();
+}
+
+void NesSystem::ResetFrameBuffers()
+{
+    display_.ResetBuffers();
+    ppu_.UpdateDisplayPalette();
+}
+
+void NesSystem::SetTrackFrameChanges(bool track)
+{
+    display_.SetTrackChanges(track);
+}
+
 void NesSystem::InsertCart(std::unique_ptr<Cart> cart)
 {
     cart_ = std::move(cart);
@@ -54,20 +73,92 @@ bool NesSystem::HasCart() const
     return bus_.HasCart();
 }
 
-void NesSystem::Reset()
+uint32_t NesSystem::RomCrc32() const
+{
+    return cart_->RomCrc32();
+}
+
+void NesSystem::SoftReset()
+{
+    ppu_.Reset();
+    apu_.Reset();
+    cpu_.Reset();
+}
+
+void NesSystem::PowerCycle()
 {
-    // TODO: implement reset fully.
+    // the order matches construction, so the events are queued in the same order as a new system.
+    bus_.PowerOn();
+    cpu_.PowerOn();
+    ppu_.PowerOn();
+    apu_.PowerOn();
+    controller1_.PowerOn();
+    controller2_.PowerOn();
+
+    if (cart_)
+    {
+        cart_->PowerOn();
+        bus_.UpdateA12Sensitivity();
+    }
+
     cpu_.Reset();
 }
 
-void NesSystem::RunFrame()
+void NesSystem::RunFrame(uint32_t skipFrames)
+{
+    SkipFrames(skipFrames);
+    RunSingleFrame();
+}
+
+void NesSystem::SkipFrames(uint32_t count)
+{
+    if (!count)
+        return;
+
+    ppu_.SetSkipFrame(true);
+
+    for (auto i = 0u; i < count; i++)
+    {
+        RunSingleFrame();
+    }
+
+    ppu_.SetSkipFrame(false);
+}
+
+void NesSystem::RunSingleFrame()
+{
+    int currentFrame = ppu_.FrameCount();
+
+    do
+    {
+        cpu_.RunInstruction();
+    } while (ppu_.FrameCount() == currentFrame);
+}
+
+bool NesSystem::TryRunFrame(uint32_t maxCpuCycles)
 {
     int currentFrame = ppu_.FrameCount();
+    auto startCycle = bus_.CpuCycleCount();
 
     do
     {
         cpu_.RunInstruction();
+
+        if (bus_.CpuCycleCount() - startCycle > maxCpuCycles)
+            return false;
     } while (ppu_.FrameCount() == currentFrame);
+
+    return true;
+}
+
+bool NesSystem::CpuJammed() const
+{
+    return cpu_.Jammed();
+}
+
+const std::array<uint8_t, 2048>& NesSystem::CpuRam() const
+{
+    return bus_.CpuRam();
 }
 
 void NesSystem::CaptureState(SystemState* state) const
@@ -80,6 +171,7 @@ void NesSystem::CaptureState(SystemState* state) const
     controller2_.CaptureState(&state->Controller2State);
     cart_->CaptureState(&state->CartState);
 }
+
 void NesSystem::RestoreState(const SystemState& state)
 {
     bus_.RestoreState(state.BusState);
@@ -90,3 +182,21 @@ void NesSystem::RestoreState(const SystemState& state)
     controller2_.RestoreState(state.Controller2State);
     cart_->RestoreState(state.CartState);
 }
+
+bool NesSystem::TryRestoreState(const SystemState& state)
+{
+    if (!cart_->IsValidState(state.CartState))
+        return false;
+
+    RestoreState(state);
+    return true;
+}
+
+uint64_t NesSystem::StateHash() const
+{
+    if (!hashState_)
+        hashState_ = std::make_unique<SystemState>();
+
+    CaptureState(hashState_.get());
+    return stateHash_.Hash(*hashState_);
+}
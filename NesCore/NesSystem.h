@@ -9,31 +9,68 @@
 #include "Cart.h"
 #include "Display.h"
 #include "Controller.h"
+#include "StateHash.h"
 
 struct SystemState;
 
+// the version of the emulation.  This must be increased whenever a change alters what running a ROM produces, even if
+// the state layout is the same, so that states cached by an older build are not reused.
+const uint32_t CORE_VERSION{ 1 };
+
 class NesSystem
 {
 public:
     NesSystem(uint32_t audioSampleRate);
+    ~NesSystem();
 
     Controller& Controller1();
     Controller& Controller2();
     const Display& Display() const;
     Apu& Apu();
 
+    void SetFrameBuffers(PixelFormat format, uint8_t* const* buffers, uint32_t count, uint32_t pitch);
+    void ResetFrameBuffers();
+    // lets the display report which scanlines have changed since the last frame.  Off by default.
+    void SetTrackFrameChanges(bool track);
+
     void InsertCart(std::unique_ptr<Cart> cart);
     std::unique_ptr<Cart> RemoveCart();
     bool HasCart() const;
+    // the CRC of the cart's ROM images, which is calculated on each call.
+    uint32_t RomCrc32() const;
+
+    // pressing the reset button restarts the CPU, and silences the APU and PPU, but leaves everything else running.
+    void SoftReset();
+    // puts every component back into its power-on state, as if the system had been rebuilt.  Nothing is reallocated,
+    // so this is cheap enough to do between runs.
+    void PowerCycle();
 
-    void Reset();
+    // run the given number of frames without drawing them to the display, followed by one frame that is drawn.
+    void RunFrame(uint32_t skipFrames = 0);
+    // run the given number of frames without drawing anything, for when nothing is watching.
+    void SkipFrames(uint32_t count);
+    // run one frame, drawn as usual, but give up if it hasn't finished after the given number of CPU cycles.  A frame is
+    // about 29781 cycles, so one that goes on far longer means the emulation is stuck.
+    bool TryRunFrame(uint32_t maxCpuCycles);
 
-    void RunFrame();
+    bool CpuJammed() const;
+    const std::array<uint8_t, 2048>& CpuRam() const;
 
     void CaptureState(SystemState* state) const;
     void RestoreState(const SystemState& state);
+    // restores a state which came from outside the process, such as a file.  Nothing is restored if the state doesn't
+    // fit the cart that is loaded.
+    bool TryRestoreState(const SystemState& state);
+
+    // a 64-bit hash of everything the emulation depends on, to compare runs or detect desyncs.  Each call captures the
+    // whole state into a scratch copy, but only the pages of RAM written since the last call are copied and hashed
+    // again, so this is cheap enough to call every frame.  The scratch copy means this mustn't be called from two
+    // threads at once, or while the system is running on another thread, even though it is const.
+    uint64_t StateHash() const;
 
 private:
+    void RunSingleFrame();
+
     Bus bus_;
     Cpu cpu_;
     Ppu ppu_;
@@ -42,4 +79,8 @@ private:
     ::Controller controller1_;
     ::Controller controller2_;
     std::unique_ptr<Cart> cart_;
+
+    // scratch space for StateHash, which keeps the last state so that capturing only copies what has changed.
+    mutable std::unique_ptr<SystemState> hashState_;
+    mutable ::StateHash stateHash_;
 };
\ No newline at end of file
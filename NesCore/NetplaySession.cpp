@@ -0,0 +1,117 @@
+#include "NetplaySession.h"
+
+#include "NesSystem.h"
+#include "NetplayTransport.h"
+#include "SystemState.h"
+
+#include <algorithm>
+
+NetplaySession::NetplaySession(NesSystem& system, NetplayTransport& transport, const NetplayOptions& options) :
+    system_{ system },
+    transport_{ transport },
+    localPlayer_{ options.LocalPlayer },
+    maxRollback_{ std::max(options.MaxRollback, 1u) },
+    frame_{},
+    remoteFrames_{},
+    predictedButtons_{},
+    rolledBackFrames_{},
+    localInputs_(2 * (maxRollback_ + 1)),
+    remoteInputs_(2 * (maxRollback_ + 1)),
+    states_(maxRollback_ + 1)
+{
+    for (auto& state : states_)
+        state = std::make_unique<SystemState>();
+}
+
+NetplaySession::~NetplaySession() = default;
+
+bool NetplaySession::RunFrame(uint8_t localButtons)
+{
+    auto rollbackFrame = ReceiveInputs();
+    if (rollbackFrame < frame_)
+    {
+        system_.RestoreState(*states_[rollbackFrame % states_.size()]);
+
+        for (auto frame = rollbackFrame; frame < frame_; frame++)
+            EmulateFrame(frame, false);
+
+        rolledBackFrames_ += frame_ - rollbackFrame;
+    }
+
+    // any further and we wouldn't have the state to go back to.
+    if (frame_ >= remoteFrames_ + maxRollback_)
+        return false;
+
+    localInputs_[frame_ % localInputs_.size()] = localButtons;
+    transport_.Send({ frame_, localButtons });
+
+    EmulateFrame(frame_, true);
+    frame_++;
+
+    return true;
+}
+
+uint32_t NetplaySession::Frame() const
+{
+    return frame_;
+}
+
+uint32_t NetplaySession::ConfirmedFrames() const
+{
+    return std::min(frame_, remoteFrames_);
+}
+
+uint32_t NetplaySession::RolledBackFrames() const
+{
+    return rolledBackFrames_;
+}
+
+bool NetplaySession::IsConnected() const
+{
+    return transport_.IsConnected();
+}
+
+uint32_t NetplaySession::ReceiveInputs()
+{
+    auto rollbackFrame = frame_;
+
+    NetplayInput input;
+    while (transport_.TryReceive(&input))
+    {
+        // the inputs arrive in order, so anything else isn't from this session.
+        if (input.Frame != remoteFrames_)
+            continue;
+
+        auto& buttons = remoteInputs_[input.Frame % remoteInputs_.size()];
+        if (input.Frame < frame_ && buttons != input.Buttons)
+            rollbackFrame = std::min(rollbackFrame, input.Frame);
+
+        buttons = input.Buttons;
+        predictedButtons_ = input.Buttons;
+        remoteFrames_++;
+    }
+
+    return rollbackFrame;
+}
+
+void NetplaySession::EmulateFrame(uint32_t frame, bool draw)
+{
+    system_.CaptureState(states_[frame % states_.size()].get());
+
+    auto localButtons = localInputs_[frame % localInputs_.size()];
+
+    // until we have the other player's input, we remember what we predicted, to check against it when it arrives.
+    auto& remoteButtons = remoteInputs_[frame % remoteInputs_.size()];
+    if (frame >= remoteFrames_)
+        remoteButtons = predictedButtons_;
+
+    auto& localController = localPlayer_ == 0 ? system_.Controller1() : system_.Controller2();
+    auto& remoteController = localPlayer_ == 0 ? system_.Controller2() : system_.Controller1();
+    localController.SetButtonState(localButtons);
+    remoteController.SetButtonState(remoteButtons);
+
+    if (draw)
+        system_.RunFrame();
+    else
+        system_.SkipFrames(1);
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class NesSystem;
+class NetplayTransport;
+struct SystemState;
+
+struct NetplayOptions
+{
+    // the controller the local player uses: 0 for player 1, or 1 for player 2.  The other end uses the other one.
+    uint32_t LocalPlayer{};
+
+    // how far we can get ahead of the last input from the other end.  This is the most frames that have to be
+    // emulated again when a prediction turns out to be wrong.
+    uint32_t MaxRollback{ 8 };
+};
+
+// A two-player session between two systems, connected by a transport, using rollback.  Each end runs its frames as soon
+// as its own player's buttons are known, predicting that the other player is still holding the buttons they held last.
+// When an input arrives that doesn't match the prediction, the system goes back to the state saved before that frame
+// and emulates the frames since again, without drawing them.  Both systems must start in the same state.
+class NetplaySession
+{
+public:
+    NetplaySession(NesSystem& system, NetplayTransport& transport, const NetplayOptions& options = {});
+    ~NetplaySession();
+
+    // runs the next frame with the local player's buttons, after correcting any wrong predictions.  If we are too far
+    // ahead of the other end, this returns false without running a frame, and should be called again next frame with
+    // the same buttons.
+    bool RunFrame(uint8_t localButtons);
+
+    // the number of frames run, and the number of those for which we have the other player's input.
+    uint32_t Frame() const;
+    uint32_t ConfirmedFrames() const;
+    // the total number of frames that have been emulated again to correct predictions.
+    uint32_t RolledBackFrames() const;
+
+    // false once the transport has lost the other end.  No more of their inputs will arrive, so RunFrame will keep
+    // returning false once we reach the rollback limit.
+    bool IsConnected() const;
+
+private:
+    // returns the first frame we have run with the wrong input for the other player, or the current frame if none.
+    uint32_t ReceiveInputs();
+    void EmulateFrame(uint32_t frame, bool draw);
+
+    NesSystem& system_;
+    NetplayTransport& transport_;
+
+    uint32_t localPlayer_;
+    uint32_t maxRollback_;
+
+    uint32_t frame_;
+    // the frames before this have an input from the other end, and the last of those is the prediction for the rest.
+    uint32_t remoteFrames_;
+    uint8_t predictedButtons_;
+    uint32_t rolledBackFrames_;
+
+    // indexed by frame, wrapping around.  The other end can run up to the rollback limit ahead of us, so the inputs
+    // need room for those frames as well as the ones we might go back to.
+    std::vector<uint8_t> localInputs_;
+    std::vector<uint8_t> remoteInputs_;
+    // the state at the start of each of the frames we might go back to.
+    std::vector<std::unique_ptr<SystemState>> states_;
+};
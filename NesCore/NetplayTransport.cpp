@@ -0,0 +1,300 @@
+#include "NetplayTransport.h"
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <WinSock2.h>
+#include <afunix.h>
+#pragma comment(lib, "ws2_32.lib")
+#else
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+#ifdef _WIN32
+    using Socket = SOCKET;
+    const Socket InvalidSocket{ INVALID_SOCKET };
+    const int SendFlags{ 0 };
+
+    bool StartSockets()
+    {
+        static auto started = []
+        {
+            WSADATA data;
+            return WSAStartup(MAKEWORD(2, 2), &data) == 0;
+        }();
+
+        return started;
+    }
+
+    void CloseSocket(Socket socket)
+    {
+        closesocket(socket);
+    }
+
+    // true if a receive won't block, which includes when the other end has closed the connection.
+    bool IsReadable(Socket socket)
+    {
+        WSAPOLLFD descriptor{ socket, POLLRDNORM };
+        return WSAPoll(&descriptor, 1, 0) > 0;
+    }
+#else
+    using Socket = int;
+    const Socket InvalidSocket{ -1 };
+    // a closed connection should fail the send, rather than raising a signal.
+    const int SendFlags{ MSG_NOSIGNAL };
+
+    bool StartSockets()
+    {
+        return true;
+    }
+
+    void CloseSocket(Socket socket)
+    {
+        close(socket);
+    }
+
+    // true if a receive won't block, which includes when the other end has closed the connection.
+    bool IsReadable(Socket socket)
+    {
+        pollfd descriptor{ socket, POLLIN };
+        return poll(&descriptor, 1, 0) > 0;
+    }
+#endif
+
+    class DelayQueue
+    {
+    public:
+        DelayQueue(std::chrono::milliseconds latency) :
+            latency_{ latency }
+        {
+        }
+
+        void Push(const NetplayInput& input)
+        {
+            std::lock_guard lock{ mutex_ };
+            inputs_.emplace_back(std::chrono::steady_clock::now() + latency_, input);
+        }
+
+        bool TryPop(NetplayInput* input)
+        {
+            std::lock_guard lock{ mutex_ };
+            if (inputs_.empty() || inputs_.front().first > std::chrono::steady_clock::now())
+                return false;
+
+            *input = inputs_.front().second;
+            inputs_.pop_front();
+            return true;
+        }
+
+    private:
+        std::chrono::milliseconds latency_;
+
+        // the inputs are in the order they were pushed, so they are also in the order they become due.
+        std::mutex mutex_;
+        std::deque<std::pair<std::chrono::steady_clock::time_point, NetplayInput>> inputs_;
+    };
+
+    class LoopbackTransport : public NetplayTransport
+    {
+    public:
+        LoopbackTransport(std::shared_ptr<DelayQueue> outgoing, std::shared_ptr<DelayQueue> incoming) :
+            outgoing_{ std::move(outgoing) },
+            incoming_{ std::move(incoming) }
+        {
+        }
+
+        void Send(const NetplayInput& input) override
+        {
+            outgoing_->Push(input);
+        }
+
+        bool TryReceive(NetplayInput* input) override
+        {
+            return incoming_->TryPop(input);
+        }
+
+        bool IsConnected() const override
+        {
+            return true;
+        }
+
+    private:
+        std::shared_ptr<DelayQueue> outgoing_;
+        std::shared_ptr<DelayQueue> incoming_;
+    };
+
+    // each input is sent as the frame number, least significant byte first, followed by the buttons.
+    const size_t MessageSize{ 5 };
+    const size_t ReceiveSize{ 256 };
+
+    class SocketTransport : public NetplayTransport
+    {
+    public:
+        SocketTransport(Socket socket, std::chrono::milliseconds latency) :
+            socket_{ socket },
+            connected_{ true },
+            received_{ latency }
+        {
+        }
+
+        ~SocketTransport() override
+        {
+            CloseSocket(socket_);
+        }
+
+        void Send(const NetplayInput& input) override
+        {
+            std::array<char, MessageSize> message{
+                static_cast<char>(input.Frame),
+                static_cast<char>(input.Frame >> 8),
+                static_cast<char>(input.Frame >> 16),
+                static_cast<char>(input.Frame >> 24),
+                static_cast<char>(input.Buttons) };
+
+            // a stream socket can take less than we give it, but the rest can be sent straight after.  If it fails part
+            // way through, the other end could only read a broken stream from here on, so the connection is finished.
+            size_t sent = 0;
+            while (connected_ && sent < message.size())
+            {
+                auto result = send(socket_, message.data() + sent, static_cast<int>(message.size() - sent), SendFlags);
+                if (result <= 0)
+                    connected_ = false;
+                else
+                    sent += result;
+            }
+        }
+
+        bool TryReceive(NetplayInput* input) override
+        {
+            // a closed connection is readable, but then receives nothing.
+            while (connected_ && IsReadable(socket_))
+            {
+                auto size = buffer_.size();
+                buffer_.resize(size + ReceiveSize);
+
+                auto result = recv(socket_, buffer_.data() + size, static_cast<int>(ReceiveSize), 0);
+                buffer_.resize(size + std::max(static_cast<int>(result), 0));
+
+                if (result <= 0)
+                    connected_ = false;
+            }
+
+            auto position = 0u;
+            for (; position + MessageSize <= buffer_.size(); position += MessageSize)
+            {
+                auto message = reinterpret_cast<const uint8_t*>(&buffer_[position]);
+
+                NetplayInput received;
+                received.Frame = message[0] | (message[1] << 8) | (message[2] << 16) | (message[3] << 24);
+                received.Buttons = message[4];
+                received_.Push(received);
+            }
+
+            // keep any partial message until the rest of it arrives.
+            buffer_.erase(buffer_.begin(), buffer_.begin() + position);
+
+            return received_.TryPop(input);
+        }
+
+        bool IsConnected() const override
+        {
+            return connected_;
+        }
+
+    private:
+        Socket socket_;
+        bool connected_;
+        std::vector<char> buffer_;
+        DelayQueue received_;
+    };
+
+    bool TryGetAddress(const std::filesystem::path& path, sockaddr_un* address)
+    {
+        auto name = path.string();
+
+        *address = {};
+        address->sun_family = AF_UNIX;
+        if (name.size() >= sizeof(address->sun_path))
+            return false;
+
+        std::copy(name.begin(), name.end(), address->sun_path);
+        return true;
+    }
+}
+
+std::pair<std::unique_ptr<NetplayTransport>, std::unique_ptr<NetplayTransport>> CreateLoopbackTransports(
+    std::chrono::milliseconds latency)
+{
+    auto first = std::make_shared<DelayQueue>(latency);
+    auto second = std::make_shared<DelayQueue>(latency);
+
+    return {
+        std::make_unique<LoopbackTransport>(first, second),
+        std::make_unique<LoopbackTransport>(second, first) };
+}
+
+std::unique_ptr<NetplayTransport> TryListenUnixSocket(
+    const std::filesystem::path& path,
+    std::chrono::milliseconds latency)
+{
+    sockaddr_un address;
+    if (!StartSockets() || !TryGetAddress(path, &address))
+        return nullptr;
+
+    auto listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener == InvalidSocket)
+        return nullptr;
+
+    // a socket left behind by an earlier session would stop us binding.
+    std::error_code error;
+    std::filesystem::remove(path, error);
+
+    if (bind(listener, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0
+        || listen(listener, 1) != 0)
+    {
+        CloseSocket(listener);
+        return nullptr;
+    }
+
+    auto connection = accept(listener, nullptr, nullptr);
+    CloseSocket(listener);
+    std::filesystem::remove(path, error);
+
+    if (connection == InvalidSocket)
+        return nullptr;
+
+    return std::make_unique<SocketTransport>(connection, latency);
+}
+
+std::unique_ptr<NetplayTransport> TryConnectUnixSocket(
+    const std::filesystem::path& path,
+    std::chrono::milliseconds latency)
+{
+    sockaddr_un address;
+    if (!StartSockets() || !TryGetAddress(path, &address))
+        return nullptr;
+
+    auto connection = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (connection == InvalidSocket)
+        return nullptr;
+
+    if (connect(connection, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        CloseSocket(connection);
+        return nullptr;
+    }
+
+    return std::make_unique<SocketTransport>(connection, latency);
+}
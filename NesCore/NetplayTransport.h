@@ -0,0 +1,43 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <utility>
+
+// the buttons one player held on one frame.
+struct NetplayInput
+{
+    uint32_t Frame{};
+    uint8_t Buttons{};
+};
+
+// Carries each player's inputs to the other end of a netplay session.  Receiving never blocks - it only returns inputs
+// which have already arrived, so the session can poll it once a frame.  Inputs arrive in the order they were sent.
+class NetplayTransport
+{
+public:
+    virtual ~NetplayTransport() = default;
+
+    virtual void Send(const NetplayInput& input) = 0;
+    virtual bool TryReceive(NetplayInput* input) = 0;
+
+    // false once the other end has gone away or the connection has failed.  Nothing more will be sent or received,
+    // although inputs which arrived before that can still be received.
+    virtual bool IsConnected() const = 0;
+};
+
+// a pair of transports connected to each other within the process, for running both ends of a session side by side.
+// Each input is held back until the latency has passed since it was sent.
+std::pair<std::unique_ptr<NetplayTransport>, std::unique_ptr<NetplayTransport>> CreateLoopbackTransports(
+    std::chrono::milliseconds latency = {});
+
+// transports over a Unix domain socket, for sessions between processes.  Listening waits for the other end to connect.
+// The latency is added to every input received, to test how a session copes with a slow connection.
+std::unique_ptr<NetplayTransport> TryListenUnixSocket(
+    const std::filesystem::path& path,
+    std::chrono::milliseconds latency = {});
+std::unique_ptr<NetplayTransport> TryConnectUnixSocket(
+    const std::filesystem::path& path,
+    std::chrono::milliseconds latency = {});
@@ -0,0 +1,276 @@
+#include "NtscFilter.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+
+namespace
+{
+    // the composite signal levels, from https://www.nesdev.org/wiki/NTSC_video
+    const float LowLevels[4]{ 0.350f, 0.518f, 0.962f, 1.550f };
+    const float HighLevels[4]{ 1.094f, 1.506f, 1.962f, 1.962f };
+    const float Black{ 0.518f };
+    const float White{ 1.962f };
+    const float Attenuation{ 0.746f };
+
+    // the hue (in samples), saturation and gamma adjustments, chosen to match the palette used by the display.
+    const float HueOffset{ 3.5f };
+    const float Saturation{ 0.5f };
+    const float Gamma{ 2.2f / 1.8f };
+
+    // the first output pixel (relative to the start of the group) that each pixel in a group of three contributes to
+    const int32_t KernelStart[3]{ -4, -2, 0 };
+
+    float Signal(uint16_t value, int32_t phase)
+    {
+        auto color = value & 0x0f;
+        auto level = (value >> 4) & 0x03;
+        auto emphasis = value >> 6;
+
+        // colours $xE and $xF are black
+        if (color > 0x0d)
+            level = 1;
+
+        auto low = LowLevels[level];
+        auto high = HighLevels[level];
+        if (color == 0)
+            low = high;
+        else if (color > 0x0c)
+            high = low;
+
+        auto inColorPhase = [phase](int32_t hue) { return (hue + phase) % 12 < 6; };
+
+        auto signal = inColorPhase(color) ? high : low;
+
+        if (color < 0x0e &&
+            (((emphasis & 1) && inColorPhase(0)) ||
+             ((emphasis & 2) && inColorPhase(4)) ||
+             ((emphasis & 4) && inColorPhase(8))))
+        {
+            signal *= Attenuation;
+        }
+
+        return (signal - Black) / (White - Black);
+    }
+
+    // the overlap between two ranges
+    float Overlap(float start1, float end1, float start2, float end2)
+    {
+        return std::max(0.0f, std::min(end1, end2) - std::max(start1, start2));
+    }
+}
+
+NtscFilter::NtscFilter(uint32_t width, uint32_t threadCount) :
+    width_{ width },
+    threadPool_{ threadCount }
+{
+    BuildKernels();
+    BuildResampler();
+
+    for (auto i = 0u; i < GAMMA_SIZE; i++)
+    {
+        auto value = std::pow(static_cast<float>(i) / (GAMMA_SIZE - 1), Gamma);
+        gammaTable_[i] = static_cast<uint8_t>(std::lround(value * 255));
+    }
+}
+
+uint32_t NtscFilter::Width() const
+{
+    return width_;
+}
+
+void NtscFilter::Filter(const uint8_t* frame, uint32_t pitch, uint8_t colorPhase, uint8_t* output, uint32_t outputPitch)
+{
+    const uint32_t ScanlinesPerTask{ 16 };
+
+    auto taskCount = (HEIGHT + ScanlinesPerTask - 1) / ScanlinesPerTask;
+    threadPool_.ParallelFor(taskCount, [&](uint32_t task)
+        {
+            std::array<__m128, ACCUMULATOR_SIZE> accumulator;
+
+            auto startScanline = task * ScanlinesPerTask;
+            auto endScanline = std::min(startScanline + ScanlinesPerTask, HEIGHT);
+
+            for (auto scanline = startScanline; scanline < endScanline; scanline++)
+            {
+                // the phase moves on by 4 samples (a third of a colour cycle) each scanline
+                FilterScanline(
+                    reinterpret_cast<const uint16_t*>(frame + scanline * pitch),
+                    (colorPhase + scanline) % 3,
+                    accumulator.data(),
+                    reinterpret_cast<uint32_t*>(output + scanline * outputPitch));
+            }
+        });
+}
+
+void NtscFilter::BuildKernels()
+{
+    const auto pi = std::numbers::pi_v<float>;
+    const auto frequency = 2 * pi / SAMPLES_PER_CYCLE;
+    const auto outputSpacing = static_cast<float>(3 * SAMPLES_PER_PIXEL) / 7;
+
+    kernels_.resize(3 * 3 * KERNEL_VALUES * KERNEL_SIZE);
+
+    for (auto phase = 0u; phase < 3; phase++)
+    {
+        for (auto pixel = 0u; pixel < 3; pixel++)
+        {
+            for (auto value = 0u; value < KERNEL_VALUES; value++)
+            {
+                auto kernel = &kernels_[((phase * 3 + pixel) * KERNEL_VALUES + value) * KERNEL_SIZE];
+
+                for (auto i = 0; i < KERNEL_SIZE; i++)
+                {
+                    // the output pixel's position in samples, relative to the start of the group of pixels
+                    auto center = (KernelStart[pixel] + i + 0.5f) * outputSpacing;
+
+                    float y = 0, iPhase = 0, quadrature = 0;
+
+                    for (auto sample = 0; sample < SAMPLES_PER_PIXEL; sample++)
+                    {
+                        auto start = static_cast<float>(pixel * SAMPLES_PER_PIXEL + sample);
+                        auto end = start + 1;
+
+                        auto samplePhase = static_cast<int32_t>(pixel * SAMPLES_PER_PIXEL + sample + phase * 4);
+                        auto level = Signal(static_cast<uint16_t>(value), samplePhase % SAMPLES_PER_CYCLE);
+
+                        // the luma is the average over a single colour cycle, which cancels out the chroma.
+                        y += level * Overlap(start, end, center - 6, center + 6) / SAMPLES_PER_CYCLE;
+
+                        // the chroma is demodulated over two colour cycles.
+                        auto chromaStart = std::max(start, center - SAMPLES_PER_CYCLE);
+                        auto chromaEnd = std::min(end, center + SAMPLES_PER_CYCLE);
+                        if (chromaEnd > chromaStart)
+                        {
+                            auto offset = (phase * 4 + HueOffset) * frequency;
+                            auto startAngle = chromaStart * frequency + offset;
+                            auto endAngle = chromaEnd * frequency + offset;
+
+                            auto scale = level * Saturation / (frequency * SAMPLES_PER_CYCLE);
+                            iPhase += scale * (std::sin(endAngle) - std::sin(startAngle));
+                            quadrature += scale * (std::cos(startAngle) - std::cos(endAngle));
+                        }
+                    }
+
+                    // convert YIQ to RGB
+                    auto r = y + 0.946882f * iPhase + 0.623557f * quadrature;
+                    auto g = y - 0.274788f * iPhase - 0.635691f * quadrature;
+                    auto b = y - 1.108545f * iPhase + 1.709007f * quadrature;
+
+                    // scale to the range of the gamma table
+                    const auto scale = static_cast<float>(GAMMA_SIZE - 1);
+                    kernel[i] = _mm_set_ps(0, r * scale, g * scale, b * scale);
+                }
+            }
+        }
+    }
+}
+
+void NtscFilter::BuildResampler()
+{
+    if (width_ == NATIVE_WIDTH)
+        return;
+
+    resampleIndices_.resize(width_);
+    resampleWeights_.resize(width_);
+
+    for (auto x = 0u; x < width_; x++)
+    {
+        auto position = (x + 0.5f) * NATIVE_WIDTH / width_ - 0.5f;
+        position = std::clamp(position, 0.0f, static_cast<float>(NATIVE_WIDTH - 1));
+
+        auto index = static_cast<uint32_t>(position);
+        resampleIndices_[x] = index;
+        resampleWeights_[x] = position - index;
+    }
+}
+
+const __m128* NtscFilter::Kernel(uint32_t phase, uint32_t pixel, uint16_t value) const
+{
+    return &kernels_[((phase * 3 + pixel) * KERNEL_VALUES + value) * KERNEL_SIZE];
+}
+
+void NtscFilter::FilterScanline(const uint16_t* pixels, uint32_t phase, __m128* accumulator, uint32_t* output) const
+{
+    std::fill(accumulator, accumulator + ACCUMULATOR_SIZE, _mm_setzero_ps());
+
+    // the signal repeats every two colour cycles, which is three pixels
+    auto target = accumulator + KERNEL_OFFSET;
+    for (auto x = 0; x < Display::WIDTH; x += 3)
+    {
+        for (auto pixel = 0; pixel < 3 && x + pixel < Display::WIDTH; pixel++)
+        {
+            auto kernel = Kernel(phase, pixel, pixels[x + pixel] & (KERNEL_VALUES - 1));
+            auto pixelTarget = target + KernelStart[pixel];
+
+            for (auto i = 0; i < KERNEL_SIZE; i++)
+            {
+                pixelTarget[i] = _mm_add_ps(pixelTarget[i], kernel[i]);
+            }
+        }
+
+        target += 7;
+    }
+
+    if (width_ == NATIVE_WIDTH)
+        WriteNative(accumulator + KERNEL_OFFSET, output);
+    else
+        WriteResampled(accumulator + KERNEL_OFFSET, output);
+}
+
+void NtscFilter::WriteNative(const __m128* accumulator, uint32_t* output) const
+{
+    auto x = 0u;
+    for (; x + 2 <= NATIVE_WIDTH; x += 2)
+    {
+        WritePixels(accumulator[x], accumulator[x + 1], output + x);
+    }
+
+    if (x < NATIVE_WIDTH)
+    {
+        uint32_t pixels[2];
+        WritePixels(accumulator[x], accumulator[x], pixels);
+        output[x] = pixels[0];
+    }
+}
+
+void NtscFilter::WriteResampled(const __m128* accumulator, uint32_t* output) const
+{
+    auto resample = [&](uint32_t x)
+    {
+        auto index = resampleIndices_[x];
+        auto weight = _mm_set1_ps(resampleWeights_[x]);
+
+        auto pixel = accumulator[index];
+        return _mm_add_ps(pixel, _mm_mul_ps(_mm_sub_ps(accumulator[index + 1], pixel), weight));
+    };
+
+    auto x = 0u;
+    for (; x + 2 <= width_; x += 2)
+    {
+        WritePixels(resample(x), resample(x + 1), output + x);
+    }
+
+    if (x < width_)
+    {
+        uint32_t pixels[2];
+        auto pixel = resample(x);
+        WritePixels(pixel, pixel, pixels);
+        output[x] = pixels[0];
+    }
+}
+
+__forceinline void NtscFilter::WritePixels(__m128 pixel1, __m128 pixel2, uint32_t* output) const
+{
+    // clamp the channels to the gamma table, then look them up.
+    auto channels = _mm_packs_epi32(_mm_cvtps_epi32(pixel1), _mm_cvtps_epi32(pixel2));
+    channels = _mm_max_epi16(channels, _mm_setzero_si128());
+    channels = _mm_min_epi16(channels, _mm_set1_epi16(GAMMA_SIZE - 1));
+
+    alignas(16) uint16_t values[8];
+    _mm_store_si128(reinterpret_cast<__m128i*>(values), channels);
+
+    output[0] = gammaTable_[values[0]] | (gammaTable_[values[1]] << 8) | (gammaTable_[values[2]] << 16);
+    output[1] = gammaTable_[values[4]] | (gammaTable_[values[5]] << 8) | (gammaTable_[values[6]] << 16);
+}
\ No newline at end of file
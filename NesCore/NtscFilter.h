@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Display.h"
+#include "ThreadPool.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <emmintrin.h>
+
+// Simulates the NTSC composite signal, turning a frame rendered with PixelFormat::PaletteIndex into XRGB8888.  This
+// is intended to run as a separate stage once the frame is complete, and splits the work across a thread pool.
+class NtscFilter
+{
+public:
+    // the natural output width, where every 3 NES pixels (2 colour cycles) produce 7 output pixels.
+    static const uint32_t NATIVE_WIDTH{ (Display::WIDTH + 2) / 3 * 7 };
+    static const uint32_t HEIGHT{ Display::HEIGHT };
+
+    NtscFilter(uint32_t width = NATIVE_WIDTH, uint32_t threadCount = 0);
+
+    uint32_t Width() const;
+
+    // the colour phase is the one reported by the display for the frame.
+    void Filter(const uint8_t* frame, uint32_t pitch, uint8_t colorPhase, uint8_t* output, uint32_t outputPitch);
+
+private:
+    static const int32_t SAMPLES_PER_PIXEL{ 8 };
+    static const int32_t SAMPLES_PER_CYCLE{ 12 };
+
+    // each pixel contributes to a fixed span of output pixels, starting at an offset which depends on the pixel's
+    // position in its group of three.
+    static const int32_t KERNEL_SIZE{ 10 };
+    static const int32_t KERNEL_OFFSET{ 4 };
+    static const uint32_t KERNEL_VALUES{ 512 };
+
+    // the filter output is gamma corrected with a lookup table
+    static const uint32_t GAMMA_SIZE{ 1024 };
+
+    // we accumulate a scanline at the native resolution, with room for the pixels at each edge
+    static const uint32_t ACCUMULATOR_SIZE{ KERNEL_OFFSET + NATIVE_WIDTH + KERNEL_SIZE };
+
+    void BuildKernels();
+    void BuildResampler();
+
+    void FilterScanline(const uint16_t* pixels, uint32_t phase, __m128* accumulator, uint32_t* output) const;
+    void WriteNative(const __m128* accumulator, uint32_t* output) const;
+    void WriteResampled(const __m128* accumulator, uint32_t* output) const;
+    void WritePixels(__m128 pixel1, __m128 pixel2, uint32_t* output) const;
+
+    const __m128* Kernel(uint32_t phase, uint32_t pixel, uint16_t value) const;
+
+    uint32_t width_;
+
+    // the RGB contributions of each palette index and emphasis value, for each colour phase and position in the
+    // group of three pixels.
+    std::vector<__m128> kernels_;
+
+    // for each output pixel, the native pixel to interpolate from, and the weight of the following pixel.
+    std::vector<uint32_t> resampleIndices_;
+    std::vector<float> resampleWeights_;
+
+    std::array<uint8_t, GAMMA_SIZE> gammaTable_;
+
+    ThreadPool threadPool_;
+};
\ No newline at end of file
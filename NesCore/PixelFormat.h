@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstdint>
+
+enum class PixelFormat : uint8_t
+{
+    // 16 bits per pixel - the 6-bit palette index in the low bits, and the 3 emphasis bits in bits 6-8.
+    PaletteIndex,
+    Rgb565,
+    Xrgb8888
+};
\ No newline at end of file
@@ -4,7 +4,9 @@
 #include "Display.h"
 #include "PpuState.h"
 
+#include <bit>
 #include <cassert>
+#include <climits>
 
 
 Ppu::Ppu(Bus& bus, Display& display) :
@@ -17,6 +19,30 @@ Ppu::Ppu(Bus& bus, Display& display) :
     bus_.SchedulePpu(340, SyncEvent::PpuScanline);
 }
 
+void Ppu::PowerOn()
+{
+    background_.PowerOn();
+    sprites_.PowerOn();
+
+    state_ = {};
+    sprite0HitCycle_ = -1;
+    sprite0HitExact_ = false;
+    skipFrame_ = false;
+
+    UpdateDisplayPalette();
+
+    bus_.SchedulePpu(340, SyncEvent::PpuScanline);
+}
+
+void Ppu::Reset()
+{
+    Write(0x2000, 0);
+    Write(0x2001, 0);
+
+    state_.AddressLatch = false;
+    state_.PpuData = 0;
+}
+
 uint32_t Ppu::FrameCount()
 {
     return state_.FrameCount;
@@ -24,6 +50,9 @@ uint32_t Ppu::FrameCount()
 
 void Ppu::Sync()
 {
+    // external syncs are a sign that something is about to change the rendering
+    InvalidateSprite0Hit();
+
     Sync(ScanlineCycle());
 }
 
@@ -71,9 +100,14 @@ uint8_t Ppu::Read(uint16_t address)
         }
         else if (sprites_.Sprite0Visible())
         {
-            Sync(scanlineCycle);
+            // we only need to sync if we've passed the point where our last prediction is valid
+            if (!sprite0HitExact_ && scanlineCycle > sprite0HitCycle_)
+            {
+                Sync(scanlineCycle);
+                PredictSprite0Hit();
+            }
 
-            if (sprites_.Sprite0Hit())
+            if (sprites_.Sprite0Hit() || (sprite0HitExact_ && scanlineCycle > sprite0HitCycle_))
             {
                 status |= 0x40;
             }
@@ -142,6 +176,8 @@ void Ppu::Write(uint16_t address, uint8_t value)
 {
     auto targetCycle = ScanlineCycle();
 
+    InvalidateSprite0Hit();
+
     switch (address & 0x07)
     {
     case 0:
@@ -277,16 +313,16 @@ void Ppu::Write(uint16_t address, uint8_t value)
                 state_.Palette[writeAddress] = value;
                 state_.Palette[writeAddress | 0x0010] = value;
 
-                auto rgb = display_.GetPixel(value & state_.GrayscaleMask, state_.Emphasis);
-                state_.RgbPalette[writeAddress] = rgb;
-                state_.RgbPalette[writeAddress | 0x0010] = rgb;
+                auto pixel = display_.GetPixel(value & state_.GrayscaleMask, state_.Emphasis);
+                state_.DisplayPalette[writeAddress] = pixel;
+                state_.DisplayPalette[writeAddress | 0x0010] = pixel;
             }
             else
             {
                 writeAddress &= 0x0001f;
 
                 state_.Palette[writeAddress] = value;
-                state_.RgbPalette[writeAddress] = display_.GetPixel(value & state_.GrayscaleMask, state_.Emphasis);
+                state_.DisplayPalette[writeAddress] = display_.GetPixel(value & state_.GrayscaleMask, state_.Emphasis);
             }
         }
         else
@@ -310,6 +346,11 @@ void Ppu::DmaWrite(uint8_t value)
     sprites_.WriteOam(value);
 }
 
+void Ppu::DmaWrite(const uint8_t* data, uint32_t count)
+{
+    sprites_.WriteOam(data, count);
+}
+
 void Ppu::DmaCompleted()
 {
     sprites_.OamDmaCompleted();
@@ -332,6 +373,30 @@ void Ppu::RestoreState(const PpuState& state)
     state_ = state.Core;
     background_.RestoreState(state.Background);
     sprites_.RestoreState(state.Sprites);
+
+    // the display format may have changed since the state was captured
+    UpdateDisplayPalette();
+
+    InvalidateSprite0Hit();
+}
+
+void Ppu::UpdateDisplayPalette()
+{
+    for (auto index = 0; index < 32; index++)
+    {
+        state_.DisplayPalette[index] = display_.GetPixel(state_.Palette[index] & state_.GrayscaleMask, state_.Emphasis);
+    }
+}
+
+void Ppu::AttachCartBanks(const std::array<const uint8_t*, 16>* banks)
+{
+    background_.AttachBanks(banks);
+    sprites_.AttachBanks(banks);
+}
+
+void Ppu::SetSkipFrame(bool skip)
+{
+    skipFrame_ = skip;
 }
 
 void Ppu::UpdateA12Sensitivity(bool isLow)
@@ -389,6 +454,8 @@ void Ppu::SyncState()
 {
     auto scanlineCycle = ScanlineCycle();
 
+    InvalidateSprite0Hit();
+
     if (state_.UpdateBaseAddress)
     {
         // TODO: reschedule A12 if rendering
@@ -437,11 +504,7 @@ void Ppu::SyncState()
             state_.Emphasis = newEmphasis;
             state_.GrayscaleMask = newGrayscale;
 
-            // rebuild palette
-            for (auto index = 0; index < 32; index++)
-            {
-                state_.RgbPalette[index] = display_.GetPixel(state_.Palette[index] & state_.GrayscaleMask, state_.Emphasis);
-            }
+            UpdateDisplayPalette();
         }
 
         state_.UpdateMask = false;
@@ -477,6 +540,8 @@ void Ppu::SyncScanline()
 {
     assert(ScanlineCycle() == 340);
 
+    InvalidateSprite0Hit();
+
 #if DIAGNOSTIC
     auto currentScanline = state_.CurrentScanline;
 #endif
@@ -514,15 +579,19 @@ void Ppu::SyncScanline()
         PreRenderScanline(340);
         state_.CurrentScanline = 0;
 
+        // each PPU cycle is two thirds of a colour cycle, so a full frame moves the phase on by one third, or two
+        // thirds if we skip a cycle.
         if (state_.EnableRendering && (state_.FrameCount & 1))
         {
             state_.SyncCycle = 0;
             state_.ScanlineStartCycle = bus_.PpuCycleCount();
+            state_.ColorPhase = (state_.ColorPhase + 2) % 3;
         }
         else
         {
             state_.SyncCycle = -1;
             state_.ScanlineStartCycle = bus_.PpuCycleCount() + 1;
+            state_.ColorPhase = (state_.ColorPhase + 1) % 3;
         }
     }
     else
@@ -834,7 +903,14 @@ void Ppu::RenderScanlineVisible(int32_t targetCycle)
     {
         background_.RunLoad(state_.SyncCycle, maxIndex);
 
-        if (state_.EnableBackground)
+        // when skipping the frame, we only need the pixels to detect a sprite 0 hit.
+        auto render = !skipFrame_ || sprites_.Sprite0Visible();
+
+        if (!render)
+        {
+            background_.SkipRender(state_.SyncCycle, maxIndex);
+        }
+        else if (state_.EnableBackground)
         {
             background_.RunRender(state_.SyncCycle, maxIndex);
         }
@@ -843,7 +919,7 @@ void Ppu::RenderScanlineVisible(int32_t targetCycle)
             background_.RunBackgroundDisabled(state_.SyncCycle, maxIndex);
         }
 
-        if (state_.EnableForeground && state_.CurrentScanline != 0)
+        if (render && state_.EnableForeground && state_.CurrentScanline != 0)
         {
             sprites_.RunRender(state_.SyncCycle, maxIndex, background_.ScanlinePixels());
         }
@@ -851,6 +927,10 @@ void Ppu::RenderScanlineVisible(int32_t targetCycle)
         if (maxIndex > 64)
             sprites_.RunEvaluation(state_.CurrentScanline, std::max(state_.SyncCycle, 64), maxIndex);
     }
+    else if (skipFrame_)
+    {
+        background_.SkipRender(state_.SyncCycle, maxIndex);
+    }
     else
     {
         background_.RunRenderDisabled(state_.SyncCycle, maxIndex);
@@ -884,7 +964,14 @@ void Ppu::RenderScanlineVisible()
     {
         background_.RunLoad();
 
-        if (state_.EnableBackground)
+        // when skipping the frame, we only need the pixels to detect a sprite 0 hit.
+        auto render = !skipFrame_ || sprites_.Sprite0Visible();
+
+        if (!render)
+        {
+            // rendering a whole scanline leaves the shifter where it started.
+        }
+        else if (state_.EnableBackground)
         {
             background_.RenderScanline();
         }
@@ -893,13 +980,17 @@ void Ppu::RenderScanlineVisible()
             background_.RunBackgroundDisabled(0, 256);
         }
 
-        if (state_.EnableForeground && state_.CurrentScanline != 0)
+        if (render && state_.EnableForeground && state_.CurrentScanline != 0)
         {
             sprites_.RunRender(0, 256, background_.ScanlinePixels());
         }
 
         sprites_.RunEvaluation(state_.CurrentScanline);
     }
+    else if (skipFrame_)
+    {
+        background_.SkipRender(0, 256);
+    }
     else
     {
         background_.RunRenderDisabled(0, 256);
@@ -907,13 +998,26 @@ void Ppu::RenderScanlineVisible()
 }
 
 void Ppu::Composite(int32_t startCycle, int32_t endCycle)
+{
+    if (skipFrame_)
+        return;
+
+    auto scanline = display_.GetScanlinePtr();
+
+    if (display_.Format() == PixelFormat::Xrgb8888)
+        Composite(startCycle, endCycle, reinterpret_cast<uint32_t*>(scanline));
+    else
+        Composite(startCycle, endCycle, reinterpret_cast<uint16_t*>(scanline));
+}
+
+template <typename TPixel>
+void Ppu::Composite(int32_t startCycle, int32_t endCycle, TPixel* scanline)
 {
     // merge the sprites and the background
     auto& backgroundPixels = background_.ScanlinePixels();
     auto& spriteAttributes = sprites_.ScanlineAttributes();
     auto& spritePixels = sprites_.ScanlinePixels();
 
-    auto scanline = display_.GetScanlinePtr();
     if (sprites_.SpritesVisible())
     {
         for (auto i = startCycle; i < endCycle; i++)
@@ -933,7 +1037,7 @@ void Ppu::Composite(int32_t startCycle, int32_t endCycle)
                 }
             }
 
-            scanline[i] = state_.RgbPalette[pixel];
+            scanline[i] = static_cast<TPixel>(state_.DisplayPalette[pixel]);
         }
     }
     else
@@ -941,7 +1045,7 @@ void Ppu::Composite(int32_t startCycle, int32_t endCycle)
         for (auto i = startCycle; i < endCycle; i++)
         {
             auto pixel = backgroundPixels[i];
-            scanline[i] = state_.RgbPalette[pixel];
+            scanline[i] = static_cast<TPixel>(state_.DisplayPalette[pixel]);
         }
     }
 }
@@ -956,7 +1060,9 @@ void Ppu::FinishRender()
 #endif
 
     sprites_.HReset();
-    display_.HBlank();
+
+    if (!skipFrame_)
+        display_.HBlank();
 
     if (state_.EnableRendering)
         background_.HReset(state_.InitialAddress);
@@ -968,7 +1074,8 @@ void Ppu::FinishRender()
 
 void Ppu::Clear(int32_t scanline)
 {
-    auto pDisplay = display_.GetScanlinePtr(scanline);
+    // diagnostic output is only supported in the default display format
+    auto pDisplay = reinterpret_cast<uint32_t*>(display_.GetScanlinePtr(scanline));
     for (auto i = 0; i < Display::WIDTH; i++)
     {
         pDisplay[i] = 0;
@@ -979,7 +1086,7 @@ void Ppu::Clear(int32_t scanline)
 
 void Ppu::RenderOverlay(int32_t scanline)
 {
-    auto pDisplay = display_.GetScanlinePtr(scanline);
+    auto pDisplay = reinterpret_cast<uint32_t*>(display_.GetScanlinePtr(scanline));
     for (auto pixel : diagnosticOverlay_)
     {
         if (pixel)
@@ -993,13 +1100,67 @@ void Ppu::RenderOverlay(int32_t scanline)
 
 void Ppu::EnterVBlank()
 {
-    display_.VBlank();
+    if (!skipFrame_)
+        display_.VBlank(state_.ColorPhase);
 
     bus_.OnFrame();
 
     state_.FrameCount++;
 }
 
+void Ppu::PredictSprite0Hit()
+{
+    // assume the hit never happens on this scanline unless we find otherwise
+    sprite0HitExact_ = true;
+    sprite0HitCycle_ = INT32_MAX;
+
+    if (state_.CurrentScanline == 0 || state_.CurrentScanline >= 240 || state_.SyncCycle >= 256)
+        return;
+
+    if (!state_.EnableBackground || !state_.EnableForeground)
+        return;
+
+    uint32_t cycle;
+    auto pixels = sprites_.GetSprite0PendingPixels(state_.SyncCycle, &cycle);
+    if (!pixels)
+        return;
+
+    if (state_.SyncCycle <= 0)
+    {
+        // we haven't started rendering the background, but the sprite can't hit before its first opaque pixel.
+        sprite0HitExact_ = false;
+        sprite0HitCycle_ = cycle + std::countr_zero(pixels);
+        return;
+    }
+
+    for (; pixels; pixels >>= 1, cycle++)
+    {
+        if (!(pixels & 1))
+            continue;
+
+        bool opaque;
+        if (!background_.TryGetPixelOpaque(state_.SyncCycle, cycle, &opaque))
+        {
+            // the tile hasn't been fetched yet, but we know there was no hit up to here.
+            sprite0HitExact_ = false;
+            sprite0HitCycle_ = cycle;
+            return;
+        }
+
+        if (opaque)
+        {
+            sprite0HitCycle_ = cycle;
+            return;
+        }
+    }
+}
+
+void Ppu::InvalidateSprite0Hit()
+{
+    sprite0HitExact_ = false;
+    sprite0HitCycle_ = -1;
+}
+
 void Ppu::SetCurrentAddress(uint16_t address)
 {
     auto a12Before = (background_.CurrentAddress() & 0x1000) != 0;
@@ -16,6 +16,12 @@ class Ppu
 public:
     Ppu(Bus& bus, Display& display);
 
+    // puts the PPU back into its constructed state.  The bus must have been powered on first, since this schedules
+    // the first scanline.
+    void PowerOn();
+    // the reset line clears PPUCTRL, PPUMASK and the address latch, leaving the rest of the state alone.
+    void Reset();
+
     uint32_t FrameCount();
     int32_t ScanlineCycle() const;
 
@@ -28,6 +34,7 @@ public:
     void Write(uint16_t address, uint8_t value);
 
     void DmaWrite(uint8_t value);
+    void DmaWrite(const uint8_t* data, uint32_t count);
     void DmaCompleted();
 
     bool IsRenderingEnabled() const;
@@ -35,6 +42,14 @@ public:
     void CaptureState(PpuState* state) const;
     void RestoreState(const PpuState& state);
 
+    void UpdateDisplayPalette();
+
+    // gives the background and sprite fetches direct access to the cart's PPU banks.
+    void AttachCartBanks(const std::array<const uint8_t*, 16>* banks);
+
+    // skipped frames are emulated in full, but aren't drawn to the display.
+    void SetSkipFrame(bool skip);
+
     void UpdateA12Sensitivity(bool isLow);
     int32_t GetA12FallingEdgeCycleSmoothed() const;
 
@@ -54,6 +69,8 @@ private:
     void RenderScanlineVisible();
 
     void Composite(int32_t startCycle, int32_t endCycle);
+    template <typename TPixel>
+    void Composite(int32_t startCycle, int32_t endCycle, TPixel* scanline);
     void FinishRender();
 
 #ifdef DIAGNOSTIC
@@ -63,6 +80,9 @@ private:
 
     void EnterVBlank();
 
+    void PredictSprite0Hit();
+    void InvalidateSprite0Hit();
+
     void SetCurrentAddress(uint16_t address);
 
     void ScheduleA12Sync(int32_t cycle, bool isLow);
@@ -77,6 +97,13 @@ private:
 
     PpuCoreState state_;
 
+    // The predicted sprite 0 hit for the current scanline, so we can answer PPUSTATUS polling without syncing.  If
+    // the prediction is exact, the hit occurs on this cycle (or never, if it is INT32_MAX).  Otherwise we only know
+    // that it can't occur before this cycle.
+    int32_t sprite0HitCycle_{ -1 };
+    bool sprite0HitExact_{};
+
+    bool skipFrame_{};
 
 #if DIAGNOSTIC
     std::array<uint32_t, 341> diagnosticOverlay_{};
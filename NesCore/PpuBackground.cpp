@@ -8,6 +8,26 @@ PpuBackground::PpuBackground(Bus& bus) :
     state_.PatternBitShift = 7;
 }
 
+void PpuBackground::PowerOn()
+{
+    state_ = {};
+    state_.PatternBitShift = 7;
+
+    nextTileId_ = 0;
+    loadingIndex_ = 2;
+    scanlineTiles_ = {};
+    currentTileIndex_ = 0;
+    currentTile_ = {};
+    patternAddress_ = 0;
+    enabledCycle_ = 0;
+    backgroundPixels_ = {};
+}
+
+void PpuBackground::AttachBanks(const std::array<const uint8_t*, 16>* banks)
+{
+    banks_.Attach(banks);
+}
+
 void PpuBackground::SetBasePatternAddress(uint16_t address)
 {
     state_.BackgroundPatternBase = address;
@@ -121,6 +141,26 @@ void PpuBackground::RunRenderDisabled(uint32_t startCycle, uint32_t endCycle)
     }
 }
 
+void PpuBackground::SkipRender(uint32_t startCycle, uint32_t endCycle)
+{
+    // this leaves the shifter in the same state as calling Tick() for each cycle.
+    auto cycles = static_cast<int32_t>(endCycle - startCycle);
+    if (cycles <= state_.PatternBitShift)
+    {
+        state_.PatternBitShift -= cycles;
+        return;
+    }
+
+    // find the last cycle where we moved on to a new tile
+    auto tileCycle = startCycle + state_.PatternBitShift;
+    tileCycle += (endCycle - 1 - tileCycle) & ~7u;
+
+    state_.PatternBitShift = 7 - (endCycle - 1 - tileCycle);
+
+    currentTileIndex_ = (tileCycle >> 3) + 1;
+    currentTile_ = scanlineTiles_[currentTileIndex_];
+}
+
 void PpuBackground::RenderScanline()
 {
     auto pixelIndex = 0;
@@ -266,11 +306,52 @@ void PpuBackground::RenderScanline()
     // we never need the last pixel
 }
 
+void PpuBackground::RunLoad(int32_t startCycle, int32_t endCycle)
+{
+    switch (bus_.CartFetchMode())
+    {
+    case PpuFetchMode::Banked:
+        RunLoad<PpuFetchMode::Banked>(startCycle, endCycle);
+        break;
+
+    case PpuFetchMode::Latched:
+        if constexpr (IsFetchModeEnabled(PpuFetchMode::Latched))
+            RunLoad<PpuFetchMode::Latched>(startCycle, endCycle);
+        break;
+
+    case PpuFetchMode::MMC5:
+        if constexpr (IsFetchModeEnabled(PpuFetchMode::MMC5))
+            RunLoad<PpuFetchMode::MMC5>(startCycle, endCycle);
+        break;
+    }
+}
+
+void PpuBackground::RunLoad()
+{
+    switch (bus_.CartFetchMode())
+    {
+    case PpuFetchMode::Banked:
+        RunLoad<PpuFetchMode::Banked>();
+        break;
+
+    case PpuFetchMode::Latched:
+        if constexpr (IsFetchModeEnabled(PpuFetchMode::Latched))
+            RunLoad<PpuFetchMode::Latched>();
+        break;
+
+    case PpuFetchMode::MMC5:
+        if constexpr (IsFetchModeEnabled(PpuFetchMode::MMC5))
+            RunLoad<PpuFetchMode::MMC5>();
+        break;
+    }
+}
+
+template <PpuFetchMode TMode>
 void PpuBackground::RunLoad(int32_t startCycle, int32_t endCycle)
 {
     if (startCycle == 0 && endCycle == 256)
     {
-        RunLoad();
+        RunLoad<TMode>();
         return;
     }
 
@@ -287,9 +368,14 @@ void PpuBackground::RunLoad(int32_t startCycle, int32_t endCycle)
 
     case 1:
             {
-                bus_.TileSplitBeginTile(loadingIndex_);
+                if constexpr (TMode == PpuFetchMode::MMC5)
+                    bus_.TileSplitBeginTile(loadingIndex_);
+
                 auto tileAddress = (uint16_t)(0x2000 | state_.CurrentAddress & 0x0fff);
-                nextTileId_ = bus_.PpuReadNametable(tileAddress);
+                if constexpr (TMode == PpuFetchMode::MMC5)
+                    nextTileId_ = bus_.PpuReadNametable<TMode>(tileAddress);
+                else
+                    nextTileId_ = banks_.Read(tileAddress);
             }
 
             // Lock this in now - if the base address changes after this it doesn't take effect until the next tile.
@@ -317,7 +403,11 @@ void PpuBackground::RunLoad(int32_t startCycle, int32_t endCycle)
                     (state_.CurrentAddress >> 4) & 0x0038 | // 3 bits of tile y
                     (state_.CurrentAddress >> 2) & 0x0007); // 3 bits of tile x
 
-                auto attributes = bus_.PpuReadAttributes(attributeAddress);
+                uint8_t attributes;
+                if constexpr (TMode == PpuFetchMode::MMC5)
+                    attributes = bus_.PpuReadAttributes<TMode>(attributeAddress);
+                else
+                    attributes = banks_.Read(attributeAddress);
 
                 // use one more bit of the tile x and y to get the quadrant
                 attributes >>= ((state_.CurrentAddress & 0x0040) >> 4) | (state_.CurrentAddress & 0x0002);
@@ -335,7 +425,10 @@ void PpuBackground::RunLoad(int32_t startCycle, int32_t endCycle)
             [[fallthrough]];
 
     case 5:
-            scanlineTiles_[loadingIndex_].PatternBytes = bus_.PpuReadPatternLow(patternAddress_);
+            if constexpr (TMode == PpuFetchMode::MMC5)
+                scanlineTiles_[loadingIndex_].PatternBytes = bus_.PpuReadPatternLow<TMode>(patternAddress_);
+            else
+                scanlineTiles_[loadingIndex_].PatternBytes = banks_.Read(patternAddress_);
             cycle++;
             [[fallthrough]];
 
@@ -347,7 +440,10 @@ void PpuBackground::RunLoad(int32_t startCycle, int32_t endCycle)
 
     case 7:
             // address is 000PTTTTTTTT1YYY
-            scanlineTiles_[loadingIndex_].PatternBytes |= bus_.PpuReadPatternHigh((uint16_t)(patternAddress_ | 8)) << 8;
+            if constexpr (TMode == PpuFetchMode::Banked)
+                scanlineTiles_[loadingIndex_].PatternBytes |= banks_.Read((uint16_t)(patternAddress_ | 8)) << 8;
+            else
+                scanlineTiles_[loadingIndex_].PatternBytes |= bus_.PpuReadPatternHigh<TMode>((uint16_t)(patternAddress_ | 8)) << 8;
 
             // increment the x part of the address
             if ((state_.CurrentAddress & 0x001f) == 0x001f)
@@ -373,14 +469,19 @@ void PpuBackground::RunLoad(int32_t startCycle, int32_t endCycle)
     }
 }
 
+template <PpuFetchMode TMode>
 void PpuBackground::RunLoad()
 {
     while (true)
     {
-        bus_.TileSplitBeginTile(loadingIndex_);
+        if constexpr (TMode == PpuFetchMode::MMC5)
+            bus_.TileSplitBeginTile(loadingIndex_);
 
         auto tileAddress = (uint16_t)(0x2000 | state_.CurrentAddress & 0x0fff);
-        nextTileId_ = bus_.PpuReadNametable(tileAddress);
+        if constexpr (TMode == PpuFetchMode::MMC5)
+            nextTileId_ = bus_.PpuReadNametable<TMode>(tileAddress);
+        else
+            nextTileId_ = banks_.Read(tileAddress);
 
         auto attributeAddress = (uint16_t)(
             0x2000 | (state_.CurrentAddress & 0x0C00) | // select table
@@ -388,7 +489,11 @@ void PpuBackground::RunLoad()
             (state_.CurrentAddress >> 4) & 0x0038 | // 3 bits of tile y
             (state_.CurrentAddress >> 2) & 0x0007); // 3 bits of tile x
 
-        auto attributes = bus_.PpuReadAttributes(attributeAddress);
+        uint8_t attributes;
+        if constexpr (TMode == PpuFetchMode::MMC5)
+            attributes = bus_.PpuReadAttributes<TMode>(attributeAddress);
+        else
+            attributes = banks_.Read(attributeAddress);
 
         // use one more bit of the tile x and y to get the quadrant
         attributes >>= ((state_.CurrentAddress & 0x0040) >> 4) | (state_.CurrentAddress & 0x0002);
@@ -402,7 +507,11 @@ void PpuBackground::RunLoad()
             (nextTileId_ << 4) |
                 (state_.CurrentAddress >> 12)); // fineY
 
-        auto pattern = bus_.PpuReadPattern16(patternAddress_);
+        uint16_t pattern;
+        if constexpr (TMode == PpuFetchMode::Banked)
+            pattern = banks_.Read16(patternAddress_);
+        else
+            pattern = bus_.PpuReadPattern16<TMode>(patternAddress_);
 
         // low address is 000PTTTTTTTT0YYY
         // high address is 000PTTTTTTTT1YYY
@@ -520,6 +629,25 @@ const std::array<uint8_t, 256>& PpuBackground::ScanlinePixels() const
     return backgroundPixels_;
 }
 
+bool PpuBackground::TryGetPixelOpaque(int32_t syncCycle, int32_t cycle, bool* opaque) const
+{
+    if (static_cast<uint32_t>(cycle) < state_.LeftCrop)
+    {
+        *opaque = false;
+        return true;
+    }
+
+    // the current tile and shift describe the pixel at syncCycle, so work out how far along the tiles we need to go.
+    auto position = (currentTileIndex_ << 3) + (7 - state_.PatternBitShift) + (cycle - syncCycle);
+    auto tileIndex = static_cast<uint32_t>(position) >> 3;
+    if (tileIndex >= loadingIndex_)
+        return false;
+
+    auto patternBits = scanlineTiles_[tileIndex].PatternBytes >> (7 - (position & 7));
+    *opaque = (patternBits & 0x0101) != 0;
+    return true;
+}
+
 void PpuBackground::CaptureState(PpuBackgroundState* state) const
 {
     *state = state_;
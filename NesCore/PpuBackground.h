@@ -4,6 +4,8 @@
 #include <cstdint>
 
 #include "PpuBackgroundState.h"
+#include "PpuBankView.h"
+#include "PpuFetchMode.h"
 
 class Bus;
 
@@ -12,6 +14,10 @@ class PpuBackground
 public:
     PpuBackground(Bus& bus);
 
+    void PowerOn();
+
+    void AttachBanks(const std::array<const uint8_t*, 16>* banks);
+
     uint16_t GetBasePatternAddress() const;
     void SetBasePatternAddress(uint16_t address);
 
@@ -27,6 +33,8 @@ public:
     void RunRender(uint32_t startCycle, uint32_t endCycle);
     void RunBackgroundDisabled(uint32_t startCycle, uint32_t endCycle);
     void RunRenderDisabled(uint32_t startCycle, uint32_t endCycle);
+    // advance through the scanline without producing any pixels (for skipped frames).
+    void SkipRender(uint32_t startCycle, uint32_t endCycle);
 
     void RenderScanline();
 
@@ -49,6 +57,10 @@ public:
 
     const std::array<uint8_t, 256>& ScanlinePixels() const;
 
+    // Predicts whether the pixel at the given cycle will be opaque, using the tiles fetched so far.  Returns false
+    // if the tile for that pixel hasn't been fetched yet.
+    bool TryGetPixelOpaque(int32_t syncCycle, int32_t cycle, bool* opaque) const;
+
     void CaptureState(PpuBackgroundState* state) const;
     void RestoreState(const PpuBackgroundState& state);
 
@@ -73,7 +85,12 @@ private:
         uint8_t Padding{};
     };
 
+    // the tile fetches, specialised for the cart's fetch mode.
+    template <PpuFetchMode TMode> void RunLoad(int32_t startCycle, int32_t endCycle);
+    template <PpuFetchMode TMode> void RunLoad();
+
     Bus& bus_;
+    PpuBankView banks_;
 
     PpuBackgroundState state_;
 
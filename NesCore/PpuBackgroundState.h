@@ -5,9 +5,12 @@
 struct PpuBackgroundState
 {
     uint16_t CurrentAddress{};
-    uint8_t FineX{};
     uint16_t BackgroundPatternBase{};
     uint32_t LeftCrop{};
 
     int32_t PatternBitShift;
+
+    uint8_t FineX{};
+
+    uint8_t Padding[3]{};
 };
\ No newline at end of file
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+// A direct view of the cart's 1K PPU banks, so that fetches without side effects don't need to go through the bus.
+// This points at the cart's bank table, so bank switches are seen as soon as the cart makes them.
+class PpuBankView
+{
+public:
+    void Attach(const std::array<const uint8_t*, 16>* banks);
+
+    uint8_t Read(uint16_t address) const;
+    // reads the low and high bitplanes of a pattern row
+    uint16_t Read16(uint16_t address) const;
+
+private:
+    const std::array<const uint8_t*, 16>* banks_{};
+};
+
+inline void PpuBankView::Attach(const std::array<const uint8_t*, 16>* banks)
+{
+    banks_ = banks;
+}
+
+__forceinline uint8_t PpuBankView::Read(uint16_t address) const
+{
+    auto bank = (*banks_)[address >> 10];
+    return bank[address & 0x03ff];
+}
+
+__forceinline uint16_t PpuBankView::Read16(uint16_t address) const
+{
+    auto bank = (*banks_)[address >> 10];
+    auto bankAddress = address & 0x03ff;
+    return (bank[bankAddress | 8] << 8) | bank[bankAddress];
+}
@@ -10,8 +10,8 @@ struct PpuCoreState
     uint8_t PpuData{};
 
     // PPUCTRL
-    bool EnableVBlankInterrupt{};
     uint16_t AddressIncrement{ 1 };
+    bool EnableVBlankInterrupt{};
 
     // PPUMASK
     bool EnableBackground{};
@@ -25,11 +25,9 @@ struct PpuCoreState
     // the bits in the address registers can be viewed as 0yyy NNYY YYYX XXXX
     uint16_t InitialAddress{};
 
-    uint8_t GrayscaleMask{ 0xff };
-    uint8_t Emphasis{ 0 };
     uint8_t Palette[32]{ };
-    // TODO: this can be recomputed when we restore state
-    uint32_t RgbPalette[32]{ };
+    // the palette in the display's pixel format - this is recomputed when we restore state
+    uint32_t DisplayPalette[32]{ };
 
     // TODO: we don't need all these fields in our stored state.
     int32_t CurrentScanline{ 0 };
@@ -44,4 +42,12 @@ struct PpuCoreState
     // a 2-cycle delay for updating the PPU masks.
     bool UpdateMask{};
     uint8_t Mask{};
+
+    uint8_t GrayscaleMask{ 0xff };
+    uint8_t Emphasis{ 0 };
+
+    // the phase of the NTSC colour subcarrier at the start of the frame, in thirds of a colour cycle.
+    uint8_t ColorPhase{};
+
+    uint8_t Padding[2]{};
 };
\ No newline at end of file
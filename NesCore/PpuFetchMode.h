@@ -0,0 +1,33 @@
+#pragma once
+
+#include "MapperType.h"
+
+#include <cstdint>
+
+// How the cart responds to the PPU's rendering fetches.  The PPU's fetch loops are specialised on this, so that the
+// common case compiles down to a bank lookup.
+enum class PpuFetchMode : uint8_t
+{
+    // every fetch is a read from the current CHR bank
+    Banked,
+    // pattern fetches of particular tiles switch the CHR banks (MMC2)
+    Latched,
+    // fetches are intercepted for extended attributes and split screen (MMC5)
+    MMC5
+};
+
+// whether any of the mappers using the fetch mode are compiled in.
+constexpr bool IsFetchModeEnabled(PpuFetchMode mode)
+{
+    switch (mode)
+    {
+    case PpuFetchMode::Latched:
+        return IsMapperEnabled(MapperType::MMC2);
+
+    case PpuFetchMode::MMC5:
+        return IsMapperEnabled(MapperType::MMC5);
+
+    default:
+        return true;
+    }
+}
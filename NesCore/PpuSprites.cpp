@@ -1,6 +1,7 @@
 #include "Bus.h"
 #include "PpuSprites.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
 
@@ -9,6 +10,29 @@ PpuSprites::PpuSprites(Bus& bus) :
 {
 }
 
+void PpuSprites::PowerOn()
+{
+    state_ = {};
+
+    patternAddress_ = 0;
+    oamCopy_ = {};
+    oamCopyIndex_ = 0;
+    spriteIndex_ = 0;
+    sprites_ = {};
+    sprite0Selected_ = false;
+    sprite0Visible_ = false;
+    scanlineSpriteCount_ = 0;
+    allLargeSpritesHighTable_ = false;
+    spritesRendered_ = false;
+    scanlineAttributes_ = {};
+    scanlineData_ = {};
+}
+
+void PpuSprites::AttachBanks(const std::array<const uint8_t*, 16>* banks)
+{
+    banks_.Attach(banks);
+}
+
 void PpuSprites::SetLargeSprites(bool enabled)
 {
     state_.largeSprites_ = enabled;
@@ -44,6 +68,17 @@ void PpuSprites::WriteOam(uint8_t value)
     state_.oam_[state_.oamAddress_++] = value;
 }
 
+void PpuSprites::WriteOam(const uint8_t* data, uint32_t count)
+{
+    // the OAM address wraps around
+    auto address = state_.oamAddress_;
+    auto firstCount = std::min<uint32_t>(count, 256 - address);
+    std::copy(data, data + firstCount, state_.oam_.begin() + address);
+    std::copy(data + firstCount, data + count, state_.oam_.begin());
+
+    state_.oamAddress_ = static_cast<uint8_t>(address + count);
+}
+
 uint8_t PpuSprites::ReadOam() const
 {
     // TODO: if loading, return oam_[0]
@@ -294,6 +329,43 @@ bool PpuSprites::Sprite0Visible() const
     return sprite0Visible_;
 }
 
+uint32_t PpuSprites::GetSprite0PendingPixels(int32_t scanlineCycle, uint32_t* startCycle) const
+{
+    // returns a mask of the opaque sprite 0 pixels that have not been rendered yet, where bit 0 is *startCycle.
+    if (!sprite0Visible_)
+        return 0;
+
+    auto& sprite = sprites_[0];
+    *startCycle = std::max(static_cast<uint32_t>(sprite.X), static_cast<uint32_t>(std::max(scanlineCycle, 0)));
+
+    // the shift registers have already been shifted past any pixels we have rendered
+    uint32_t opaque = sprite.patternShiftHigh | sprite.patternShiftLow;
+    uint32_t pixels;
+    if ((sprite.attributes & 0x40) == 0)
+    {
+        // reverse the bits so the next pixel is in bit 0
+        pixels = 0;
+        for (auto i = 0; i < 8; i++)
+        {
+            pixels |= ((opaque >> (7 - i)) & 1) << i;
+        }
+    }
+    else
+    {
+        pixels = opaque;
+    }
+
+    // we never render past the end of the scanline
+    if (*startCycle >= 256)
+        return 0;
+
+    auto remaining = 256 - *startCycle;
+    if (remaining < 8)
+        pixels &= (1u << remaining) - 1;
+
+    return pixels;
+}
+
 bool PpuSprites::Sprite0Hit() const
 {
     return state_.sprite0Hit_;
@@ -319,6 +391,47 @@ bool PpuSprites::IsHighTable(int32_t spriteIndex) const
     return tileId & 1;
 }
 
+void PpuSprites::RunLoad(uint32_t currentScanline, uint32_t scanlineCycle, uint32_t targetCycle)
+{
+    switch (bus_.CartFetchMode())
+    {
+    case PpuFetchMode::Banked:
+        RunLoad<PpuFetchMode::Banked>(currentScanline, scanlineCycle, targetCycle);
+        break;
+
+    case PpuFetchMode::Latched:
+        if constexpr (IsFetchModeEnabled(PpuFetchMode::Latched))
+            RunLoad<PpuFetchMode::Latched>(currentScanline, scanlineCycle, targetCycle);
+        break;
+
+    case PpuFetchMode::MMC5:
+        if constexpr (IsFetchModeEnabled(PpuFetchMode::MMC5))
+            RunLoad<PpuFetchMode::MMC5>(currentScanline, scanlineCycle, targetCycle);
+        break;
+    }
+}
+
+void PpuSprites::RunLoad(uint32_t currentScanline)
+{
+    switch (bus_.CartFetchMode())
+    {
+    case PpuFetchMode::Banked:
+        RunLoad<PpuFetchMode::Banked>(currentScanline);
+        break;
+
+    case PpuFetchMode::Latched:
+        if constexpr (IsFetchModeEnabled(PpuFetchMode::Latched))
+            RunLoad<PpuFetchMode::Latched>(currentScanline);
+        break;
+
+    case PpuFetchMode::MMC5:
+        if constexpr (IsFetchModeEnabled(PpuFetchMode::MMC5))
+            RunLoad<PpuFetchMode::MMC5>(currentScanline);
+        break;
+    }
+}
+
+template <PpuFetchMode TMode>
 void PpuSprites::RunLoad(uint32_t currentScanline, uint32_t scanlineCycle, uint32_t targetCycle)
 {
     // the OAM address is forced to 0 during the whole load phase.
@@ -400,10 +513,9 @@ void PpuSprites::RunLoad(uint32_t currentScanline, uint32_t scanlineCycle, uint3
                             (tileId << 4) | tileFineY);
                 }
 
-                sprites_[spriteIndex_].patternShiftLow = bus_.PpuReadSpritePatternLow(patternAddress_);
+                sprites_[spriteIndex_].patternShiftLow = banks_.Read(patternAddress_);
             }
 
-
             scanlineCycle++;
             if (scanlineCycle >= targetCycle)
                 break;
@@ -415,7 +527,10 @@ void PpuSprites::RunLoad(uint32_t currentScanline, uint32_t scanlineCycle, uint3
 
     case 7:
             // address is 000PTTTTTTTT1YYY
-            sprites_[spriteIndex_].patternShiftHigh = bus_.PpuReadSpritePatternHigh((uint16_t)(patternAddress_ | 8));
+            if constexpr (TMode == PpuFetchMode::Banked)
+                sprites_[spriteIndex_].patternShiftHigh = banks_.Read((uint16_t)(patternAddress_ | 8));
+            else
+                sprites_[spriteIndex_].patternShiftHigh = bus_.PpuReadSpritePatternHigh<TMode>((uint16_t)(patternAddress_ | 8));
             spriteIndex_++;
 
             if (spriteIndex_ >= scanlineSpriteCount_)
@@ -434,6 +549,7 @@ void PpuSprites::RunLoad(uint32_t currentScanline, uint32_t scanlineCycle, uint3
 
 }
 
+template <PpuFetchMode TMode>
 void PpuSprites::RunLoad(uint32_t currentScanline)
 {
     // the OAM address is forced to 0 during the whole load phase.
@@ -476,10 +592,13 @@ void PpuSprites::RunLoad(uint32_t currentScanline)
         }
 
         // TODO: PpuReadSpritePattern16?
-        sprites_[spriteIndex_].patternShiftLow = bus_.PpuReadSpritePatternLow(patternAddress_);
+        sprites_[spriteIndex_].patternShiftLow = banks_.Read(patternAddress_);
 
         // address is 000PTTTTTTTT1YYY
-        sprites_[spriteIndex_].patternShiftHigh = bus_.PpuReadSpritePatternHigh((uint16_t)(patternAddress_ | 8));
+        if constexpr (TMode == PpuFetchMode::Banked)
+            sprites_[spriteIndex_].patternShiftHigh = banks_.Read((uint16_t)(patternAddress_ | 8));
+        else
+            sprites_[spriteIndex_].patternShiftHigh = bus_.PpuReadSpritePatternHigh<TMode>((uint16_t)(patternAddress_ | 8));
         spriteIndex_++;
     }
 }
@@ -2,6 +2,8 @@
 
 #include <cstdint>
 
+#include "PpuBankView.h"
+#include "PpuFetchMode.h"
 #include "PpuSpritesState.h"
 
 class Bus;
@@ -11,6 +13,10 @@ class PpuSprites
 public:
     PpuSprites(Bus& bus);
 
+    void PowerOn();
+
+    void AttachBanks(const std::array<const uint8_t*, 16>* banks);
+
     void SetLargeSprites(bool enabled);
     bool LargeSprites() const;
 
@@ -21,6 +27,7 @@ public:
 
     void SetOamAddress(uint8_t value);
     void WriteOam(uint8_t value);
+    void WriteOam(const uint8_t* data, uint32_t count);
     uint8_t ReadOam() const;
 
     void OamDmaCompleted();
@@ -35,6 +42,7 @@ public:
     bool SpritesVisible() const;
 
     bool Sprite0Visible() const;
+    uint32_t GetSprite0PendingPixels(int32_t scanlineCycle, uint32_t* startCycle) const;
     bool Sprite0Hit() const;
     bool SpriteOverflow() const;
 
@@ -66,7 +74,12 @@ private:
         uint8_t attributes;
     };
 
+    // the pattern fetches, specialised for the cart's fetch mode.
+    template <PpuFetchMode TMode> void RunLoad(uint32_t scanline, uint32_t scanlineCycle, uint32_t targetCycle);
+    template <PpuFetchMode TMode> void RunLoad(uint32_t scanline);
+
     Bus& bus_;
+    PpuBankView banks_;
 
     PpuSpritesState state_;
 
@@ -2,15 +2,17 @@
 
 struct PpuSpritesState
 {
-    bool largeSprites_{};
+    uint32_t spriteEvaluationOamAddress_{};
+    uint32_t leftCrop_;
+
     uint16_t spritePatternBase_{};
+    bool largeSprites_{};
 
     uint8_t oamAddress_{};
-    uint32_t spriteEvaluationOamAddress_{};
     std::array<uint8_t, 256> oam_{};
 
     bool sprite0Hit_{};
     bool spriteOverflow_{};
 
-    uint32_t leftCrop_;
+    uint8_t padding_[2]{};
 };
\ No newline at end of file
@@ -1,15 +1,18 @@
 #include "RomFile.h"
 
+#include "MappedFile.h"
+
 #include <vector>
 
-RomFile::RomFile(CartDescriptor descriptor, std::vector<uint8_t> prgData, std::vector<uint8_t> chrData)
+RomFile::RomFile(CartDescriptor descriptor, std::span<const uint8_t> prgData, std::span<const uint8_t> chrData, std::shared_ptr<void> storage)
     : Descriptor(std::move(descriptor)),
-    PrgData(std::move(prgData)),
-    ChrData(std::move(chrData))
+    PrgData(prgData),
+    ChrData(chrData),
+    Storage(std::move(storage))
 {
 }
 
-std::unique_ptr<RomFile> TryLoadINesFile(const uint8_t* data, size_t length)
+static std::unique_ptr<RomFile> TryParseINesFile(const uint8_t* data, size_t length, std::shared_ptr<void> storage)
 {
     auto end = data + length;
 
@@ -44,7 +47,7 @@ std::unique_ptr<RomFile> TryLoadINesFile(const uint8_t* data, size_t length)
         return nullptr;
     }
 
-    std::vector<uint8_t> prgData{ data, prgEnd };
+    std::span<const uint8_t> prgData{ data, prgEnd };
 
     data = prgEnd;
 
@@ -52,11 +55,7 @@ std::unique_ptr<RomFile> TryLoadINesFile(const uint8_t* data, size_t length)
     if (chrEnd > end)
         return nullptr;
 
-    std::vector<uint8_t> chrData;
-    if (chrSize != 0)
-    {
-        chrData = std::vector<uint8_t>(data, chrEnd);
-    }
+    std::span<const uint8_t> chrData{ data, chrEnd };
 
     data = chrEnd;
 
@@ -86,5 +85,20 @@ std::unique_ptr<RomFile> TryLoadINesFile(const uint8_t* data, size_t length)
         descriptor.ChrRamSize = 0x2000;
     }
 
-    return std::make_unique<RomFile>(std::move(descriptor), std::move(prgData), std::move(chrData));
+    return std::make_unique<RomFile>(std::move(descriptor), prgData, chrData, std::move(storage));
+}
+
+std::unique_ptr<RomFile> TryLoadINesFile(const uint8_t* data, size_t length)
+{
+    auto storage = std::make_shared<std::vector<uint8_t>>(data, data + length);
+    return TryParseINesFile(storage->data(), length, storage);
+}
+
+std::unique_ptr<RomFile> TryMapINesFile(const std::filesystem::path& path)
+{
+    auto file = MappedFile::TryOpen(path);
+    if (!file)
+        return nullptr;
+
+    return TryParseINesFile(file->Data(), file->Size(), file);
 }
@@ -3,16 +3,26 @@
 #include "CartDescriptor.h"
 
 #include <cstdint>
+#include <filesystem>
 #include <memory>
-#include <vector>
+#include <span>
 
 struct RomFile
 {
-    RomFile(CartDescriptor descriptor, std::vector<uint8_t> prgData, std::vector<uint8_t> chrData);
+    RomFile(CartDescriptor descriptor, std::span<const uint8_t> prgData, std::span<const uint8_t> chrData, std::shared_ptr<void> storage);
 
     CartDescriptor Descriptor;
-    std::vector<uint8_t> PrgData;
-    std::vector<uint8_t> ChrData;
+
+    // the ROM images, which point into the storage.
+    std::span<const uint8_t> PrgData;
+    std::span<const uint8_t> ChrData;
+
+    // keeps the ROM images alive - either a copy of the file, or a read-only mapping of it.
+    std::shared_ptr<void> Storage;
 };
 
-std::unique_ptr<RomFile> TryLoadINesFile(const uint8_t* data, size_t length);
\ No newline at end of file
+// parses a ROM file in memory, copying the data.
+std::unique_ptr<RomFile> TryLoadINesFile(const uint8_t* data, size_t length);
+
+// maps a ROM file into memory, without copying the data.
+std::unique_ptr<RomFile> TryMapINesFile(const std::filesystem::path& path);
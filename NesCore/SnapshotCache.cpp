@@ -0,0 +1,88 @@
+#include "SnapshotCache.h"
+
+#include "MappedFile.h"
+#include "NesSystem.h"
+#include "StateSerializer.h"
+#include "SystemState.h"
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <vector>
+
+const char* SnapshotCache::BOOT_SNAPSHOT = "boot";
+
+SnapshotCache::SnapshotCache(std::filesystem::path directory) :
+    directory_{ std::move(directory) }
+{
+}
+
+bool SnapshotCache::TryLoad(uint32_t romCrc32, const std::string& name, NesSystem& system) const
+{
+    auto file = MappedFile::TryOpen(SnapshotPath(romCrc32, name));
+    if (!file)
+        return false;
+
+    auto state = std::make_unique<SystemState>();
+    if (!TryDeserializeState(file->Data(), file->Size(), system.Apu().SamplesPerFrame(), state.get()))
+        return false;
+
+    return system.TryRestoreState(*state);
+}
+
+bool SnapshotCache::Save(uint32_t romCrc32, const std::string& name, NesSystem& system) const
+{
+    auto state = std::make_unique<SystemState>();
+    system.CaptureState(state.get());
+
+    auto samplesPerFrame = system.Apu().SamplesPerFrame();
+    std::vector<uint8_t> data(SerializedStateSize(samplesPerFrame));
+    SerializeState(*state, samplesPerFrame, data.data());
+
+    std::error_code error;
+    std::filesystem::create_directories(directory_, error);
+
+    // other processes may be reading the same snapshot, so we write a temporary file and move it into place.
+    auto path = SnapshotPath(romCrc32, name);
+    auto tempPath = path;
+    tempPath += "." + std::to_string(std::random_device{}()) + ".tmp";
+
+    {
+        std::ofstream stream(tempPath, std::ios::binary);
+        if (!stream.write(reinterpret_cast<const char*>(data.data()), data.size()))
+            return false;
+    }
+
+    std::filesystem::rename(tempPath, path, error);
+    if (error)
+    {
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+
+    return true;
+}
+
+bool SnapshotCache::Boot(uint32_t romCrc32, uint32_t frames, NesSystem& system) const
+{
+    auto name = std::string(BOOT_SNAPSHOT) + "-" + std::to_string(frames);
+    if (TryLoad(romCrc32, name, system))
+        return true;
+
+    system.PowerCycle();
+    if (frames)
+        system.RunFrame(frames - 1);
+
+    Save(romCrc32, name, system);
+    return false;
+}
+
+std::filesystem::path SnapshotCache::SnapshotPath(uint32_t romCrc32, const std::string& name) const
+{
+    // a snapshot is only reused by a build which both stores it the same way and would reach the same state.
+    char prefix[48];
+    std::snprintf(prefix, sizeof(prefix), "%08x-v%u.%u-", romCrc32, STATE_LAYOUT_VERSION, CORE_VERSION);
+
+    return directory_ / (prefix + name + ".state");
+}
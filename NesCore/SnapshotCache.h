@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+class NesSystem;
+
+// An on-disk cache of system states for each ROM, so that runs which start the same game many times can skip straight
+// past the boot sequence, or to a checkpoint.  The states are keyed by the ROM's CRC, and a state saved by a build with
+// a different state layout or core version is ignored.
+class SnapshotCache
+{
+public:
+    SnapshotCache(std::filesystem::path directory);
+
+    // the name of the state reached by running from reset, which is used by Boot.
+    static const char* BOOT_SNAPSHOT;
+
+    // the name must be usable as part of a file name.
+    bool TryLoad(uint32_t romCrc32, const std::string& name, NesSystem& system) const;
+    bool Save(uint32_t romCrc32, const std::string& name, NesSystem& system) const;
+
+    // power cycles the system and runs it for the given number of frames, or restores the result from the cache if a
+    // previous run saved it.  Returns whether the cached state was used.
+    bool Boot(uint32_t romCrc32, uint32_t frames, NesSystem& system) const;
+
+private:
+    std::filesystem::path SnapshotPath(uint32_t romCrc32, const std::string& name) const;
+
+    std::filesystem::path directory_;
+};
@@ -0,0 +1,407 @@
+#include "StateHash.h"
+
+#include "SystemState.h"
+
+#include <bit>
+
+namespace
+{
+    const uint64_t Prime1{ 0x9e3779b185ebca87 };
+    const uint64_t Prime2{ 0xc2b2ae3d27d4eb4f };
+    const uint64_t Prime3{ 0x165667b19e3779f9 };
+
+    uint64_t Read64(const uint8_t* data)
+    {
+        uint64_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    uint64_t Round(uint64_t lane, uint64_t input)
+    {
+        return std::rotl(lane + input * Prime2, 31) * Prime1;
+    }
+
+    uint64_t Avalanche(uint64_t hash)
+    {
+        hash ^= hash >> 33;
+        hash *= Prime2;
+        hash ^= hash >> 29;
+        hash *= Prime3;
+        return hash ^ (hash >> 32);
+    }
+
+    void Add(StateHasher& hasher, const CpuState& state)
+    {
+        hasher.Add(state.A);
+        hasher.Add(state.X);
+        hasher.Add(state.Y);
+        hasher.Add(state.PC);
+        hasher.Add(state.S);
+        hasher.Add(state.C);
+        hasher.Add(state.Z);
+        hasher.Add(state.I);
+        hasher.Add(state.D);
+        hasher.Add(state.B);
+        hasher.Add(state.V);
+        hasher.Add(state.N);
+        hasher.Add(state.InterruptVector);
+        hasher.Add(state.Irq);
+        hasher.Add(state.SkipInterrupt);
+    }
+
+    void Add(StateHasher& hasher, const BusCoreState& state)
+    {
+        hasher.Add(state.PpuRam.data(), state.PpuRam.size());
+        hasher.Add(state.CpuCycleCount);
+        hasher.Add(state.PpuCycleCount);
+        hasher.Add(state.Dma);
+        hasher.Add(state.OamDma);
+        hasher.Add(state.DmcDma);
+        hasher.Add(state.OamDmaAddress);
+        hasher.Add(state.DmcDmaAddress);
+        hasher.Add(state.AudioIrq);
+        hasher.Add(state.CartIrq);
+
+        std::array<EventQueue::Event, EventQueue::MAX_EVENTS> events;
+        auto eventCount = state.SyncQueue.CopySortedEvents(events.data());
+        hasher.Add(eventCount);
+        for (auto i = 0u; i < eventCount; i++)
+        {
+            hasher.Add(events[i].Cycles);
+            hasher.Add(events[i].Value);
+        }
+    }
+
+    void Add(StateHasher& hasher, const PpuState& state)
+    {
+        auto& core = state.Core;
+        hasher.Add(core.FrameCount);
+        hasher.Add(core.ColorPhase);
+        hasher.Add(core.AddressLatch);
+        hasher.Add(core.PpuData);
+        hasher.Add(core.EnableVBlankInterrupt);
+        hasher.Add(core.AddressIncrement);
+        hasher.Add(core.EnableBackground);
+        hasher.Add(core.EnableForeground);
+        hasher.Add(core.EnableRendering);
+        hasher.Add(core.SuppressVBlank);
+        hasher.Add(core.InVBlank);
+        hasher.Add(core.InitialAddress);
+        hasher.Add(core.GrayscaleMask);
+        hasher.Add(core.Emphasis);
+        hasher.Add(core.Palette, sizeof(core.Palette));
+        hasher.Add(core.CurrentScanline);
+        hasher.Add(core.ScanlineStartCycle);
+        hasher.Add(core.SyncCycle);
+        hasher.Add(core.CompositeCycle);
+        hasher.Add(core.ChrA12Cycle);
+        hasher.Add(core.UpdateBaseAddress);
+        hasher.Add(core.UpdateMask);
+        hasher.Add(core.Mask);
+
+        auto& background = state.Background;
+        hasher.Add(background.CurrentAddress);
+        hasher.Add(background.FineX);
+        hasher.Add(background.BackgroundPatternBase);
+        hasher.Add(background.LeftCrop);
+        hasher.Add(background.PatternBitShift);
+
+        auto& sprites = state.Sprites;
+        hasher.Add(sprites.largeSprites_);
+        hasher.Add(sprites.spritePatternBase_);
+        hasher.Add(sprites.oamAddress_);
+        hasher.Add(sprites.spriteEvaluationOamAddress_);
+        hasher.Add(sprites.oam_.data(), sprites.oam_.size());
+        hasher.Add(sprites.sprite0Hit_);
+        hasher.Add(sprites.spriteOverflow_);
+        hasher.Add(sprites.leftCrop_);
+    }
+
+    void Add(StateHasher& hasher, const ApuEnvelopeState& state)
+    {
+        hasher.Add(state.Start);
+        hasher.Add(state.Loop);
+        hasher.Add(state.ConstantVolume);
+        hasher.Add(state.Envelope);
+        hasher.Add(state.DecayLevel);
+        hasher.Add(state.DividerCounter);
+    }
+
+    void Add(StateHasher& hasher, const ApuLengthCounterState& state)
+    {
+        hasher.Add(state.Enabled);
+        hasher.Add(state.Halt);
+        hasher.Add(state.Length);
+    }
+
+    void Add(StateHasher& hasher, const ApuPulseState& state)
+    {
+        Add(hasher, state.Envelope);
+        Add(hasher, state.LengthCounter);
+
+        auto& sweep = state.Sweep;
+        hasher.Add(sweep.Period);
+        hasher.Add(sweep.Period2);
+        hasher.Add(sweep.Enabled);
+        hasher.Add(sweep.Divide);
+        hasher.Add(sweep.Negate);
+        hasher.Add(sweep.Shift);
+        hasher.Add(sweep.Reload);
+        hasher.Add(sweep.DivideCounter);
+        hasher.Add(sweep.TargetPeriod);
+
+        hasher.Add(state.Core.timer_);
+        hasher.Add(state.Core.sequence_);
+        hasher.Add(state.Core.dutyLookup_);
+    }
+
+    void Add(StateHasher& hasher, const ApuState& state)
+    {
+        hasher.Add(state.FrameCounter.Phase);
+        hasher.Add(state.FrameCounter.Mode);
+        hasher.Add(state.FrameCounter.EnableInterrupt);
+
+        Add(hasher, state.Pulse1);
+        Add(hasher, state.Pulse2);
+
+        auto& triangle = state.Triangle;
+        Add(hasher, triangle.LengthCounter);
+        hasher.Add(triangle.Core.Period);
+        hasher.Add(triangle.Core.Period2);
+        hasher.Add(triangle.Core.Timer);
+        hasher.Add(triangle.Core.WaveformCycle);
+        hasher.Add(triangle.Core.LinearCounter);
+        hasher.Add(triangle.Core.LinearCounterReload);
+        hasher.Add(triangle.Core.LinearCounterReloadValue);
+        hasher.Add(triangle.Core.Control);
+
+        auto& noise = state.Noise;
+        Add(hasher, noise.Envelope);
+        Add(hasher, noise.LengthCounter);
+        hasher.Add(noise.Core.ModeShift);
+        hasher.Add(noise.Core.Period);
+        hasher.Add(noise.Core.Period2);
+        hasher.Add(noise.Core.Timer);
+        hasher.Add(noise.Core.Shifter);
+
+        auto& dmc = state.Dmc;
+        hasher.Add(dmc.irqEnabled_);
+        hasher.Add(dmc.loop_);
+        hasher.Add(dmc.rate_);
+        hasher.Add(dmc.level_);
+        hasher.Add(dmc.sampleAddress_);
+        hasher.Add(dmc.sampleLength_);
+        hasher.Add(dmc.timer_);
+        hasher.Add(dmc.outBuffer_);
+        hasher.Add(dmc.outBufferHasData_);
+        hasher.Add(dmc.sampleShift_);
+        hasher.Add(dmc.sampleBuffer_);
+        hasher.Add(dmc.sampleBufferHasData_);
+        hasher.Add(dmc.byteRequested_);
+        hasher.Add(dmc.currentAddress_);
+        hasher.Add(dmc.sampleBytesRemaining_);
+
+        hasher.Add(state.Core.CurrentSample);
+        hasher.Add(state.Core.SampleCycle);
+        hasher.Add(state.Core.LastSyncCycle);
+        hasher.Add(state.Core.DmcInterrupt);
+        hasher.Add(state.Core.FrameCounterInterrupt);
+    }
+
+    void Add(StateHasher& hasher, const ControllerState& state)
+    {
+        hasher.Add(state.Buttons);
+        hasher.Add(state.Strobe);
+        hasher.Add(state.Noise);
+        hasher.Add(state.State);
+    }
+
+    void Add(StateHasher& hasher, const CartState& state)
+    {
+        auto& core = state.Core;
+        hasher.Add(core.MirrorMode);
+        hasher.Add(core.MapperShiftCount);
+        hasher.Add(core.MapperShift);
+        hasher.Add(core.BankSelect);
+        hasher.Add(core.CommandNumber);
+        hasher.Add(core.PrgMode);
+        hasher.Add(core.PrgMode2);
+        hasher.Add(core.PrgBank0);
+        hasher.Add(core.PrgBank1);
+        hasher.Add(core.PrgBank2);
+        hasher.Add(core.PrgBank3);
+        hasher.Add(core.PrgBankHighBits);
+        hasher.Add(core.PrgBank0Ram);
+        hasher.Add(core.PrgBank1Ram);
+        hasher.Add(core.PrgBank2Ram);
+        hasher.Add(core.ChrMode);
+        hasher.Add(core.ChrBank0);
+        hasher.Add(core.ChrBank1);
+        hasher.Add(core.ChrBank2);
+        hasher.Add(core.ChrBank3);
+        hasher.Add(core.ChrBank4);
+        hasher.Add(core.ChrBank5);
+        hasher.Add(core.ChrBank6);
+        hasher.Add(core.ChrBank7);
+        hasher.Add(core.SecondaryChrBank0);
+        hasher.Add(core.SecondaryChrBank1);
+        hasher.Add(core.SecondaryChrBank2);
+        hasher.Add(core.SecondaryChrBank3);
+        hasher.Add(core.ChrBankHighBits);
+        hasher.Add(core.ChrFillValue);
+        hasher.Add(core.ChrFillAttributes);
+        hasher.Add(core.NametableMode0);
+        hasher.Add(core.NametableMode1);
+        hasher.Add(core.NametableMode2);
+        hasher.Add(core.NametableMode3);
+        hasher.Add(core.UseSecondaryChr0);
+        hasher.Add(core.UseSecondaryChr1);
+        hasher.Add(core.UseSecondaryChrForData);
+        hasher.Add(core.PrgPlane0);
+        hasher.Add(core.PrgPlane1);
+        hasher.Add(core.PrgRamEnabled);
+        hasher.Add(core.PrgRamBank0);
+        hasher.Add(core.PrgRamBank1);
+        hasher.Add(core.PrgRamProtect0);
+        hasher.Add(core.PrgRamProtect1);
+        hasher.Add(core.ExtendedRamMode);
+        hasher.Add(core.ExtendedAttribute);
+        hasher.Add(core.ExtendedPatternAddress);
+        hasher.Add(core.ChrA12Sensitivity);
+        hasher.Add(core.ChrA12);
+        hasher.Add(core.IrqEnabled);
+        hasher.Add(core.IrqMode);
+        hasher.Add(core.IrqCounter);
+        hasher.Add(core.ChrA12PulseCounter);
+        hasher.Add(core.LastA12Cycle);
+        hasher.Add(core.PrescalerResetCycle);
+        hasher.Add(core.BumpIrqCounter);
+        hasher.Add(core.CpuCounterEnabled);
+        hasher.Add(core.CpuCounterSyncCycle);
+        hasher.Add(core.ReloadCounter);
+        hasher.Add(core.ReloadValue);
+        hasher.Add(core.InFrame);
+        hasher.Add(core.PpuInFrame);
+        hasher.Add(core.InterruptScanline);
+        hasher.Add(core.IrqPending);
+        hasher.Add(core.LargeSprites);
+        hasher.Add(core.RenderingEnabled);
+        hasher.Add(core.MMC5InSync);
+        hasher.Add(core.SplitEnabled);
+        hasher.Add(core.RightSplit);
+        hasher.Add(core.InSprites);
+        hasher.Add(core.CurrentTile);
+        hasher.Add(core.SplitTile);
+        hasher.Add(core.SplitScroll);
+        hasher.Add(core.SplitY);
+        hasher.Add(core.SplitBank);
+        hasher.Add(core.MulitplierArg0);
+        hasher.Add(core.MulitplierArg1);
+        hasher.Add(core.InitializationState);
+
+        // the banks are pointers, so we use the offsets instead.
+        for (auto offset : state.CpuBankOffsets)
+            hasher.Add(offset);
+        for (auto writable : core.CpuBankWritable)
+            hasher.Add(writable);
+        for (auto offset : state.PpuBankOffsets)
+            hasher.Add(offset);
+        for (auto writable : core.PpuBankWritable)
+            hasher.Add(writable);
+
+        hasher.Add(core.PpuBankFillBytes.data(), core.PpuBankFillBytes.size());
+        hasher.Add(core.PPuBankAttributeBytes.data(), core.PPuBankAttributeBytes.size());
+    }
+}
+
+uint64_t HashBytes(const void* data, size_t size, uint64_t seed)
+{
+    auto bytes = static_cast<const uint8_t*>(data);
+    auto end = bytes + size;
+
+    uint64_t lanes[4]{ seed + Prime1 + Prime2, seed + Prime2, seed, seed - Prime1 };
+    for (; end - bytes >= 32; bytes += 32)
+    {
+        for (auto lane = 0; lane < 4; lane++)
+            lanes[lane] = Round(lanes[lane], Read64(bytes + lane * 8));
+    }
+
+    auto hash = std::rotl(lanes[0], 1) + std::rotl(lanes[1], 7) + std::rotl(lanes[2], 12) + std::rotl(lanes[3], 18);
+    hash += size;
+
+    for (; end - bytes >= 8; bytes += 8)
+        hash = std::rotl(hash ^ Round(0, Read64(bytes)), 27) * Prime1 + Prime3;
+
+    for (; bytes < end; bytes++)
+        hash = std::rotl(hash ^ (*bytes * Prime3), 11) * Prime1;
+
+    return Avalanche(hash);
+}
+
+void StateHasher::Add(const uint8_t* data, size_t size)
+{
+    Flush();
+    hash_ = HashBytes(data, size, hash_);
+}
+
+uint64_t StateHasher::Hash()
+{
+    Flush();
+    return hash_;
+}
+
+void StateHasher::Flush()
+{
+    if (!size_)
+        return;
+
+    hash_ = HashBytes(buffer_.data(), size_, hash_);
+    size_ = 0;
+}
+
+uint64_t StateHash::Hash(const SystemState& state)
+{
+    StateHasher hasher;
+
+    Add(hasher, state.BusState.Core);
+    hasher.Add(HashPages(state.BusState.CpuRam, cpuRam_));
+    Add(hasher, state.CpuState);
+    Add(hasher, state.PpuState);
+    Add(hasher, state.ApuState);
+    Add(hasher, state.Controller1State);
+    Add(hasher, state.Controller2State);
+
+    Add(hasher, state.CartState);
+    hasher.Add(HashPages(state.CartState.PrgRamBank1, prgRamBank1_));
+    hasher.Add(HashPages(state.CartState.PrgRamBank2, prgRamBank2_));
+    hasher.Add(HashPages(state.CartState.ChrRam, chrRam_));
+    hasher.Add(HashPages(state.CartState.ExtendedRam, extendedRam_));
+
+    return hasher.Hash();
+}
+
+template <uint32_t TSize>
+uint64_t StateHash::HashPages(const PageState<TSize>& pages, PageHashes& hashes)
+{
+    auto pageCount = pages.Versions.size();
+    if (hashes.Versions.size() != pageCount)
+    {
+        // no version is ever this, so every page is hashed the first time.
+        hashes.Versions.assign(pageCount, UINT64_MAX);
+        hashes.Hashes.assign(pageCount, 0);
+    }
+
+    for (auto page = 0u; page < pageCount; page++)
+    {
+        if (hashes.Versions[page] == pages.Versions[page])
+            continue;
+
+        auto offset = page << DIRTY_PAGE_SHIFT;
+        auto size = std::min(DIRTY_PAGE_SIZE, TSize - offset);
+        hashes.Hashes[page] = HashBytes(&pages.Data[offset], size, page);
+        hashes.Versions[page] = pages.Versions[page];
+    }
+
+    return HashBytes(hashes.Hashes.data(), pageCount * sizeof(uint64_t));
+}
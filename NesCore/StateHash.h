@@ -0,0 +1,77 @@
+#pragma once
+
+#include "DirtyPages.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+struct SystemState;
+
+// A fast 64-bit hash for fingerprinting states.  The input is consumed in four independent lanes, so the multiplies
+// overlap (or vectorize, where the instruction set has a 64-bit multiply).  This is not a cryptographic hash.
+uint64_t HashBytes(const void* data, size_t size, uint64_t seed = 0);
+
+// Hashes the fields of a state one at a time, rather than hashing the structs whole, so that the padding between the
+// fields can't change the result.
+class StateHasher
+{
+public:
+    template <typename T>
+    void Add(T value);
+
+    void Add(const uint8_t* data, size_t size);
+
+    uint64_t Hash();
+
+private:
+    void Flush();
+
+    std::array<uint8_t, 256> buffer_{};
+    size_t size_{};
+    uint64_t hash_{};
+};
+
+// Hashes captured states, remembering the hash of each page of RAM so that only the pages whose version has changed
+// since the last state are hashed again.  As capturing a state only copies the pages which have been written, this
+// makes hashing the state of a running system every frame cheap.  The states must come from CaptureState, as the
+// versions of a deserialized state don't identify the contents of its pages.
+class StateHash
+{
+public:
+    // the hash covers everything the emulation depends on, including the pending events, but not the outputs - the
+    // display palette and the audio buffer.  This keeps the page hashes from the last call, so an instance can only be
+    // used from one thread at a time.
+    uint64_t Hash(const SystemState& state);
+
+private:
+    struct PageHashes
+    {
+        std::vector<uint64_t> Versions;
+        std::vector<uint64_t> Hashes;
+    };
+
+    template <uint32_t TSize>
+    uint64_t HashPages(const PageState<TSize>& pages, PageHashes& hashes);
+
+    PageHashes cpuRam_;
+    PageHashes prgRamBank1_;
+    PageHashes prgRamBank2_;
+    PageHashes chrRam_;
+    PageHashes extendedRam_;
+};
+
+template <typename T>
+void StateHasher::Add(T value)
+{
+    static_assert(std::is_scalar_v<T>);
+
+    if (size_ + sizeof(value) > buffer_.size())
+        Flush();
+
+    std::memcpy(&buffer_[size_], &value, sizeof(value));
+    size_ += sizeof(value);
+}
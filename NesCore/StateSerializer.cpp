@@ -0,0 +1,146 @@
+#include "StateSerializer.h"
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace
+{
+    const uint32_t Magic{ 0x53435241 }; // "ARCS"
+
+    struct StateHeader
+    {
+        uint32_t Magic;
+        uint32_t LayoutVersion;
+        // the combined size of the state structs, which catches most layout changes even if the version isn't bumped.
+        uint32_t LayoutSize;
+        uint32_t SamplesPerFrame;
+    };
+
+    // the parts of the state, in the order they are stored.  The APU's back buffer is stored separately at the end, as
+    // its size depends on the sample rate.
+    template <typename TState, typename TAction>
+    void ForEachPart(TState& state, TAction&& action)
+    {
+        action(state.BusState);
+        action(state.CpuState);
+        action(state.PpuState);
+        action(state.ApuState.FrameCounter);
+        action(state.ApuState.Pulse1);
+        action(state.ApuState.Pulse2);
+        action(state.ApuState.Triangle);
+        action(state.ApuState.Noise);
+        action(state.ApuState.Dmc);
+        action(state.ApuState.Core);
+        action(state.Controller1State);
+        action(state.Controller2State);
+        action(state.CartState);
+    }
+
+    uint32_t LayoutSize()
+    {
+        static const auto layoutSize = []
+        {
+            auto state = std::make_unique<SystemState>();
+            auto size = 0u;
+            ForEachPart(*state, [&](const auto& part) { size += static_cast<uint32_t>(sizeof(part)); });
+            return size;
+        }();
+
+        return layoutSize;
+    }
+
+    template <uint32_t TSize>
+    void ClearVersions(PageState<TSize>& pages)
+    {
+        // the versions are only meaningful within the process that captured them.
+        pages.Versions.fill(0);
+    }
+
+    template <uint32_t TSize>
+    void ClearSerializedVersions(uint8_t* pages)
+    {
+        std::memset(pages + offsetof(PageState<TSize>, Versions), 0, sizeof(PageState<TSize>::Versions));
+    }
+
+    // the page versions are only meaningful within the process that captured them, so they are written as zeros.  This
+    // way the same state always serializes to the same bytes.
+    template <typename TPart>
+    void ClearProcessFields(const TPart& part, uint8_t* data)
+    {
+    }
+
+    void ClearProcessFields(const BusState& part, uint8_t* data)
+    {
+        ClearSerializedVersions<2048>(data + offsetof(BusState, CpuRam));
+    }
+
+    void ClearProcessFields(const CartState& part, uint8_t* data)
+    {
+        ClearSerializedVersions<0x8000>(data + offsetof(CartState, PrgRamBank1));
+        ClearSerializedVersions<0x8000>(data + offsetof(CartState, PrgRamBank2));
+        ClearSerializedVersions<0x4000>(data + offsetof(CartState, ChrRam));
+        ClearSerializedVersions<0x400>(data + offsetof(CartState, ExtendedRam));
+    }
+}
+
+size_t SerializedStateSize(uint32_t samplesPerFrame)
+{
+    return sizeof(StateHeader) + LayoutSize() + samplesPerFrame * sizeof(int16_t);
+}
+
+void SerializeState(const SystemState& state, uint32_t samplesPerFrame, uint8_t* data)
+{
+    StateHeader header{ Magic, STATE_LAYOUT_VERSION, LayoutSize(), samplesPerFrame };
+    std::memcpy(data, &header, sizeof(header));
+    data += sizeof(header);
+
+    ForEachPart(state, [&](const auto& part)
+        {
+            // the state structs are laid out without any padding (or with explicit padding fields), so that every byte
+            // we write is defined and the layout is the same on 32-bit and 64-bit builds.
+            static_assert(std::has_unique_object_representations_v<std::remove_cvref_t<decltype(part)>>);
+            std::memcpy(data, &part, sizeof(part));
+            ClearProcessFields(part, data);
+            data += sizeof(part);
+        });
+
+    std::memcpy(data, state.ApuState.BackBuffer.get(), samplesPerFrame * sizeof(int16_t));
+}
+
+bool TryDeserializeState(const uint8_t* data, size_t size, uint32_t samplesPerFrame, SystemState* state)
+{
+    if (size != SerializedStateSize(samplesPerFrame))
+        return false;
+
+    StateHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    data += sizeof(header);
+
+    if (header.Magic != Magic ||
+        header.LayoutVersion != STATE_LAYOUT_VERSION ||
+        header.LayoutSize != LayoutSize() ||
+        header.SamplesPerFrame != samplesPerFrame)
+    {
+        return false;
+    }
+
+    ForEachPart(*state, [&](auto& part)
+        {
+            std::memcpy(&part, data, sizeof(part));
+            data += sizeof(part);
+        });
+
+    if (!state->ApuState.BackBuffer)
+        state->ApuState.BackBuffer.reset(new int16_t[samplesPerFrame]);
+    std::memcpy(state->ApuState.BackBuffer.get(), data, samplesPerFrame * sizeof(int16_t));
+
+    ClearVersions(state->BusState.CpuRam);
+    ClearVersions(state->CartState.PrgRamBank1);
+    ClearVersions(state->CartState.PrgRamBank2);
+    ClearVersions(state->CartState.ChrRam);
+    ClearVersions(state->CartState.ExtendedRam);
+
+    return true;
+}
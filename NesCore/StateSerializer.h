@@ -0,0 +1,16 @@
+#pragma once
+
+#include "SystemState.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// the version of the serialized state layout.  This must be increased whenever any of the state structs change.
+const uint32_t STATE_LAYOUT_VERSION{ 3 };
+
+// Converts a SystemState to and from a flat block of bytes, so that it can be stored outside of the process.  The
+// block starts with a header describing the layout, and blocks from a build with a different layout are rejected.  The
+// size only depends on the sample rate, and the state is written straight into the caller's buffer.
+size_t SerializedStateSize(uint32_t samplesPerFrame);
+void SerializeState(const SystemState& state, uint32_t samplesPerFrame, uint8_t* data);
+bool TryDeserializeState(const uint8_t* data, size_t size, uint32_t samplesPerFrame, SystemState* state);
@@ -0,0 +1,116 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(uint32_t threadCount)
+{
+    if (threadCount == 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+    for (auto i = 1u; i < threadCount; i++)
+    {
+        threads_.emplace_back(&ThreadPool::WorkerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard lock{ mutex_ };
+        stopping_ = true;
+    }
+
+    workAvailable_.notify_all();
+
+    for (auto& thread : threads_)
+    {
+        thread.join();
+    }
+}
+
+uint32_t ThreadPool::ThreadCount() const
+{
+    return static_cast<uint32_t>(threads_.size()) + 1;
+}
+
+void ThreadPool::ParallelFor(uint32_t count, const std::function<void(uint32_t)>& task)
+{
+    if (count == 0)
+        return;
+
+    if (threads_.empty() || count == 1)
+    {
+        for (auto i = 0u; i < count; i++)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard lock{ mutex_ };
+        task_ = &task;
+        taskCount_ = count;
+        remainingTasks_ = count;
+        nextTask_ = 0;
+        generation_++;
+    }
+
+    workAvailable_.notify_all();
+
+    RunTasks(task, count);
+
+    // we have to wait for the workers to let go of the task as well as for the tasks to complete, otherwise a slow
+    // worker could pick up work from the next batch.
+    std::unique_lock lock{ mutex_ };
+    workComplete_.wait(lock, [this] { return remainingTasks_ == 0 && activeWorkers_ == 0; });
+
+    task_ = nullptr;
+    taskCount_ = 0;
+}
+
+void ThreadPool::WorkerLoop()
+{
+    uint64_t generation = 0;
+
+    std::unique_lock lock{ mutex_ };
+    while (true)
+    {
+        workAvailable_.wait(lock, [&] { return stopping_ || generation != generation_; });
+        if (stopping_)
+            return;
+
+        generation = generation_;
+        if (!task_)
+            continue;
+
+        auto& task = *task_;
+        auto count = taskCount_;
+        activeWorkers_++;
+
+        lock.unlock();
+        RunTasks(task, count);
+        lock.lock();
+
+        activeWorkers_--;
+        if (activeWorkers_ == 0)
+            workComplete_.notify_one();
+    }
+}
+
+void ThreadPool::RunTasks(const std::function<void(uint32_t)>& task, uint32_t count)
+{
+    while (true)
+    {
+        auto index = nextTask_++;
+        if (index >= count)
+            return;
+
+        task(index);
+
+        std::lock_guard lock{ mutex_ };
+        remainingTasks_--;
+        if (remainingTasks_ == 0)
+            workComplete_.notify_one();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A small pool of worker threads for splitting up work that would otherwise run on the emulation thread.
+class ThreadPool
+{
+public:
+    // a thread count of zero picks one thread per core.  The calling thread also does work, so one fewer worker
+    // thread is created.
+    ThreadPool(uint32_t threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    uint32_t ThreadCount() const;
+
+    // runs task(index) for each index in [0, count) across the pool, returning when they have all completed.
+    void ParallelFor(uint32_t count, const std::function<void(uint32_t)>& task);
+
+private:
+    void WorkerLoop();
+    void RunTasks(const std::function<void(uint32_t)>& task, uint32_t count);
+
+    std::vector<std::thread> threads_;
+
+    std::mutex mutex_;
+    std::condition_variable workAvailable_;
+    std::condition_variable workComplete_;
+
+    const std::function<void(uint32_t)>* task_{};
+    uint32_t taskCount_{};
+    uint32_t remainingTasks_{};
+    uint32_t activeWorkers_{};
+    uint64_t generation_{};
+    bool stopping_{};
+
+    std::atomic<uint32_t> nextTask_{};
+};
\ No newline at end of file
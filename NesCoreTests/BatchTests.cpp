@@ -0,0 +1,122 @@
+#include "Tests.h"
+#include "TestRom.h"
+
+#include "../NesCore/NesBatch.h"
+#include "../NesCore/RomFile.h"
+
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    const uint32_t BatchSize{ 6 };
+
+    uint8_t Player1Buttons(uint32_t frame, uint32_t index)
+    {
+        // every system starts with the same buttons, then they split into three groups, and later into six.  After the
+        // batch is power cycled they are all given the same buttons again.
+        if (frame < 20 || frame >= 100)
+            return 0x08;
+        if (frame < 60)
+            return static_cast<uint8_t>((index % 3) << 4);
+        return static_cast<uint8_t>(index % 2 ? frame : 0);
+    }
+
+    bool SameSystem(NesBatch& plain, NesBatch& lockstep, uint32_t index)
+    {
+        // in lockstep mode this takes the system out of its group, which has to bring it up to date with the group.
+        return plain.System(index).CpuRam() == lockstep.System(index).CpuRam();
+    }
+
+    bool SameOutputs(const NesBatch& plain, const NesBatch& lockstep)
+    {
+        auto frames = plain.FrameSize() * plain.Count();
+        auto ram = static_cast<size_t>(NesBatch::RAM_SIZE) * plain.Count();
+        auto samples = static_cast<size_t>(plain.SamplesPerFrame()) * plain.Count();
+
+        return
+            std::memcmp(plain.Frames(), lockstep.Frames(), frames) == 0 &&
+            std::memcmp(plain.Ram(), lockstep.Ram(), ram) == 0 &&
+            std::memcmp(plain.Audio(), lockstep.Audio(), samples * sizeof(int16_t)) == 0;
+    }
+
+    void LockstepMatchesPlain()
+    {
+        auto data = CreateTestRom();
+        auto rom = TryLoadINesFile(data.data(), data.size());
+        CHECK(rom != nullptr);
+        if (!rom)
+            return;
+
+        NesBatchOptions options;
+        options.ThreadCount = 2;
+        auto plain = TryCreateBatch(*rom, BatchSize, options);
+
+        options.Lockstep = true;
+        auto lockstep = TryCreateBatch(*rom, BatchSize, options);
+
+        CHECK(plain && lockstep);
+        if (!plain || !lockstep)
+            return;
+
+        auto mismatches = 0u;
+        std::vector<uint8_t> player1(BatchSize);
+        std::vector<uint8_t> player2(BatchSize);
+
+        for (auto frame = 0u; frame < 120; frame++)
+        {
+            // looking at a follower or power cycling it takes it out of its group, and taking a leader out hands its
+            // group to the next system.  Power cycling the whole batch brings every system back into a single group.
+            if (frame == 30)
+            {
+                if (!SameSystem(*plain, *lockstep, 5))
+                    mismatches++;
+            }
+            else if (frame == 40)
+            {
+                plain->PowerCycle(4);
+                lockstep->PowerCycle(4);
+            }
+            else if (frame == 50)
+            {
+                plain->PowerCycle(0);
+                lockstep->PowerCycle(0);
+            }
+            else if (frame == 100)
+            {
+                plain->PowerCycle();
+                lockstep->PowerCycle();
+            }
+
+            for (auto index = 0u; index < BatchSize; index++)
+            {
+                player1[index] = Player1Buttons(frame, index);
+                player2[index] = static_cast<uint8_t>(frame >= 80 && frame < 100 ? index : 0);
+            }
+
+            auto skipFrames = frame % 7 == 0 ? 2u : 0u;
+            plain->Step(player1.data(), player2.data(), skipFrames);
+            lockstep->Step(player1.data(), player2.data(), skipFrames);
+
+            if (!SameOutputs(*plain, *lockstep))
+                mismatches++;
+        }
+
+        CHECK(mismatches == 0);
+
+        // the systems themselves must match too, not just the outputs which were copied from their leaders.
+        auto differentSystems = 0u;
+        for (auto index = 0u; index < BatchSize; index++)
+        {
+            if (!SameSystem(*plain, *lockstep, index))
+                differentSystems++;
+        }
+
+        CHECK(differentSystems == 0);
+    }
+}
+
+void RunBatchTests()
+{
+    LockstepMatchesPlain();
+}
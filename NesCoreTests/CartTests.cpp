@@ -0,0 +1,103 @@
+#include "Tests.h"
+
+#include "../NesCore/NesSystem.h"
+#include "../NesCore/RomFile.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+    const size_t HeaderSize{ 16 };
+    const size_t PrgSize{ 0x4000 };
+    const size_t ChrSize{ 0x2000 };
+
+    // at $e000, in the FME-7's fixed bank.  This maps the first PRG-ROM bank at $6000, then runs read-modify-write
+    // instructions on it, which write twice, and copies back what is there.
+    const uint8_t Fme7Code[]
+    {
+        0x78,               // SEI
+        0xd8,               // CLD
+        0xa2, 0xff,         // LDX #$ff
+        0x9a,               // TXS
+        0xa9, 0x08,         // LDA #8
+        0x8d, 0x00, 0x80,   // STA $8000    ; command 8, the $6000 bank
+        0xa9, 0x00,         // LDA #0
+        0x8d, 0x00, 0xa0,   // STA $a000    ; ROM bank 0
+        0xee, 0x10, 0x60,   // INC $6010
+        0x0e, 0x11, 0x60,   // ASL $6011
+        0xad, 0x10, 0x60,   // LDA $6010
+        0x85, 0x10,         // STA $10
+        0xad, 0x11, 0x60,   // LDA $6011
+        0x85, 0x11,         // STA $11
+        0xa9, 0x01,         // LDA #1
+        0x85, 0x12,         // STA $12
+        0x4c, 0x23, 0xe0    // JMP $e023
+    };
+
+    std::vector<uint8_t> CreateFme7Rom()
+    {
+        std::vector<uint8_t> rom(HeaderSize + PrgSize + ChrSize);
+
+        // one 16K PRG bank and one 8K CHR bank.  The header can't name the FME-7, so that is filled in after loading,
+        // as the game database would.
+        const uint8_t header[]{ 'N', 'E', 'S', 0x1a, 1, 1 };
+        std::copy(std::begin(header), std::end(header), rom.begin());
+
+        auto prg = rom.begin() + HeaderSize;
+        // the FME-7 has bus conflicts, and the first bank is also mapped where the registers are written.
+        prg[0] = 0xff;
+        prg[0x10] = 0x42;
+        prg[0x11] = 0x21;
+        std::copy(std::begin(Fme7Code), std::end(Fme7Code), prg + 0x2000);
+
+        const uint8_t vectors[]{ 0x23, 0xe0, 0x00, 0xe0, 0x23, 0xe0 };
+        std::copy(std::begin(vectors), std::end(vectors), prg + PrgSize - sizeof(vectors));
+
+        return rom;
+    }
+
+    // the ROM is mapped from a file, as the frontends do, so writing to it faults rather than going unnoticed.
+    void WriteToRomBankAt6000()
+    {
+        auto path = std::filesystem::temp_directory_path() / "NesCoreTests.fme7.nes";
+        {
+            auto data = CreateFme7Rom();
+            std::ofstream stream(path, std::ios::binary);
+            stream.write(reinterpret_cast<const char*>(data.data()), data.size());
+        }
+
+        auto rom = TryMapINesFile(path);
+        CHECK(rom != nullptr);
+        if (!rom)
+            return;
+
+        rom->Descriptor.Mapper = 69;
+        auto cart = TryCreateCart(rom->Descriptor, rom->PrgData, rom->ChrData, rom->Storage);
+        CHECK(cart != nullptr);
+        if (!cart)
+            return;
+
+        cart->Initialize();
+
+        NesSystem system{ 44100 };
+        system.InsertCart(std::move(cart));
+        system.PowerCycle();
+        system.RunFrame();
+
+        auto& ram = system.CpuRam();
+        CHECK(ram[0x12] == 1);
+        CHECK(ram[0x10] == 0x42);
+        CHECK(ram[0x11] == 0x21);
+
+        // the mapping is still open, so this may fail on Windows, which only leaves a file in the temp directory.
+        std::error_code error;
+        std::filesystem::remove(path, error);
+    }
+}
+
+void RunCartTests()
+{
+    WriteToRomBankAt6000();
+}
@@ -0,0 +1,99 @@
+#include "Tests.h"
+
+#include "../NesCore/Crc32.h"
+
+#include <vector>
+
+namespace
+{
+    // the CRC one bit at a time, straight from the definition, for the faster methods to be checked against.
+    uint32_t ReferenceCrc32(const uint8_t* data, size_t length)
+    {
+        auto hash = 0xffffffffu;
+        for (; length > 0; length--)
+        {
+            hash ^= *data++;
+            for (auto bit = 0; bit < 8; bit++)
+                hash = (hash >> 1) ^ ((hash & 1) ? 0xedb88320u : 0);
+        }
+
+        return hash ^ 0xffffffff;
+    }
+
+    std::vector<uint8_t> TestData(size_t length)
+    {
+        std::vector<uint8_t> data(length);
+
+        auto seed = 0x12345678u;
+        for (auto& value : data)
+        {
+            seed = seed * 1664525 + 1013904223;
+            value = static_cast<uint8_t>(seed >> 24);
+        }
+
+        return data;
+    }
+
+    uint32_t Hash(Crc32Method method, const uint8_t* data, size_t length)
+    {
+        Crc32 crc{ method };
+        crc.AddData(data, length);
+        return crc.GetHash();
+    }
+
+    void CheckMethod(Crc32Method method)
+    {
+        const uint8_t check[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+        CHECK(Hash(method, check, sizeof(check)) == 0xcbf43926);
+
+        // every length either side of the block sizes, from every alignment, so each tail and fold is exercised.
+        auto data = TestData(4096 + 16);
+        auto mismatches = 0;
+        for (auto offset = 0u; offset < 16; offset++)
+        {
+            for (auto length = 0u; length <= 300; length++)
+            {
+                if (Hash(method, data.data() + offset, length) != ReferenceCrc32(data.data() + offset, length))
+                    mismatches++;
+            }
+
+            if (Hash(method, data.data() + offset, 4096) != ReferenceCrc32(data.data() + offset, 4096))
+                mismatches++;
+        }
+
+        CHECK(mismatches == 0);
+
+        // the hash carries on the same however the data is split between calls.
+        auto expected = ReferenceCrc32(data.data(), 4096);
+        mismatches = 0;
+        for (auto split : { 1u, 7u, 8u, 15u, 16u, 63u, 64u, 65u, 100u, 1000u, 4095u })
+        {
+            Crc32 crc{ method };
+            crc.AddData(data.data(), split);
+            crc.AddData(data.data() + split, 4096 - split);
+            if (crc.GetHash() != expected)
+                mismatches++;
+        }
+
+        CHECK(mismatches == 0);
+    }
+}
+
+void RunCrc32Tests()
+{
+    CHECK(Crc32::IsSupported(Crc32Method::Sliced));
+
+    // the hardware methods are only checked on processors that have them, so it's worth running the tests on both x64
+    // and ARM64.
+    for (auto method : { Crc32Method::Sliced, Crc32Method::Clmul, Crc32Method::Crc32Instructions })
+    {
+        if (Crc32::IsSupported(method))
+            CheckMethod(method);
+    }
+
+    // the default method is whichever of those is fastest here.
+    auto data = TestData(1000);
+    Crc32 crc;
+    crc.AddData(data.data(), data.size());
+    CHECK(crc.GetHash() == ReferenceCrc32(data.data(), data.size()));
+}
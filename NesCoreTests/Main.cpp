@@ -0,0 +1,32 @@
+#include <cstdio>
+
+#include "Tests.h"
+
+namespace
+{
+    int checks;
+    int failures;
+}
+
+void Check(bool condition, const char* expression, const char* file, int line)
+{
+    checks++;
+    if (condition)
+        return;
+
+    failures++;
+    std::printf("%s(%d): check failed: %s\n", file, line, expression);
+}
+
+int main()
+{
+    RunBatchTests();
+    RunCartTests();
+    RunCrc32Tests();
+    RunMovieTests();
+    RunNetplayTests();
+    RunStateTests();
+
+    std::printf("%d of %d checks failed\n", failures, checks);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,186 @@
+#include "Tests.h"
+#include "TestRom.h"
+
+#include "../NesCore/Movie.h"
+#include "../NesCore/MovieCheckpoints.h"
+#include "../NesCore/NesSystem.h"
+#include "../NesCore/StateSerializer.h"
+
+#include <filesystem>
+#include <vector>
+
+namespace
+{
+    const uint32_t MovieFrames{ 120 };
+
+    void RunFrames(NesSystem& system, uint32_t count)
+    {
+        for (auto frame = 0u; frame < count; frame++)
+        {
+            system.Controller1().SetButtonState(static_cast<uint8_t>(frame * 0x35));
+            system.RunFrame();
+        }
+    }
+
+    Movie RecordMovie(NesSystem& system, bool fromPowerOn)
+    {
+        MovieRecorder recorder{ system, fromPowerOn };
+        for (auto frame = 0u; frame < MovieFrames; frame++)
+            recorder.RunFrame(static_cast<uint8_t>(frame * 0x1d), static_cast<uint8_t>(frame / 8));
+
+        return recorder.Recording();
+    }
+
+    void ReplayFromPowerOn()
+    {
+        auto system = CreateTestSystem();
+        RunFrames(*system, 20);
+
+        auto movie = RecordMovie(*system, true);
+        CHECK(movie.StartState.empty());
+        CHECK(movie.Frames.size() == MovieFrames);
+
+        // the movie survives a trip through a file.
+        auto path = std::filesystem::temp_directory_path() / "NesCoreTests.movie";
+        CHECK(SaveMovie(movie, path));
+        auto loaded = TryLoadMovie(path);
+        std::error_code error;
+        std::filesystem::remove(path, error);
+
+        CHECK(loaded != nullptr);
+        if (!loaded)
+            return;
+
+        // starting the movie power cycles the system whatever it was doing, and replaying with or without drawing
+        // reaches the same state as the recording.
+        for (auto drawFrames : { false, true })
+        {
+            auto replay = CreateTestSystem();
+            RunFrames(*replay, 10);
+
+            CHECK(StartMovie(*loaded, *replay) == MovieStartResult::Started);
+            CHECK(ReplayMovie(*loaded, *replay, drawFrames) == MovieFrames);
+            CHECK(replay->StateHash() == system->StateHash());
+        }
+    }
+
+    void ReplayFromState()
+    {
+        auto system = CreateTestSystem();
+        RunFrames(*system, 30);
+
+        auto movie = RecordMovie(*system, false);
+        CHECK(!movie.StartState.empty());
+
+        auto replay = CreateTestSystem();
+        CHECK(StartMovie(movie, *replay) == MovieStartResult::Started);
+        CHECK(ReplayMovie(movie, *replay) == MovieFrames);
+        CHECK(replay->StateHash() == system->StateHash());
+
+        // the test ROM stores the buttons in RAM every frame, so changing them is caught on the same frame.
+        movie.Frames[50].Player2 ^= 0x80;
+        CHECK(StartMovie(movie, *replay) == MovieStartResult::Started);
+        CHECK(ReplayMovie(movie, *replay) == 50);
+    }
+
+    void RejectMismatchedMovies()
+    {
+        auto system = CreateTestSystem();
+        RunFrames(*system, 10);
+        auto movie = RecordMovie(*system, false);
+
+        auto replay = CreateTestSystem();
+        auto hash = replay->StateHash();
+
+        auto romCrc32 = movie.RomCrc32;
+        movie.RomCrc32 ^= 1;
+        CHECK(StartMovie(movie, *replay) == MovieStartResult::WrongRom);
+        movie.RomCrc32 = romCrc32;
+
+        movie.LayoutVersion++;
+        CHECK(StartMovie(movie, *replay) == MovieStartResult::WrongLayout);
+        movie.LayoutVersion--;
+
+        movie.CoreVersion++;
+        CHECK(StartMovie(movie, *replay) == MovieStartResult::WrongCoreVersion);
+        movie.CoreVersion--;
+
+        movie.SamplesPerFrame++;
+        CHECK(StartMovie(movie, *replay) == MovieStartResult::WrongSampleRate);
+        movie.SamplesPerFrame--;
+
+        movie.StartState.pop_back();
+        CHECK(StartMovie(movie, *replay) == MovieStartResult::BadStartState);
+
+        // none of these touch the system.
+        CHECK(replay->StateHash() == hash);
+    }
+
+    // records a longer movie with checkpoints, keeping the state hash at the start of every frame.
+    Movie RecordWithCheckpoints(uint32_t frames, MovieCheckpoints* checkpoints, std::vector<uint64_t>* hashes)
+    {
+        auto system = CreateTestSystem();
+        MovieRecorder recorder{ *system, true, checkpoints };
+
+        hashes->push_back(system->StateHash());
+        for (auto frame = 0u; frame < frames; frame++)
+        {
+            recorder.RunFrame(static_cast<uint8_t>(frame * 0x1d), static_cast<uint8_t>(frame / 8));
+            hashes->push_back(system->StateHash());
+        }
+
+        return recorder.Recording();
+    }
+
+    void SeekWithCheckpoints()
+    {
+        const uint32_t frames{ 600 };
+        const uint32_t interval{ 20 };
+
+        // see how much memory every checkpoint takes, then record again with room for the uncompressed base and half of
+        // the compressed checkpoints, so they are thinned at least once.
+        MovieCheckpoints unlimited{ interval };
+        std::vector<uint64_t> hashes;
+        RecordWithCheckpoints(frames, &unlimited, &hashes);
+        CHECK(unlimited.Count() == frames / interval + 1);
+
+        auto baseSize = SerializedStateSize(CreateTestSystem()->Apu().SamplesPerFrame());
+        auto budget = baseSize + (unlimited.MemoryUsed() - baseSize) / 2;
+
+        MovieCheckpoints checkpoints{ interval, budget };
+        hashes.clear();
+        auto movie = RecordWithCheckpoints(frames, &checkpoints, &hashes);
+        CHECK(checkpoints.Interval() > interval);
+        CHECK(checkpoints.Count() > 1 && checkpoints.Count() < unlimited.Count());
+        CHECK(checkpoints.MemoryUsed() <= budget);
+
+        // seeking lands on the same state as replaying the whole movie, whether the frame has a checkpoint, had one
+        // which was thinned, or is between them.
+        auto system = CreateTestSystem();
+        auto mismatches = 0;
+        for (auto frame : { 0u, 1u, interval, interval + 1, 3 * interval, 250u, 599u, 600u, 40u, 0u })
+        {
+            if (!checkpoints.TrySeek(movie, frame, *system) || system->StateHash() != hashes[frame])
+                mismatches++;
+        }
+
+        CHECK(mismatches == 0);
+        CHECK(!checkpoints.TrySeek(movie, frames + 1, *system));
+
+        // a system at another sample rate can't use the checkpoints, or add to them.
+        auto otherRate = CreateTestSystem(48000);
+        CHECK(!checkpoints.TrySeek(movie, 250, *otherRate));
+
+        auto count = checkpoints.Count();
+        checkpoints.Update(frames + checkpoints.Interval(), *otherRate);
+        CHECK(checkpoints.Count() == count);
+    }
+}
+
+void RunMovieTests()
+{
+    ReplayFromPowerOn();
+    ReplayFromState();
+    RejectMismatchedMovies();
+    SeekWithCheckpoints();
+}
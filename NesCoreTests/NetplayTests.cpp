@@ -0,0 +1,158 @@
+#include "Tests.h"
+#include "TestRom.h"
+
+#include "../NesCore/NesSystem.h"
+#include "../NesCore/NetplaySession.h"
+#include "../NesCore/NetplayTransport.h"
+
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
+namespace
+{
+    const uint32_t SessionFrames{ 240 };
+    const uint32_t MaxRollback{ 8 };
+
+    // the buttons stop changing for the last few frames, so that whatever each end predicts for the frames it hasn't
+    // heard about yet is right, and both ends finish in the state they'd have reached with all the inputs.
+    uint8_t TestButtons(uint32_t player, uint32_t frame)
+    {
+        frame = std::min(frame, SessionFrames - 2 * MaxRollback) / 4;
+        return static_cast<uint8_t>((frame * 0x9d + player * 0x35) ^ (frame >> 2));
+    }
+
+    void RunSessions(std::chrono::milliseconds latency)
+    {
+        auto [firstTransport, secondTransport] = CreateLoopbackTransports(latency);
+
+        auto firstSystem = CreateTestSystem();
+        auto secondSystem = CreateTestSystem();
+
+        NetplayOptions firstOptions;
+        firstOptions.LocalPlayer = 0;
+        firstOptions.MaxRollback = MaxRollback;
+        NetplaySession first{ *firstSystem, *firstTransport, firstOptions };
+
+        NetplayOptions secondOptions;
+        secondOptions.LocalPlayer = 1;
+        secondOptions.MaxRollback = MaxRollback;
+        NetplaySession second{ *secondSystem, *secondTransport, secondOptions };
+
+        // each end runs as fast as it can, so one gets ahead and has to wait for the other at the rollback limit.
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        while ((first.Frame() < SessionFrames || second.Frame() < SessionFrames)
+            && std::chrono::steady_clock::now() < deadline)
+        {
+            if (first.Frame() < SessionFrames)
+                first.RunFrame(TestButtons(0, first.Frame()));
+
+            if (second.Frame() < SessionFrames)
+                second.RunFrame(TestButtons(1, second.Frame()));
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        CHECK(first.Frame() == SessionFrames);
+        CHECK(second.Frame() == SessionFrames);
+        CHECK(first.IsConnected() && second.IsConnected());
+
+        // a system which was given every input up front.
+        auto reference = CreateTestSystem();
+        for (auto frame = 0u; frame < SessionFrames; frame++)
+        {
+            reference->Controller1().SetButtonState(TestButtons(0, frame));
+            reference->Controller2().SetButtonState(TestButtons(1, frame));
+            reference->RunFrame();
+        }
+
+        CHECK(firstSystem->CpuRam() == reference->CpuRam());
+        CHECK(secondSystem->CpuRam() == reference->CpuRam());
+        CHECK(firstSystem->StateHash() == reference->StateHash());
+        CHECK(secondSystem->StateHash() == reference->StateHash());
+
+        // with any latency, the end that runs first each time round predicts wrongly whenever the other's buttons
+        // change.
+        if (latency.count())
+            CHECK(first.RolledBackFrames() + second.RolledBackFrames() > 0);
+    }
+
+    template <typename TCondition>
+    bool WaitFor(TCondition condition)
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!condition())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+                return false;
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return true;
+    }
+
+    void RunSocketTransports()
+    {
+        auto path = std::filesystem::temp_directory_path() / "NesCoreTests.sock";
+
+        std::unique_ptr<NetplayTransport> listener;
+        std::thread listenThread{ [&] { listener = TryListenUnixSocket(path); } };
+
+        std::unique_ptr<NetplayTransport> connection;
+        WaitFor([&] { return (connection = TryConnectUnixSocket(path)) != nullptr; });
+        listenThread.join();
+
+        CHECK(listener && connection);
+        if (!listener || !connection)
+            return;
+
+        // enough inputs at a time that they're read in several pieces, with messages split between them, but not so
+        // many that sending blocks while nothing is receiving.
+        const uint32_t inputCount{ 1000 };
+        const uint32_t batchSize{ 100 };
+
+        auto received = 0u;
+        auto inOrder = true;
+        for (auto frame = 0u; frame < inputCount; frame += batchSize)
+        {
+            for (auto i = frame; i < frame + batchSize; i++)
+                connection->Send({ i, static_cast<uint8_t>(i * 7) });
+
+            WaitFor([&]
+            {
+                NetplayInput input;
+                while (listener->TryReceive(&input))
+                {
+                    inOrder &= input.Frame == received && input.Buttons == static_cast<uint8_t>(received * 7);
+                    received++;
+                }
+
+                return received == frame + batchSize;
+            });
+        }
+
+        CHECK(received == inputCount);
+        CHECK(inOrder);
+        CHECK(listener->IsConnected());
+
+        // the other end going away is noticed when we next try to receive, and sending after that is harmless.
+        connection.reset();
+        CHECK(WaitFor([&]
+        {
+            NetplayInput input;
+            listener->TryReceive(&input);
+            return !listener->IsConnected();
+        }));
+
+        listener->Send({ inputCount, 0 });
+        CHECK(!listener->IsConnected());
+    }
+}
+
+void RunNetplayTests()
+{
+    RunSessions(std::chrono::milliseconds(0));
+    RunSessions(std::chrono::milliseconds(5));
+    RunSocketTransports();
+}
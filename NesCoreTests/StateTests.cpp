@@ -0,0 +1,169 @@
+#include "Tests.h"
+#include "TestRom.h"
+
+#include "../NesCore/NesSystem.h"
+#include "../NesCore/SnapshotCache.h"
+#include "../NesCore/StateSerializer.h"
+#include "../NesCore/SystemState.h"
+
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    // the buttons depend on the frame, so runs from different frames leave different inputs in RAM.
+    void RunFrames(NesSystem& system, uint32_t firstFrame, uint32_t count)
+    {
+        for (auto frame = firstFrame; frame < firstFrame + count; frame++)
+        {
+            system.Controller1().SetButtonState(static_cast<uint8_t>(frame * 0x1d));
+            system.Controller2().SetButtonState(static_cast<uint8_t>(frame * 0x53));
+            system.RunFrame();
+        }
+    }
+
+    void RoundTripCapturedState()
+    {
+        auto system = CreateTestSystem();
+        RunFrames(*system, 0, 30);
+
+        auto state = std::make_unique<SystemState>();
+        system->CaptureState(state.get());
+        auto capturedHash = system->StateHash();
+
+        RunFrames(*system, 30, 30);
+        auto laterHash = system->StateHash();
+
+        // restoring puts back the pages written since the capture, and the run carries on exactly as before.
+        system->RestoreState(*state);
+        CHECK(system->StateHash() == capturedHash);
+
+        RunFrames(*system, 30, 30);
+        CHECK(system->StateHash() == laterHash);
+
+        // capturing into the same state again only copies the pages which have changed, but it must still restore in
+        // full onto a system which has never seen it.
+        system->CaptureState(state.get());
+
+        auto other = CreateTestSystem();
+        RunFrames(*other, 100, 10);
+        other->RestoreState(*state);
+        CHECK(other->CpuRam() == system->CpuRam());
+        CHECK(other->StateHash() == laterHash);
+
+        RunFrames(*system, 60, 10);
+        RunFrames(*other, 60, 10);
+        CHECK(other->StateHash() == system->StateHash());
+    }
+
+    void RejectBadBankOffsets()
+    {
+        auto system = CreateTestSystem();
+        RunFrames(*system, 0, 10);
+
+        auto state = std::make_unique<SystemState>();
+        system->CaptureState(state.get());
+        auto capturedHash = system->StateHash();
+
+        RunFrames(*system, 10, 10);
+        auto hash = system->StateHash();
+
+        // an offset in a region the cart doesn't have, or past the end of its CHR, must leave the system untouched.
+        auto& cartState = state->CartState;
+        auto cpuOffset = cartState.CpuBankOffsets[7];
+        cartState.CpuBankOffsets[7] = 9u << 24;
+        CHECK(!system->TryRestoreState(*state));
+        cartState.CpuBankOffsets[7] = cpuOffset;
+
+        auto ppuOffset = cartState.PpuBankOffsets[0];
+        cartState.PpuBankOffsets[0] = (2u << 24) | 0x2000;
+        CHECK(!system->TryRestoreState(*state));
+        cartState.PpuBankOffsets[0] = ppuOffset;
+
+        CHECK(system->StateHash() == hash);
+
+        CHECK(system->TryRestoreState(*state));
+        CHECK(system->StateHash() == capturedHash);
+    }
+
+    void RoundTripSnapshotCache()
+    {
+        auto directory = std::filesystem::temp_directory_path() / "NesCoreTests.snapshots";
+        std::error_code error;
+        std::filesystem::remove_all(directory, error);
+
+        SnapshotCache cache{ directory };
+        const uint32_t romCrc32{ 0x12345678 };
+
+        // the first boot runs the frames and saves the result, and the second restores it.
+        auto first = CreateTestSystem();
+        CHECK(!cache.Boot(romCrc32, 20, *first));
+
+        auto second = CreateTestSystem();
+        CHECK(cache.Boot(romCrc32, 20, *second));
+        CHECK(second->StateHash() == first->StateHash());
+
+        // a truncated snapshot is ignored.
+        CHECK(cache.Save(romCrc32, "truncated", *first));
+        for (auto& entry : std::filesystem::directory_iterator(directory))
+        {
+            if (entry.path().filename().string().find("truncated") != std::string::npos)
+                std::filesystem::resize_file(entry.path(), 100);
+        }
+
+        auto third = CreateTestSystem();
+        auto hash = third->StateHash();
+        CHECK(!cache.TryLoad(romCrc32, "truncated", *third));
+        CHECK(third->StateHash() == hash);
+
+        std::filesystem::remove_all(directory, error);
+    }
+
+    void RoundTripSerializedState()
+    {
+        auto system = CreateTestSystem();
+        RunFrames(*system, 0, 30);
+
+        auto samplesPerFrame = system->Apu().SamplesPerFrame();
+        auto size = SerializedStateSize(samplesPerFrame);
+
+        auto state = std::make_unique<SystemState>();
+        system->CaptureState(state.get());
+        auto hash = system->StateHash();
+
+        std::vector<uint8_t> data(size);
+        SerializeState(*state, samplesPerFrame, data.data());
+
+        // the same state always gives the same bytes, whatever was captured into the state before.
+        system->CaptureState(state.get());
+        std::vector<uint8_t> again(size);
+        SerializeState(*state, samplesPerFrame, again.data());
+        CHECK(again == data);
+
+        auto other = CreateTestSystem();
+        auto restored = std::make_unique<SystemState>();
+        CHECK(TryDeserializeState(data.data(), data.size(), samplesPerFrame, restored.get()));
+        CHECK(other->TryRestoreState(*restored));
+        CHECK(other->StateHash() == hash);
+
+        RunFrames(*system, 30, 10);
+        RunFrames(*other, 30, 10);
+        CHECK(other->StateHash() == system->StateHash());
+
+        // blocks which are short, from another sample rate, or not states at all are rejected.
+        CHECK(!TryDeserializeState(data.data(), data.size() - 1, samplesPerFrame, restored.get()));
+        CHECK(!TryDeserializeState(data.data(), data.size(), samplesPerFrame + 1, restored.get()));
+
+        data[0] ^= 0xff;
+        CHECK(!TryDeserializeState(data.data(), data.size(), samplesPerFrame, restored.get()));
+    }
+}
+
+void RunStateTests()
+{
+    RoundTripCapturedState();
+    RejectBadBankOffsets();
+    RoundTripSnapshotCache();
+    RoundTripSerializedState();
+}
@@ -0,0 +1,89 @@
+#include "TestRom.h"
+
+#include "../NesCore/NesSystem.h"
+#include "../NesCore/RomFile.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace
+{
+    const size_t HeaderSize{ 16 };
+    const size_t PrgSize{ 0x4000 };
+    const size_t ChrSize{ 0x2000 };
+
+    // at $c000, mirrored at $8000.
+    const uint8_t ResetCode[]
+    {
+        0x78,               // SEI
+        0xd8,               // CLD
+        0xa2, 0xff,         // LDX #$ff
+        0x9a,               // TXS
+        0xa9, 0x80,         // LDA #$80
+        0x8d, 0x00, 0x20,   // STA $2000    ; NMI on vblank
+        0x4c, 0x0a, 0xc0    // JMP $c00a
+    };
+
+    // at $c010.
+    const uint8_t NmiCode[]
+    {
+        0xa9, 0x01,         // LDA #1
+        0x8d, 0x16, 0x40,   // STA $4016
+        0xa9, 0x00,         // LDA #0
+        0x8d, 0x16, 0x40,   // STA $4016
+        0xa2, 0x08,         // LDX #8
+        0xad, 0x16, 0x40,   // LDA $4016
+        0x4a,               // LSR A
+        0x26, 0x00,         // ROL $00
+        0xca,               // DEX
+        0xd0, 0xf7,         // BNE -9
+        0xa2, 0x08,         // LDX #8
+        0xad, 0x17, 0x40,   // LDA $4017
+        0x4a,               // LSR A
+        0x26, 0x01,         // ROL $01
+        0xca,               // DEX
+        0xd0, 0xf7,         // BNE -9
+        0xa4, 0x04,         // LDY $04
+        0xa5, 0x00,         // LDA $00
+        0x99, 0x00, 0x02,   // STA $0200,Y
+        0xa5, 0x01,         // LDA $01
+        0x99, 0x00, 0x03,   // STA $0300,Y
+        0xe6, 0x04,         // INC $04
+        0x40                // RTI
+    };
+}
+
+std::vector<uint8_t> CreateTestRom()
+{
+    std::vector<uint8_t> rom(HeaderSize + PrgSize + ChrSize);
+
+    // one 16K PRG bank and one 8K CHR bank, with mapper 0.
+    const uint8_t header[]{ 'N', 'E', 'S', 0x1a, 1, 1 };
+    std::copy(std::begin(header), std::end(header), rom.begin());
+
+    auto prg = rom.begin() + HeaderSize;
+    std::copy(std::begin(ResetCode), std::end(ResetCode), prg);
+    std::copy(std::begin(NmiCode), std::end(NmiCode), prg + 0x10);
+
+    // the NMI, reset and IRQ vectors.
+    const uint8_t vectors[]{ 0x10, 0xc0, 0x00, 0xc0, 0x00, 0xc0 };
+    std::copy(std::begin(vectors), std::end(vectors), prg + PrgSize - sizeof(vectors));
+
+    return rom;
+}
+
+std::unique_ptr<NesSystem> CreateTestSystem(uint32_t audioSampleRate)
+{
+    auto data = CreateTestRom();
+    auto rom = TryLoadINesFile(data.data(), data.size());
+    assert(rom);
+
+    auto cart = TryCreateCart(rom->Descriptor, rom->PrgData, rom->ChrData, rom->Storage);
+    assert(cart);
+    cart->Initialize();
+
+    auto system = std::make_unique<NesSystem>(audioSampleRate);
+    system->InsertCart(std::move(cart));
+    system->PowerCycle();
+    return system;
+}
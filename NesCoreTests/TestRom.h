@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class NesSystem;
+
+// An NROM program which stores both controllers' buttons in RAM on every frame, at $0200 and $0300 indexed by the
+// frame count in $0004.  Any difference in the inputs a system is given shows up in its state.
+std::vector<uint8_t> CreateTestRom();
+
+// a system with the test ROM inserted, powered on.
+std::unique_ptr<NesSystem> CreateTestSystem(uint32_t audioSampleRate = 44100);
@@ -0,0 +1,15 @@
+#pragma once
+
+// Each test group checks one part of the core without needing a ROM file, so the tests can run anywhere the core
+// builds.  A failed check is reported and the test carries on, so that one run shows everything that is wrong.
+
+void Check(bool condition, const char* expression, const char* file, int line);
+
+#define CHECK(condition) Check((condition), #condition, __FILE__, __LINE__)
+
+void RunBatchTests();
+void RunCartTests();
+void RunCrc32Tests();
+void RunMovieTests();
+void RunNetplayTests();
+void RunStateTests();
@@ -0,0 +1,415 @@
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../NesCore/Crc32.h"
+#include "../NesCore/GameDatabase.h"
+#include "../NesCore/NesSystem.h"
+#include "../NesCore/RomFile.h"
+#include "../NesCore/ThreadPool.h"
+
+#ifdef _MSC_VER
+#include <excpt.h>
+#endif
+
+// Walks a directory of ROM files, checking that each one loads, comparing its header with the game database, and
+// optionally booting it for a number of frames.  The results are written as a CSV report.
+
+enum class RomStatus
+{
+    Ok,
+    InvalidFile,
+    UnsupportedCart,
+    Jammed,
+    Stuck,
+    Timeout,
+    Crashed
+};
+
+struct Options
+{
+    std::filesystem::path Directory;
+    std::filesystem::path ReportPath{ "RomReport.csv" };
+    uint32_t Frames{};
+    // a frame is about 29781 cycles, so this allows for slow frames but still catches a frame that never ends.
+    uint32_t FrameCycles{ 1000000 };
+    uint32_t TimeoutMs{ 10000 };
+    uint32_t ThreadCount{};
+};
+
+struct RomResult
+{
+    std::filesystem::path Path;
+    RomStatus Status{};
+    uint32_t Crc32{};
+    bool InDatabase{};
+    CartDescriptor Descriptor;
+    std::string Mismatches;
+    uint32_t FramesRun{};
+    uint32_t FrameCrc32{};
+    double LoadMs{};
+    double BootMs{};
+};
+
+const char* StatusName(RomStatus status)
+{
+    switch (status)
+    {
+    case RomStatus::Ok:
+        return "Ok";
+    case RomStatus::InvalidFile:
+        return "InvalidFile";
+    case RomStatus::UnsupportedCart:
+        return "UnsupportedCart";
+    case RomStatus::Jammed:
+        return "Jammed";
+    case RomStatus::Stuck:
+        return "Stuck";
+    case RomStatus::Timeout:
+        return "Timeout";
+    case RomStatus::Crashed:
+        return "Crashed";
+    }
+
+    return "";
+}
+
+bool TryParseNumber(const char* text, uint32_t& value)
+{
+    auto end = text + std::strlen(text);
+    auto [last, error] = std::from_chars(text, end, value);
+    return error == std::errc{} && last == end;
+}
+
+bool ParseOptions(int argc, char* argv[], Options& options)
+{
+    for (auto i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+
+        auto next = [&]() -> const char*
+        {
+            return i + 1 < argc ? argv[++i] : nullptr;
+        };
+
+        if (arg == "--frames" || arg == "--frame-cycles" || arg == "--timeout" || arg == "--threads")
+        {
+            auto value = next();
+            if (!value)
+                return false;
+
+            auto& number =
+                arg == "--frames" ? options.Frames :
+                arg == "--frame-cycles" ? options.FrameCycles :
+                arg == "--timeout" ? options.TimeoutMs :
+                options.ThreadCount;
+
+            if (!TryParseNumber(value, number))
+                return false;
+        }
+        else if (arg == "--report")
+        {
+            auto value = next();
+            if (!value)
+                return false;
+
+            options.ReportPath = value;
+        }
+        else if (options.Directory.empty())
+        {
+            options.Directory = arg;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return !options.Directory.empty();
+}
+
+std::vector<std::filesystem::path> FindRoms(const std::filesystem::path& directory)
+{
+    std::vector<std::filesystem::path> paths;
+
+    for (auto& entry : std::filesystem::recursive_directory_iterator(directory))
+    {
+        if (!entry.is_regular_file())
+            continue;
+
+        auto extension = entry.path().extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return static_cast<char>(std::tolower(c)); });
+        if (extension == ".nes")
+            paths.push_back(entry.path());
+    }
+
+    std::sort(paths.begin(), paths.end());
+    return paths;
+}
+
+std::string CompareDescriptors(const CartDescriptor& header, const CartDescriptor& database)
+{
+    std::string mismatches;
+    auto add = [&](const char* field)
+    {
+        if (!mismatches.empty())
+            mismatches += ';';
+        mismatches += field;
+    };
+
+    // iNES 1.0 headers can't express a sub-mapper, so we don't compare them.
+    if (header.Mapper != database.Mapper)
+        add("Mapper");
+    if (header.MirrorMode != database.MirrorMode)
+        add("MirrorMode");
+    if (header.PrgRamSize != database.PrgRamSize)
+        add("PrgRam");
+    if (header.PrgBatteryRamSize != database.PrgBatteryRamSize)
+        add("PrgBatteryRam");
+    if (header.ChrRamSize != database.ChrRamSize)
+        add("ChrRam");
+
+    return mismatches;
+}
+
+void RunFrames(NesSystem& system, const Options& options, RomResult& result)
+{
+    auto startTime = std::chrono::steady_clock::now();
+
+    for (result.FramesRun = 0; result.FramesRun < options.Frames; result.FramesRun++)
+    {
+        if (!system.TryRunFrame(options.FrameCycles))
+        {
+            result.Status = RomStatus::Stuck;
+            return;
+        }
+
+        if (system.CpuJammed())
+        {
+            result.Status = RomStatus::Jammed;
+            return;
+        }
+
+        // a game which is just slow is only caught between frames.
+        auto elapsed = std::chrono::steady_clock::now() - startTime;
+        if (elapsed > std::chrono::milliseconds(options.TimeoutMs))
+        {
+            result.Status = RomStatus::Timeout;
+            return;
+        }
+    }
+}
+
+#ifdef _MSC_VER
+// structured exception handling can't be mixed with objects that need unwinding, so this is kept separate.
+bool TryRunFrames(NesSystem& system, const Options& options, RomResult& result)
+{
+    __try
+    {
+        RunFrames(system, options, result);
+        return true;
+    }
+    __except (EXCEPTION_EXECUTE_HANDLER)
+    {
+        return false;
+    }
+}
+#else
+bool TryRunFrames(NesSystem& system, const Options& options, RomResult& result)
+{
+    RunFrames(system, options, result);
+    return true;
+}
+#endif
+
+void Boot(std::unique_ptr<Cart> cart, const Options& options, RomResult& result)
+{
+    auto system = std::make_unique<NesSystem>(44100);
+
+    cart->Initialize();
+    system->InsertCart(std::move(cart));
+    system->PowerCycle();
+
+    if (!TryRunFrames(*system, options, result))
+    {
+        result.Status = RomStatus::Crashed;
+        return;
+    }
+
+    // a hash of the last frame makes it easy to spot changes in behaviour between runs.
+    Crc32 crc;
+    crc.AddData(system->Display().Buffer(), system->Display().Pitch() * Display::HEIGHT);
+    result.FrameCrc32 = crc.GetHash();
+}
+
+void Analyse(const Options& options, RomResult& result)
+{
+    auto startTime = std::chrono::steady_clock::now();
+    auto elapsedMs = [](auto start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    auto romFile = TryMapINesFile(result.Path);
+    if (!romFile)
+    {
+        result.Status = RomStatus::InvalidFile;
+        result.LoadMs = elapsedMs(startTime);
+        return;
+    }
+
+    result.Crc32 = GameDatabase::HashData(romFile->PrgData, romFile->ChrData);
+    result.Descriptor = romFile->Descriptor;
+
+    auto goodDescriptor = GameDatabase::Lookup(result.Crc32);
+    if (goodDescriptor)
+    {
+        result.InDatabase = true;
+        result.Mismatches = CompareDescriptors(romFile->Descriptor, *goodDescriptor);
+        result.Descriptor = *goodDescriptor;
+    }
+
+    auto cart = TryCreateCart(result.Descriptor, romFile->PrgData, romFile->ChrData, romFile->Storage);
+    result.LoadMs = elapsedMs(startTime);
+
+    if (!cart)
+    {
+        result.Status = RomStatus::UnsupportedCart;
+        return;
+    }
+
+    if (options.Frames)
+    {
+        auto bootTime = std::chrono::steady_clock::now();
+        Boot(std::move(cart), options, result);
+        result.BootMs = elapsedMs(bootTime);
+    }
+}
+
+// quotes a field if it contains anything that would otherwise end it, doubling any quotes inside.
+std::string CsvField(const std::string& value)
+{
+    if (value.find_first_of(",\"\r\n") == std::string::npos)
+        return value;
+
+    std::string field{ '"' };
+    for (auto c : value)
+    {
+        if (c == '"')
+            field += '"';
+        field += c;
+    }
+
+    field += '"';
+    return field;
+}
+
+bool WriteReport(const std::filesystem::path& path, const std::vector<RomResult>& results)
+{
+    std::ofstream report(path);
+    if (!report)
+        return false;
+
+    report << "Path,Status,Crc32,InDatabase,Mapper,SubMapper,HeaderMismatches,FramesRun,FrameCrc32,LoadMs,BootMs" << std::endl;
+
+    for (auto& result : results)
+    {
+        report
+            << CsvField(result.Path.string()) << ','
+            << StatusName(result.Status) << ','
+            << std::hex << std::setfill('0') << std::setw(8) << result.Crc32 << std::dec << ','
+            << (result.InDatabase ? "Yes" : "No") << ','
+            << result.Descriptor.Mapper << ','
+            << static_cast<uint32_t>(result.Descriptor.SubMapper) << ','
+            << CsvField(result.Mismatches) << ','
+            << result.FramesRun << ','
+            << std::hex << std::setw(8) << result.FrameCrc32 << std::dec << ','
+            << std::fixed << std::setprecision(3) << result.LoadMs << ','
+            << result.BootMs << std::endl;
+    }
+
+    return true;
+}
+
+void WriteSummary(const std::vector<RomResult>& results, double elapsedMs)
+{
+    std::map<std::string, uint32_t> statusCounts;
+    std::map<uint16_t, uint32_t> unsupportedMappers;
+    auto notInDatabase = 0u;
+    auto mismatched = 0u;
+
+    for (auto& result : results)
+    {
+        statusCounts[StatusName(result.Status)]++;
+
+        if (result.Status == RomStatus::UnsupportedCart)
+            unsupportedMappers[result.Descriptor.Mapper]++;
+
+        if (result.Status != RomStatus::InvalidFile && !result.InDatabase)
+            notInDatabase++;
+
+        if (!result.Mismatches.empty())
+            mismatched++;
+    }
+
+    std::cout << results.size() << " files in " << std::fixed << std::setprecision(0) << elapsedMs << "ms" << std::endl;
+
+    for (auto& [status, count] : statusCounts)
+        std::cout << "  " << status << ": " << count << std::endl;
+
+    std::cout << "  Not in database: " << notInDatabase << std::endl;
+    std::cout << "  Header differs from database: " << mismatched << std::endl;
+
+    if (!unsupportedMappers.empty())
+    {
+        std::cout << "Unsupported mappers:" << std::endl;
+        for (auto& [mapper, count] : unsupportedMappers)
+            std::cout << "  " << mapper << ": " << count << std::endl;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Options options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        std::cerr << "Usage: RomAnalyser <directory> [--frames n] [--frame-cycles n] [--timeout ms] [--threads n] "
+            "[--report path]" << std::endl;
+        return -1;
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    std::vector<RomResult> results;
+    for (auto& path : FindRoms(options.Directory))
+    {
+        results.emplace_back().Path = path;
+    }
+
+    ThreadPool threadPool{ options.ThreadCount };
+    threadPool.ParallelFor(static_cast<uint32_t>(results.size()), [&](uint32_t index)
+        {
+            Analyse(options, results[index]);
+        });
+
+    if (!WriteReport(options.ReportPath, results))
+    {
+        std::cerr << "Could not write " << options.ReportPath.string() << std::endl;
+        return -1;
+    }
+
+    auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime);
+    WriteSummary(results, elapsed.count());
+
+    return 0;
+}
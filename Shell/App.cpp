@@ -33,6 +33,8 @@ App::App(HINSTANCE hInstance)
     overscan_{ false },
     integerScaling_{ true },
     scanlines_{ false },
+    runAhead_{ 0 },
+    runAheadSpeculative_{ false },
     player1Device_{ 0 },
     player2Device_{ 0 }
 {
@@ -212,6 +214,15 @@ int App::Run(int nCmdShow)
                             xInputInitialized = true;
                         }
 
+                        // the frames are rendered straight into the texture, so it stays mapped while we emulate them.
+                        auto mapped = emulatedTime_ < targetTime;
+                        if (mapped)
+                        {
+                            uint32_t pitch;
+                            auto frameBuffer = d3d_.MapFrameBuffer(&pitch);
+                            host_.SetFrameBuffer(frameBuffer, pitch);
+                        }
+
                         while (emulatedTime_ < targetTime)
                         {
                             input_.UpdateControllerState();
@@ -263,6 +274,13 @@ int App::Run(int nCmdShow)
                                 break;
                             }
                         }
+
+                        if (mapped)
+                        {
+                            // a frame from the speculative run-ahead has to be copied in.
+                            d3d_.UnmapFrameBuffer(host_.PixelData());
+                            host_.ResetFrameBuffer();
+                        }
                     }
 
                     if (outOfSync)
@@ -280,7 +298,7 @@ int App::Run(int nCmdShow)
                     }
                     else
                     {
-                        d3d_.RenderFrame(host_.PixelData(), 1);
+                        d3d_.RenderFrame(1);
                     }
 
                     // allow ourselves to run slightly behind if it means we nicely hit a frame boundary.
@@ -460,8 +478,9 @@ bool App::LoadGame(HWND wnd, const std::wstring& romPath)
 
     auto cart = TryCreateCart(
         romFile->Descriptor,
-        std::move(romFile->PrgData),
-        std::move(romFile->ChrData));
+        romFile->PrgData,
+        romFile->ChrData,
+        romFile->Storage);
 
     if (!cart)
     {
@@ -504,7 +523,15 @@ bool App::LoadGame(HWND wnd, const std::wstring& romPath)
 
     cart->Initialize();
 
-    host_.Load(std::move(cart));
+    // running ahead on another core needs a second copy of the cart, which shares the ROM with the first.
+    auto aheadCart = TryCreateCart(
+        romFile->Descriptor,
+        romFile->PrgData,
+        romFile->ChrData,
+        romFile->Storage);
+    aheadCart->Initialize();
+
+    host_.Load(std::move(cart), std::move(aheadCart));
     host_.Start();
 
     menu_.SetLoaded(true);
@@ -544,22 +571,9 @@ std::unique_ptr<RomFile> App::LoadCart(const std::wstring& romPath)
     if (fileSize.QuadPart > maxFileSize)
         throw Error(L"ROM File is suspiciously large!");
 
-    winrt::handle mapping{
-        CreateFileMapping(
-            hFile.get(),
-            NULL,
-            PAGE_READONLY,
-            0,
-            0,
-            NULL) };
-    winrt::check_bool(bool{ mapping });
-
-    auto data = MapViewOfFile(mapping.get(), FILE_MAP_READ, 0, 0, 0);
-    if (data == NULL)
-        winrt::throw_last_error();
+    hFile.close();
 
-    auto romFile = TryLoadINesFile(reinterpret_cast<uint8_t*>(data), fileSize.LowPart);
-    UnmapViewOfFile(data);
+    auto romFile = TryMapINesFile(romPath);
     if (!romFile)
         throw Error(L"Unsupported or invalid ROM file: " + romPath);
 
@@ -829,6 +843,29 @@ bool App::ProcessCommand(WORD command)
         menu_.SetRewindEnabled(rewindEnabled_);
     }
 
+    if (command >= static_cast<WORD>(MenuCommand::RunAheadOff)
+        && command <= static_cast<WORD>(MenuCommand::RunAhead4))
+    {
+        runAhead_ = command - static_cast<WORD>(MenuCommand::RunAheadOff);
+        if (runAhead_)
+            host_.EnableRunAhead(runAhead_, runAheadSpeculative_);
+        else
+            host_.DisableRunAhead();
+
+        menu_.SetRunAhead(runAhead_);
+        return true;
+    }
+
+    if (command == static_cast<WORD>(MenuCommand::RunAheadSpeculative))
+    {
+        runAheadSpeculative_ = !runAheadSpeculative_;
+        if (runAhead_)
+            host_.EnableRunAhead(runAhead_, runAheadSpeculative_);
+
+        menu_.SetRunAheadSpeculative(runAheadSpeculative_);
+        return true;
+    }
+
     if (command == static_cast<WORD>(MenuCommand::Fullscreen))
     {
         SetFullscreen(!fullscreen_);
@@ -73,6 +73,8 @@ private:
     bool scanlines_;
 
     bool rewindEnabled_;
+    uint32_t runAhead_;
+    bool runAheadSpeculative_;
 
     bool foreground_;
 
@@ -18,6 +18,7 @@ D3DRenderer::D3DRenderer() :
     width_{},
     height_{},
     window_{ NULL },
+    mappedFrameBuffer_{},
     overscan_{},
     splash_{},
     scanlines_{},
@@ -122,36 +123,47 @@ void D3DRenderer::ClearFrameBuffer()
     deviceContext_->Unmap(frameBuffer_.get(), 0);
 }
 
-void D3DRenderer::RenderFrame(const uint32_t* buffer, uint32_t displayFrames)
+uint8_t* D3DRenderer::MapFrameBuffer(uint32_t* pitch)
 {
-    FLOAT grey[4]{ 0.125, 0.125, 0.125, 1.0 };
-    deviceContext_->ClearRenderTargetView(renderTargetView_.get(), grey);
-
-    auto renderTargetView = renderTargetView_.get();
-    deviceContext_->OMSetRenderTargets(1, &renderTargetView, nullptr);
-
-    D3D11_MAPPED_SUBRESOURCE resource;
-    auto hr = deviceContext_->Map(frameBuffer_.get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &resource);
+    auto hr = deviceContext_->Map(frameBuffer_.get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedFrameBuffer_);
     winrt::check_hresult(hr);
 
-    auto src = reinterpret_cast<const uint8_t*>(buffer);
-    auto srcPitch = width_ * 4;
-
-    auto dst = reinterpret_cast<uint8_t*>(resource.pData);
-    auto dstPitch = resource.RowPitch;
+    *pitch = mappedFrameBuffer_.RowPitch;
+    return reinterpret_cast<uint8_t*>(mappedFrameBuffer_.pData);
+}
 
-    for (auto y = 0u; y < height_; y++)
+void D3DRenderer::UnmapFrameBuffer(const uint32_t* buffer)
+{
+    if (buffer)
     {
-        memcpy(dst, src, srcPitch);
-        dst += dstPitch;
-        src += srcPitch;
+        auto src = reinterpret_cast<const uint8_t*>(buffer);
+        auto srcPitch = width_ * 4;
+
+        auto dst = reinterpret_cast<uint8_t*>(mappedFrameBuffer_.pData);
+        auto dstPitch = mappedFrameBuffer_.RowPitch;
+
+        for (auto y = 0u; y < height_; y++)
+        {
+            memcpy(dst, src, srcPitch);
+            dst += dstPitch;
+            src += srcPitch;
+        }
     }
 
     deviceContext_->Unmap(frameBuffer_.get(), 0);
+}
+
+void D3DRenderer::RenderFrame(uint32_t displayFrames)
+{
+    FLOAT grey[4]{ 0.125, 0.125, 0.125, 1.0 };
+    deviceContext_->ClearRenderTargetView(renderTargetView_.get(), grey);
+
+    auto renderTargetView = renderTargetView_.get();
+    deviceContext_->OMSetRenderTargets(1, &renderTargetView, nullptr);
 
     deviceContext_->DrawIndexed(6, 0, overscan_ ? 4 : 0);
 
-    hr = swapChain_->Present(displayFrames, 0);
+    auto hr = swapChain_->Present(displayFrames, 0);
     winrt::check_hresult(hr);
 }
 
@@ -25,7 +25,13 @@ public:
 
     void ClearFrameBuffer();
 
-    void RenderFrame(const uint32_t* buffer, uint32_t refreshCycles);
+    // maps the frame buffer, so that the emulator can render straight into it.  Returns the address and row pitch of
+    // the buffer, which must not be touched once it is unmapped.
+    uint8_t* MapFrameBuffer(uint32_t* pitch);
+    // copies the given frame into the buffer, if it wasn't rendered there, and unmaps it.
+    void UnmapFrameBuffer(const uint32_t* buffer);
+
+    void RenderFrame(uint32_t refreshCycles);
     void RepeatLastFrame();
     void RenderClear();
 
@@ -77,6 +83,7 @@ private:
     winrt::com_ptr<ID3D11Buffer> vertexBuffer_;
     winrt::com_ptr<ID3D11Buffer> indexBuffer_;
     winrt::com_ptr<ID3D11Texture2D> frameBuffer_;
+    D3D11_MAPPED_SUBRESOURCE mappedFrameBuffer_;
 
     DefaultShaders defaultShaders_;
     ScanlineShaders scanlineShaders_;
@@ -3,12 +3,21 @@
 #include "Host.h"
 #include "ExtendedButtons.h"
 
+#include <algorithm>
+
 Host::Host()
     : sampleRate_{ 0 },
     running_ { false },
     step_ { false },
     rewind_{ false },
-    wasRewindPressed_{ false }
+    wasRewindPressed_{ false },
+    runAhead_{ 0 },
+    speculative_{ false },
+    ranAhead_{ false },
+    aheadFrame_{ nullptr },
+    hasFrameBuffer_{ false },
+    player1Buttons_{ 0 },
+    player2Buttons_{ 0 }
 {
 }
 
@@ -17,22 +26,41 @@ void Host::SetSampleRate(uint32_t sampleRate)
     sampleRate_ = sampleRate;
 }
 
-void Host::Load(std::unique_ptr<Cart> cartridge)
+void Host::Load(std::unique_ptr<Cart> cartridge, std::unique_ptr<Cart> aheadCartridge)
 {
+    speculation_.reset();
+
     if (!system_)
         system_ = std::make_unique<NesSystem>(sampleRate_);
 
+    if (aheadCartridge)
+    {
+        if (!aheadSystem_)
+            aheadSystem_ = std::make_unique<NesSystem>(sampleRate_);
+
+        aheadSystem_->Apu().SetSamplesPerFrame(system_->Apu().SamplesPerFrame());
+        aheadSystem_->InsertCart(std::move(aheadCartridge));
+    }
+    else
+    {
+        aheadSystem_.reset();
+    }
+
     system_->InsertCart(std::move(cartridge));
-    system_->Reset();
+    system_->PowerCycle();
 
     system_->CaptureState(&state_);
 
     if (rewindBuffer_)
         rewindBuffer_->Clear();
+
+    UpdateSpeculation();
 }
 
 void Host::Unload()
 {
+    speculation_.reset();
+    aheadSystem_.reset();
     system_.release();
 }
 
@@ -58,16 +86,10 @@ void Host::Step()
 
 void Host::Restart()
 {
-    auto cart = system_->RemoveCart();
-
-    // TODO: implement this better
-    // we don't have a way to reset the nes, so lets just build a new one.
-    system_ = std::make_unique<NesSystem>(sampleRate_);
+    if (speculation_)
+        speculation_->Cancel();
 
-    cart->Initialize();
-
-    system_->InsertCart(std::move(cart));
-    system_->Reset();
+    system_->PowerCycle();
 }
 
 void Host::EnableRewind()
@@ -81,6 +103,19 @@ void Host::DisableRewind()
     rewind_ = false;
 }
 
+void Host::EnableRunAhead(uint32_t frames, bool speculative)
+{
+    runAhead_ = std::clamp(frames, 1u, MAX_RUN_AHEAD);
+    speculative_ = speculative;
+    UpdateSpeculation();
+}
+
+void Host::DisableRunAhead()
+{
+    runAhead_ = 0;
+    UpdateSpeculation();
+}
+
 bool Host::Loaded() const
 {
     return !!system_;
@@ -104,7 +139,41 @@ void Host::RunFrame()
             rewind_ = false;
     }
 
-    system_->RunFrame();
+    aheadFrame_ = nullptr;
+
+    if (runAhead_ && !rewind_)
+    {
+        // the speculation reads the state we captured last frame, so it has to finish before we capture another.
+        if (speculation_)
+            aheadFrame_ = speculation_->Finish(player1Buttons_, player2Buttons_);
+
+        // the real frame is never shown, as we show the frame that the current input leads to instead.
+        system_->SkipFrames(1);
+
+        auto samples = system_->Apu().Samples();
+        runAheadSamples_.assign(samples, samples + system_->Apu().SamplesPerFrame());
+
+        system_->CaptureState(&runAheadState_);
+
+        if (!aheadFrame_)
+        {
+            system_->RunFrame(runAhead_ - 1);
+            system_->RestoreState(runAheadState_);
+        }
+
+        if (speculation_)
+            speculation_->Start(runAheadState_, runAhead_, player1Buttons_, player2Buttons_);
+
+        ranAhead_ = true;
+    }
+    else
+    {
+        if (speculation_)
+            speculation_->Cancel();
+
+        system_->RunFrame();
+        ranAhead_ = false;
+    }
 
     if (rewindBuffer_ && !rewind_)
         system_->CaptureState(rewindBuffer_->Push());
@@ -113,9 +182,27 @@ void Host::RunFrame()
         running_ = false;
 }
 
+void Host::SetFrameBuffer(uint8_t* buffer, uint32_t pitch)
+{
+    system_->SetFrameBuffers(PixelFormat::Xrgb8888, &buffer, 1, pitch);
+    hasFrameBuffer_ = true;
+}
+
+void Host::ResetFrameBuffer()
+{
+    system_->ResetFrameBuffers();
+    hasFrameBuffer_ = false;
+}
+
 const uint32_t* Host::PixelData() const
 {
-    return system_->Display().Buffer();
+    if (aheadFrame_)
+        return aheadFrame_;
+
+    if (hasFrameBuffer_)
+        return nullptr;
+
+    return reinterpret_cast<const uint32_t*>(system_->Display().Buffer());
 }
 
 uint32_t Host::RefreshRate() const
@@ -130,6 +217,9 @@ const int16_t* Host::AudioSamples() const
         system_->Apu().Reverse();
     }
 
+    if (ranAhead_)
+        return runAheadSamples_.data();
+
     return system_->Apu().Samples();
 }
 
@@ -140,7 +230,12 @@ const uint32_t Host::SamplesPerFrame() const
 
 void Host::SetSamplesPerFrame(uint32_t samples)
 {
+    if (speculation_)
+        speculation_->Cancel();
+
     system_->Apu().SetSamplesPerFrame(samples);
+    if (aheadSystem_)
+        aheadSystem_->Apu().SetSamplesPerFrame(samples);
 }
 
 void Host::Snapshot()
@@ -151,14 +246,18 @@ void Host::Snapshot()
 
 void Host::Restore()
 {
+    if (speculation_)
+        speculation_->Cancel();
+
     if (system_)
         system_->RestoreState(state_);
 }
 
 void Host::SetController1State(int32_t buttons)
 {
+    player1Buttons_ = buttons & 0xff;
     if (system_)
-        system_->Controller1().SetButtonState(buttons & 0xff);
+        system_->Controller1().SetButtonState(player1Buttons_);
 
     if (rewindBuffer_)
     {
@@ -180,6 +279,20 @@ void Host::SetController1State(int32_t buttons)
 
 void Host::SetController2State(int32_t buttons)
 {
+    player2Buttons_ = buttons & 0xff;
     if (system_)
-        system_->Controller2().SetButtonState(buttons & 0xff);
+        system_->Controller2().SetButtonState(player2Buttons_);
+}
+
+void Host::UpdateSpeculation()
+{
+    if (runAhead_ && speculative_ && aheadSystem_)
+    {
+        if (!speculation_)
+            speculation_ = std::make_unique<SpeculativeRunAhead>(*aheadSystem_);
+    }
+    else
+    {
+        speculation_.reset();
+    }
 }
@@ -5,6 +5,11 @@
 #include "..\NesCore\SystemState.h"
 
 #include "RewindBuffer.h"
+#include "SpeculativeRunAhead.h"
+
+#include <vector>
+
+const uint32_t MAX_RUN_AHEAD{ 4 };
 
 class Host
 {
@@ -13,7 +18,8 @@ public:
 
     void SetSampleRate(uint32_t sampleRate);
 
-    void Load(std::unique_ptr<Cart> cartridge);
+    // the second cart is optional, and lets us run ahead on another core.  It must be created from the same ROM.
+    void Load(std::unique_ptr<Cart> cartridge, std::unique_ptr<Cart> aheadCartridge = nullptr);
     void Unload();
 
     void Start();
@@ -24,11 +30,24 @@ public:
     void EnableRewind();
     void DisableRewind();
 
+    // each frame, runs the given number of frames ahead with the current input and shows the last of them, before
+    // going back to the real state.  This hides the input lag that many games have built in.  Speculative run-ahead
+    // does the same on another core, guessing that the buttons won't change, and only runs ahead on this thread when
+    // the guess was wrong.
+    void EnableRunAhead(uint32_t frames, bool speculative = false);
+    void DisableRunAhead();
+
     bool Loaded() const;
     bool Running() const;
 
     void RunFrame();
 
+    // renders the frames into the given buffer rather than the system's own, until it is reset.  The buffer is in
+    // XRGB8888 format.
+    void SetFrameBuffer(uint8_t* buffer, uint32_t pitch);
+    void ResetFrameBuffer();
+
+    // the last frame, or null if it was rendered into the frame buffer.
     const uint32_t* PixelData() const;
     uint32_t RefreshRate() const;
 
@@ -43,6 +62,8 @@ public:
     void SetController2State(int32_t buttons);
 
 private:
+    void UpdateSpeculation();
+
     uint32_t sampleRate_;
     std::unique_ptr<NesSystem> system_;
 
@@ -54,5 +75,22 @@ private:
     bool wasRewindPressed_;
     bool rewind_;
 
+    uint32_t runAhead_;
+    bool speculative_;
+    bool ranAhead_;
+    // reused every frame, so that capturing and restoring only copy the pages of memory that have changed.
+    SystemState runAheadState_;
+    // the audio of the real frame, as the frames run ahead are never heard.
+    std::vector<int16_t> runAheadSamples_;
+
+    std::unique_ptr<NesSystem> aheadSystem_;
+    std::unique_ptr<SpeculativeRunAhead> speculation_;
+    // the frame drawn by the speculation, when it guessed right.
+    const uint32_t* aheadFrame_;
+    bool hasFrameBuffer_;
+
+    uint8_t player1Buttons_;
+    uint8_t player2Buttons_;
+
     SystemState state_;
 };
\ No newline at end of file
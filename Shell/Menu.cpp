@@ -23,6 +23,16 @@ Menu::Menu()
     AppendMenu(gameMenu, MF_SEPARATOR, NULL, NULL);
     AppendMenu(gameMenu, MF_ENABLED, reinterpret_cast<UINT_PTR>(reinterpret_cast<void*>(MenuCommand::RewindEnabled)), L"Enable &Rewind");
 
+    auto runAheadMenu = CreatePopupMenu();
+    AppendMenu(runAheadMenu, MF_ENABLED | MF_CHECKED, reinterpret_cast<UINT_PTR>(reinterpret_cast<void*>(MenuCommand::RunAheadOff)), L"Off");
+    AppendMenu(runAheadMenu, MF_ENABLED, reinterpret_cast<UINT_PTR>(reinterpret_cast<void*>(MenuCommand::RunAhead1)), L"1 Frame");
+    AppendMenu(runAheadMenu, MF_ENABLED, reinterpret_cast<UINT_PTR>(reinterpret_cast<void*>(MenuCommand::RunAhead2)), L"2 Frames");
+    AppendMenu(runAheadMenu, MF_ENABLED, reinterpret_cast<UINT_PTR>(reinterpret_cast<void*>(MenuCommand::RunAhead3)), L"3 Frames");
+    AppendMenu(runAheadMenu, MF_ENABLED, reinterpret_cast<UINT_PTR>(reinterpret_cast<void*>(MenuCommand::RunAhead4)), L"4 Frames");
+    AppendMenu(runAheadMenu, MF_SEPARATOR, NULL, NULL);
+    AppendMenu(runAheadMenu, MF_ENABLED, reinterpret_cast<UINT_PTR>(reinterpret_cast<void*>(MenuCommand::RunAheadSpeculative)), L"Use a Second Core");
+    AppendMenu(gameMenu, MF_POPUP, reinterpret_cast<UINT_PTR>(runAheadMenu), L"Run-&Ahead");
+
     AppendMenu(menuBar_, MF_POPUP, reinterpret_cast<UINT_PTR>(gameMenu), L"&Game");
 
     auto inputMenu = CreateMenu();
@@ -85,6 +95,18 @@ void Menu::SetRewindEnabled(bool enabled)
     CheckMenuItem(menuBar_, static_cast<UINT>(MenuCommand::RewindEnabled), enabled ? MF_CHECKED : MF_UNCHECKED);
 }
 
+void Menu::SetRunAhead(uint32_t frames)
+{
+    auto first = static_cast<UINT>(MenuCommand::RunAheadOff);
+    for (auto command = first; command <= static_cast<UINT>(MenuCommand::RunAhead4); command++)
+        CheckMenuItem(menuBar_, command, command - first == frames ? MF_CHECKED : MF_UNCHECKED);
+}
+
+void Menu::SetRunAheadSpeculative(bool speculative)
+{
+    CheckMenuItem(menuBar_, static_cast<UINT>(MenuCommand::RunAheadSpeculative), speculative ? MF_CHECKED : MF_UNCHECKED);
+}
+
 void Menu::SetLoaded(bool isLoaded)
 {
     EnableMenuItem(menuBar_, static_cast<UINT>(MenuCommand::Close), isLoaded ? MF_ENABLED : MF_DISABLED);
@@ -12,6 +12,12 @@ enum class MenuCommand : WORD
     Snapshot = 202,
     Restore = 203,
     RewindEnabled = 204,
+    RunAheadOff = 210,
+    RunAhead1 = 211,
+    RunAhead2 = 212,
+    RunAhead3 = 213,
+    RunAhead4 = 214,
+    RunAheadSpeculative = 215,
 
     InputPlayer1Keyboard = 301,
     InputPlayer1Controller0 = 302,
@@ -41,6 +47,8 @@ public:
     HACCEL AcceleratorTable() const;
 
     void SetRewindEnabled(bool enabled);
+    void SetRunAhead(uint32_t frames);
+    void SetRunAheadSpeculative(bool speculative);
 
     void SetLoaded(bool isLoaded);
     void SetOverscan(bool overscan);
@@ -0,0 +1,99 @@
+#include "pch.h"
+#include "SpeculativeRunAhead.h"
+
+#include <algorithm>
+
+SpeculativeRunAhead::SpeculativeRunAhead(NesSystem& system)
+    : system_{ system }
+{
+    for (auto& buffer : frameBuffers_)
+        buffer.resize(Display::WIDTH * Display::HEIGHT);
+
+    thread_ = std::thread{ &SpeculativeRunAhead::WorkerLoop, this };
+}
+
+SpeculativeRunAhead::~SpeculativeRunAhead()
+{
+    {
+        std::lock_guard lock{ mutex_ };
+        stopping_ = true;
+    }
+
+    workAvailable_.notify_one();
+    thread_.join();
+}
+
+void SpeculativeRunAhead::Start(const SystemState& state, uint32_t frames, uint8_t player1, uint8_t player2)
+{
+    {
+        std::lock_guard lock{ mutex_ };
+        assert(!running_);
+
+        state_ = &state;
+        frames_ = frames;
+        player1_ = player1;
+        player2_ = player2;
+
+        running_ = true;
+        started_ = true;
+    }
+
+    workAvailable_.notify_one();
+}
+
+const uint32_t* SpeculativeRunAhead::Finish(uint8_t player1, uint8_t player2)
+{
+    std::unique_lock lock{ mutex_ };
+    workComplete_.wait(lock, [this] { return !running_; });
+
+    if (!started_)
+        return nullptr;
+
+    started_ = false;
+
+    if (player1 != player1_ || player2 != player2_)
+        return nullptr;
+
+    shownBuffer_ ^= 1;
+    return frameBuffers_[shownBuffer_].data();
+}
+
+void SpeculativeRunAhead::Cancel()
+{
+    std::unique_lock lock{ mutex_ };
+    workComplete_.wait(lock, [this] { return !running_; });
+
+    started_ = false;
+}
+
+void SpeculativeRunAhead::WorkerLoop()
+{
+    std::unique_lock lock{ mutex_ };
+
+    while (true)
+    {
+        workAvailable_.wait(lock, [this] { return running_ || stopping_; });
+        if (stopping_)
+            return;
+
+        auto& state = *state_;
+        auto frames = frames_;
+        auto player1 = player1_;
+        auto player2 = player2_;
+        auto& buffer = frameBuffers_[shownBuffer_ ^ 1];
+
+        lock.unlock();
+
+        system_.RestoreState(state);
+        system_.Controller1().SetButtonState(player1);
+        system_.Controller2().SetButtonState(player2);
+        system_.RunFrame(frames);
+
+        auto frame = reinterpret_cast<const uint32_t*>(system_.Display().Buffer());
+        std::copy(frame, frame + buffer.size(), buffer.begin());
+
+        lock.lock();
+        running_ = false;
+        workComplete_.notify_all();
+    }
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "../NesCore/NesSystem.h"
+#include "../NesCore/SystemState.h"
+
+#include <array>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Runs ahead on a second system on another core, guessing that the buttons held on the next frame will be the same
+// as on this one.  When the guess is right, the frame it drew is the one that run-ahead would show, so the emulation
+// thread only has to emulate the real frame.
+class SpeculativeRunAhead
+{
+public:
+    // the system must have a cart created from the same ROM as the one we are running ahead of.
+    SpeculativeRunAhead(NesSystem& system);
+    ~SpeculativeRunAhead();
+
+    SpeculativeRunAhead(const SpeculativeRunAhead&) = delete;
+    SpeculativeRunAhead& operator=(const SpeculativeRunAhead&) = delete;
+
+    // starts emulating the next frame from the given state, followed by the given number of frames beyond it, holding
+    // the given buttons throughout.  The state must be left alone until the speculation is finished or cancelled.
+    void Start(const SystemState& state, uint32_t frames, uint8_t player1, uint8_t player2);
+
+    // waits for the speculation to complete, and returns the last frame it drew if it guessed the buttons that were
+    // actually held, or null if it guessed wrong or wasn't started.  The frame is left untouched by the next
+    // speculation.
+    const uint32_t* Finish(uint8_t player1, uint8_t player2);
+
+    // waits for the speculation to complete, and throws it away.
+    void Cancel();
+
+private:
+    void WorkerLoop();
+
+    NesSystem& system_;
+
+    std::thread thread_;
+    std::mutex mutex_;
+    std::condition_variable workAvailable_;
+    std::condition_variable workComplete_;
+
+    const SystemState* state_{};
+    uint32_t frames_{};
+    uint8_t player1_{};
+    uint8_t player2_{};
+
+    // whether the worker is emulating, and whether there is a speculation that hasn't been finished or cancelled.
+    bool running_{};
+    bool started_{};
+    bool stopping_{};
+
+    // the speculation draws into the buffer that isn't being shown.
+    std::array<std::vector<uint32_t>, 2> frameBuffers_;
+    uint32_t shownBuffer_{};
+};